@@ -47,19 +47,88 @@
     #define SFCB_FLASH_IST_WR_DSBL          0x04        /**<  Instruction Write disable             W25Q16JV_Rev_H: p.23, Write Disable (04h)                       */
     #define SFCB_FLASH_IST_ERASE_BULK       0xc7        /**<  Instruction Chip Erase                W25Q16JV_Rev_H: p.38, Chip Erase (C7h / 60h)                    */
     #define SFCB_FLASH_IST_ERASE_SECTOR     0x20        /**<  Instruction Sector Erase              W25Q16JV_Rev_H: p.35, Sector Erase (20h)                        */
+    #define SFCB_FLASH_IST_ERASE_BLK32      0x52        /**<  Instruction 32KB Block Erase          W25Q16JV_Rev_H: p.36, 32KB Block Erase (52h)                    */
+    #define SFCB_FLASH_IST_ERASE_BLK64      0xd8        /**<  Instruction 64KB Block Erase          W25Q16JV_Rev_H: p.37, 64KB Block Erase (D8h)                    */
     #define SFCB_FLASH_IST_RD_STATE_REG     0x05        /**<  Instruction Read Status Register      W25Q16JV_Rev_H: p.23, Read Status Register-1 (05h)              */
     #define SFCB_FLASH_IST_RD_DATA          0x03        /**<  Instruction Read Data                 W25Q16JV_Rev_H: p.26, Read Data, Single SPI Mode (03h)          */
     #define SFCB_FLASH_IST_WR_PAGE          0x02        /**<  Instruction Write Page                W25Q16JV_Rev_H: p.33, Page Program (02h)                        */
+    #define SFCB_FLASH_IST_WR_PAGE_QUAD     0x32        /**<  Instruction Quad Write Page           W25Q16JV_Rev_H: Quad Input Page Program (32h)                   */
+    #define SFCB_FLASH_IST_RD_FAST          0x0b        /**<  Instruction Fast Read                 W25Q16JV_Rev_H: Fast Read (0Bh)                                 */
+    #define SFCB_FLASH_IST_RD_DUAL          0x3b        /**<  Instruction Dual Output Read          W25Q16JV_Rev_H: Fast Read Dual Output (3Bh)                     */
+    #define SFCB_FLASH_IST_RD_QUAD          0x6b        /**<  Instruction Quad Output Read          W25Q16JV_Rev_H: Fast Read Quad Output (6Bh)                     */
+    #define SFCB_FLASH_IST_RD_QUAD_IO       0xeb        /**<  Instruction Quad I/O Read             W25Q16JV_Rev_H: Fast Read Quad I/O (EBh)                        */
+    #define SFCB_FLASH_IST_ERASE_SUSPEND    0x75        /**<  Instruction Erase Suspend             W25Q16JV_Rev_H: p.39, Erase / Program Suspend (75h)             */
+    #define SFCB_FLASH_IST_ERASE_RESUME     0x7a        /**<  Instruction Erase Resume              W25Q16JV_Rev_H: p.40, Erase / Program Resume (7Ah)              */
     #define SFCB_FLASH_TOPO_ADR_BYTE        3           /**<  Topology Number address bytes         W25Q16JV_Rev_H: p.26, Read Data                                 */
     #define SFCB_FLASH_TOPO_SECTOR_SIZE     4096        /**<  Topology Sector Size in bytes         W25Q16JV_Rev_H: p.35, Sector Erase (20h)
                                                                 #SFCB_FLASH_IST_ERASE_SECTOR                                                                        */
+    #define SFCB_FLASH_TOPO_BLK32_SIZE      32768       /**<  Topology 32KB Block Size in bytes     W25Q16JV_Rev_H: p.36, #SFCB_FLASH_IST_ERASE_BLK32               */
+    #define SFCB_FLASH_TOPO_BLK64_SIZE      65536       /**<  Topology 64KB Block Size in bytes     W25Q16JV_Rev_H: p.37, #SFCB_FLASH_IST_ERASE_BLK64               */
     #define SFCB_FLASH_TOPO_PAGE_SIZE       256         /**<  Topology Page Size in bytes           W25Q16JV_Rev_H: p.33, Page Program (02h)
                                                                 #SFCB_FLASH_IST_WR_PAGE                                                                             */
     #define SFCB_FLASH_TOPO_FLASH_SIZE      2097152     /**<  Topology Total flash size in bytes    W25Q16JV_Rev_H: p.71, ORDERING INFORMATION                      */
     #define SFCB_FLASH_TOPO_RDID_DUMMY      3           /**<  Topology Number of dummy bytes        W25Q16JV_Rev_H: p.44, Read Manufacturer / Device ID (90h)
                                                                 #SFCB_FLASH_IST_RDID                                                                                */
+    #define SFCB_FLASH_TOPO_RD_FAST_DUMMY   1           /**<  Topology dummy bytes, single lane     W25Q16JV_Rev_H: Fast Read (0Bh), 3Bh, 6Bh: 8 dummy clocks
+                                                                #SFCB_FLASH_IST_RD_FAST, #SFCB_FLASH_IST_RD_DUAL, #SFCB_FLASH_IST_RD_QUAD                           */
+    #define SFCB_FLASH_TOPO_RD_QIO_DUMMY    3           /**<  Topology mode and dummy bytes, quad   W25Q16JV_Rev_H: Fast Read Quad I/O (EBh): M7-0 and 4 dummy clocks
+                                                                #SFCB_FLASH_IST_RD_QUAD_IO                                                                          */
     #define SFCB_FLASH_MNG_WIP_MSK          0x01        /**<  MGMT: write-in-progress               W25Q16JV_Rev_H: p.11, Erase/Write In Progress (BUSY) - RO       */
     #define SFCB_FLASH_MNG_WRENA_MSK        0x02        /**<  MGMT: write enable                    W25Q16JV_Rev_H: p.11, Write Enable Latch (WEL) - RO             */
+    #define SFCB_FLASH_MNG_RDSR_CONT        1           /**<  MGMT: status register continuous read W25Q16JV_Rev_H: p.23, Read Status Register-1 (05h)              */
+    #define SFCB_FLASH_TIME_PAGE_PROG       400         /**<  Timing: typ. page program in us       W25Q16JV_Rev_H: AC Electrical Characteristics, tPP              */
+    #define SFCB_FLASH_TIME_ERASE_SECTOR    45000       /**<  Timing: typ. sector erase in us       W25Q16JV_Rev_H: AC Electrical Characteristics, tSE              */
+    #define SFCB_FLASH_TIME_ERASE_BLK32     120000      /**<  Timing: typ. 32KB block erase in us   W25Q16JV_Rev_H: AC Electrical Characteristics, tBE1             */
+    #define SFCB_FLASH_TIME_ERASE_BLK64     150000      /**<  Timing: typ. 64KB block erase in us   W25Q16JV_Rev_H: AC Electrical Characteristics, tBE2             */
+
+#elif defined(W25Q256JV)
+    /* @brief W25Q256JV
+    *
+    *  Winbond SPI Flash W25Q256JV, 32MByte SPI Flash, 4-Byte address instructions
+    *
+    *  @see https://www.winbond.com/resource-files/w25q256jv%20spi%20revg%2008032017.pdf
+    *
+    */
+    #define SFCB_FLASH_NAME                 "W25Q256JV" /**<  Flash name                                                                                            */
+    #define SFCB_FLASH_ID_HEX               "ef18"      /**<  HexID as asccii-hex                   W25Q256JV_Rev_G: Manufacturer and Device Identification         */
+    #define SFCB_FLASH_IST_RDID             0x90        /**<  Instruction Read ID                   W25Q256JV_Rev_G: Read Manufacturer / Device ID (90h)            */
+    #define SFCB_FLASH_IST_WR_ENA           0x06        /**<  Instruction Write enable              W25Q256JV_Rev_G: Write Enable (06h)                             */
+    #define SFCB_FLASH_IST_WR_DSBL          0x04        /**<  Instruction Write disable             W25Q256JV_Rev_G: Write Disable (04h)                            */
+    #define SFCB_FLASH_IST_ERASE_BULK       0xc7        /**<  Instruction Chip Erase                W25Q256JV_Rev_G: Chip Erase (C7h / 60h)                         */
+    #define SFCB_FLASH_IST_ERASE_SECTOR     0x21        /**<  Instruction Sector Erase              W25Q256JV_Rev_G: Sector Erase with 4-Byte Address (21h)         */
+    #define SFCB_FLASH_IST_ERASE_BLK32      0x0         /**<  Instruction 32KB Block Erase          W25Q256JV_Rev_G: 52h only with 3-Byte address, not supported    */
+    #define SFCB_FLASH_IST_ERASE_BLK64      0xdc        /**<  Instruction 64KB Block Erase          W25Q256JV_Rev_G: Block Erase with 4-Byte Address (DCh)          */
+    #define SFCB_FLASH_IST_RD_STATE_REG     0x05        /**<  Instruction Read Status Register      W25Q256JV_Rev_G: Read Status Register-1 (05h)                   */
+    #define SFCB_FLASH_IST_RD_DATA          0x13        /**<  Instruction Read Data                 W25Q256JV_Rev_G: Read Data with 4-Byte Address (13h)            */
+    #define SFCB_FLASH_IST_WR_PAGE          0x12        /**<  Instruction Write Page                W25Q256JV_Rev_G: Page Program with 4-Byte Address (12h)         */
+    #define SFCB_FLASH_IST_WR_PAGE_QUAD     0x34        /**<  Instruction Quad Write Page           W25Q256JV_Rev_G: Quad Input Page Program with 4-Byte Address (34h) */
+    #define SFCB_FLASH_IST_RD_FAST          0x0c        /**<  Instruction Fast Read                 W25Q256JV_Rev_G: Fast Read with 4-Byte Address (0Ch)            */
+    #define SFCB_FLASH_IST_RD_DUAL          0x3c        /**<  Instruction Dual Output Read          W25Q256JV_Rev_G: Fast Read Dual Output with 4-Byte Address (3Ch) */
+    #define SFCB_FLASH_IST_RD_QUAD          0x6c        /**<  Instruction Quad Output Read          W25Q256JV_Rev_G: Fast Read Quad Output with 4-Byte Address (6Ch) */
+    #define SFCB_FLASH_IST_RD_QUAD_IO       0xec        /**<  Instruction Quad I/O Read             W25Q256JV_Rev_G: Fast Read Quad I/O with 4-Byte Address (ECh)   */
+    #define SFCB_FLASH_IST_ERASE_SUSPEND    0x75        /**<  Instruction Erase Suspend             W25Q256JV_Rev_G: Erase / Program Suspend (75h)                  */
+    #define SFCB_FLASH_IST_ERASE_RESUME     0x7a        /**<  Instruction Erase Resume              W25Q256JV_Rev_G: Erase / Program Resume (7Ah)                   */
+    #define SFCB_FLASH_TOPO_ADR_BYTE        4           /**<  Topology Number address bytes         W25Q256JV_Rev_G: 4-Byte address instructions, independent of ADS */
+    #define SFCB_FLASH_TOPO_SECTOR_SIZE     4096        /**<  Topology Sector Size in bytes         W25Q256JV_Rev_G: Sector Erase (21h)
+                                                                #SFCB_FLASH_IST_ERASE_SECTOR                                                                        */
+    #define SFCB_FLASH_TOPO_BLK32_SIZE      32768       /**<  Topology 32KB Block Size in bytes     W25Q256JV_Rev_G: 32KB Block Erase (52h)                         */
+    #define SFCB_FLASH_TOPO_BLK64_SIZE      65536       /**<  Topology 64KB Block Size in bytes     W25Q256JV_Rev_G: #SFCB_FLASH_IST_ERASE_BLK64                    */
+    #define SFCB_FLASH_TOPO_PAGE_SIZE       256         /**<  Topology Page Size in bytes           W25Q256JV_Rev_G: Page Program (12h)
+                                                                #SFCB_FLASH_IST_WR_PAGE                                                                             */
+    #define SFCB_FLASH_TOPO_FLASH_SIZE      33554432    /**<  Topology Total flash size in bytes    W25Q256JV_Rev_G: ORDERING INFORMATION                           */
+    #define SFCB_FLASH_TOPO_RDID_DUMMY      3           /**<  Topology Number of dummy bytes        W25Q256JV_Rev_G: Read Manufacturer / Device ID (90h)
+                                                                #SFCB_FLASH_IST_RDID                                                                                */
+    #define SFCB_FLASH_TOPO_RD_FAST_DUMMY   1           /**<  Topology dummy bytes, single lane     W25Q256JV_Rev_G: 0Ch, 3Ch, 6Ch: 8 dummy clocks
+                                                                #SFCB_FLASH_IST_RD_FAST, #SFCB_FLASH_IST_RD_DUAL, #SFCB_FLASH_IST_RD_QUAD                           */
+    #define SFCB_FLASH_TOPO_RD_QIO_DUMMY    3           /**<  Topology mode and dummy bytes, quad   W25Q256JV_Rev_G: ECh: M7-0 and 4 dummy clocks
+                                                                #SFCB_FLASH_IST_RD_QUAD_IO                                                                          */
+    #define SFCB_FLASH_MNG_WIP_MSK          0x01        /**<  MGMT: write-in-progress               W25Q256JV_Rev_G: Erase/Write In Progress (BUSY) - RO            */
+    #define SFCB_FLASH_MNG_WRENA_MSK        0x02        /**<  MGMT: write enable                    W25Q256JV_Rev_G: Write Enable Latch (WEL) - RO                  */
+    #define SFCB_FLASH_MNG_RDSR_CONT        1           /**<  MGMT: status register continuous read W25Q256JV_Rev_G: Read Status Register-1 (05h)                   */
+    #define SFCB_FLASH_TIME_PAGE_PROG       400         /**<  Timing: typ. page program in us       W25Q256JV_Rev_G: AC Electrical Characteristics, tPP             */
+    #define SFCB_FLASH_TIME_ERASE_SECTOR    50000       /**<  Timing: typ. sector erase in us       W25Q256JV_Rev_G: AC Electrical Characteristics, tSE             */
+    #define SFCB_FLASH_TIME_ERASE_BLK32     120000      /**<  Timing: typ. 32KB block erase in us   W25Q256JV_Rev_G: AC Electrical Characteristics, tBE1            */
+    #define SFCB_FLASH_TIME_ERASE_BLK64     150000      /**<  Timing: typ. 64KB block erase in us   W25Q256JV_Rev_G: AC Electrical Characteristics, tBE2            */
 
 #elif defined(NEWFLASH)
     /* @brief NEWFLASH
@@ -84,18 +153,77 @@
     #define SFCB_FLASH_IST_WR_DSBL          0x0     /**<  Instruction Write disable                                     */
     #define SFCB_FLASH_IST_ERASE_BULK       0x0     /**<  Instruction Chip Erase                                        */
     #define SFCB_FLASH_IST_ERASE_SECTOR     0x0     /**<  Instruction Sector Erase                                      */
+    #define SFCB_FLASH_IST_ERASE_BLK32      0x0     /**<  Instruction 32KB Block Erase, zero if not supported           */
+    #define SFCB_FLASH_IST_ERASE_BLK64      0x0     /**<  Instruction 64KB Block Erase, zero if not supported           */
     #define SFCB_FLASH_IST_RD_STATE_REG     0x0     /**<  Instruction Read Status Register                              */
     #define SFCB_FLASH_IST_RD_DATA          0x0     /**<  Instruction Read Data                                         */
     #define SFCB_FLASH_IST_WR_PAGE          0x0     /**<  Instruction Write Page                                        */
+    #define SFCB_FLASH_IST_WR_PAGE_QUAD     0x0     /**<  Instruction Quad Write Page, zero if not supported            */
+    #define SFCB_FLASH_IST_RD_FAST          0x0     /**<  Instruction Fast Read, zero if not supported                  */
+    #define SFCB_FLASH_IST_RD_DUAL          0x0     /**<  Instruction Dual Output Read, zero if not supported           */
+    #define SFCB_FLASH_IST_RD_QUAD          0x0     /**<  Instruction Quad Output Read, zero if not supported           */
+    #define SFCB_FLASH_IST_RD_QUAD_IO       0x0     /**<  Instruction Quad I/O Read, zero if not supported              */
+    #define SFCB_FLASH_IST_ERASE_SUSPEND    0x0     /**<  Instruction Erase Suspend, zero if not supported              */
+    #define SFCB_FLASH_IST_ERASE_RESUME     0x0     /**<  Instruction Erase Resume                                      */
     #define SFCB_FLASH_TOPO_ADR_BYTE        0       /**<  Topology Number address bytes                                 */
     #define SFCB_FLASH_TOPO_SECTOR_SIZE     0       /**<  Topology Sector Size in bytes, #SFCB_FLASH_IST_ERASE_SECTOR   */
+    #define SFCB_FLASH_TOPO_BLK32_SIZE      0       /**<  Topology 32KB Block Size in bytes, #SFCB_FLASH_IST_ERASE_BLK32 */
+    #define SFCB_FLASH_TOPO_BLK64_SIZE      0       /**<  Topology 64KB Block Size in bytes, #SFCB_FLASH_IST_ERASE_BLK64 */
     #define SFCB_FLASH_TOPO_PAGE_SIZE       0       /**<  Topology Page Size in bytes, #SFCB_FLASH_IST_WR_PAGE          */
     #define SFCB_FLASH_TOPO_FLASH_SIZE      0       /**<  Topology Total flash size in bytes                            */
     #define SFCB_FLASH_TOPO_RDID_DUMMY      0       /**<  Topology Number of dummy bytes, #SFCB_FLASH_IST_RDID          */
+    #define SFCB_FLASH_TOPO_RD_FAST_DUMMY   0       /**<  Topology dummy bytes of fast, dual and quad output read       */
+    #define SFCB_FLASH_TOPO_RD_QIO_DUMMY    0       /**<  Topology mode and dummy bytes of quad I/O read                */
     #define SFCB_FLASH_MNG_WIP_MSK          0x0     /**<  MGMT: write-in-progress                                       */
     #define SFCB_FLASH_MNG_WRENA_MSK        0x0     /**<  MGMT: write enable                                            */
+    #define SFCB_FLASH_MNG_RDSR_CONT        0       /**<  MGMT: status register continuous read, zero if not supported  */
+    #define SFCB_FLASH_TIME_PAGE_PROG       0       /**<  Timing: typ. page program in us                               */
+    #define SFCB_FLASH_TIME_ERASE_SECTOR    0       /**<  Timing: typ. sector erase in us                               */
+    #define SFCB_FLASH_TIME_ERASE_BLK32     0       /**<  Timing: typ. 32KB block erase in us                           */
+    #define SFCB_FLASH_TIME_ERASE_BLK64     0       /**<  Timing: typ. 64KB block erase in us                           */
 
 #endif
 /** @} */
 
+
+
+/**
+ *  @brief Flash Descriptor
+ *
+ *  Initializer of #t_sfcb_flash with the compile-time selected flash
+ *
+ *  @since  2026-10-14
+ */
+#define SFCB_FLASH_DESC { \
+    .charName               = SFCB_FLASH_NAME, \
+    .uint8IstWrEna          = SFCB_FLASH_IST_WR_ENA, \
+    .uint8IstEraseSector    = SFCB_FLASH_IST_ERASE_SECTOR, \
+    .uint8IstEraseBlk32     = SFCB_FLASH_IST_ERASE_BLK32, \
+    .uint8IstEraseBlk64     = SFCB_FLASH_IST_ERASE_BLK64, \
+    .uint8IstEraseSuspend   = SFCB_FLASH_IST_ERASE_SUSPEND, \
+    .uint8IstEraseResume    = SFCB_FLASH_IST_ERASE_RESUME, \
+    .uint8IstRdStateReg     = SFCB_FLASH_IST_RD_STATE_REG, \
+    .uint8IstRdData         = SFCB_FLASH_IST_RD_DATA, \
+    .uint8IstWrPage         = SFCB_FLASH_IST_WR_PAGE, \
+    .uint8IstWrPageQuad     = SFCB_FLASH_IST_WR_PAGE_QUAD, \
+    .uint8IstRdFast         = SFCB_FLASH_IST_RD_FAST, \
+    .uint8IstRdDual         = SFCB_FLASH_IST_RD_DUAL, \
+    .uint8IstRdQuad         = SFCB_FLASH_IST_RD_QUAD, \
+    .uint8IstRdQuadIo       = SFCB_FLASH_IST_RD_QUAD_IO, \
+    .uint8RdFastDummy       = SFCB_FLASH_TOPO_RD_FAST_DUMMY, \
+    .uint8RdQioDummy        = SFCB_FLASH_TOPO_RD_QIO_DUMMY, \
+    .uint8AdrByte           = SFCB_FLASH_TOPO_ADR_BYTE, \
+    .uint8WipMsk            = SFCB_FLASH_MNG_WIP_MSK, \
+    .uint8RdsrCont          = SFCB_FLASH_MNG_RDSR_CONT, \
+    .uint16PageSize         = SFCB_FLASH_TOPO_PAGE_SIZE, \
+    .uint32SectorSize       = SFCB_FLASH_TOPO_SECTOR_SIZE, \
+    .uint32Blk32Size        = SFCB_FLASH_TOPO_BLK32_SIZE, \
+    .uint32Blk64Size        = SFCB_FLASH_TOPO_BLK64_SIZE, \
+    .uint32FlashSize        = SFCB_FLASH_TOPO_FLASH_SIZE, \
+    .uint32TimePageProg     = SFCB_FLASH_TIME_PAGE_PROG, \
+    .uint32TimeEraseSector  = SFCB_FLASH_TIME_ERASE_SECTOR, \
+    .uint32TimeEraseBlk32   = SFCB_FLASH_TIME_ERASE_BLK32, \
+    .uint32TimeEraseBlk64   = SFCB_FLASH_TIME_ERASE_BLK64 \
+}
+
 #endif // __SFCB_FLASH_TYPES_H
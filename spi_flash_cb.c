@@ -46,6 +46,46 @@
 
 
 
+/**
+ *  @defgroup SFCB_LOG_LEVEL
+ *
+ *  compile-time log level, messages above level are removed by the preprocessor
+ *  together with their arguments. Without level #SFCB_PRINTF_EN selects all messages.
+ *  f. e. -DSFCB_PRINTF_EN -DSFCB_LOG_LEVEL=1 prints only errors
+ *
+ *  @since  2026-10-14
+ *  @{
+ */
+#define SFCB_LOG_OFF    (0)     /**< no messages */
+#define SFCB_LOG_ERO    (1)     /**< error messages */
+#define SFCB_LOG_INFO   (2)     /**< state messages of worker and API */
+#define SFCB_LOG_CALL   (3)     /**< function call messages */
+#ifndef SFCB_LOG_LEVEL
+    #ifdef SFCB_PRINTF_EN
+        #define SFCB_LOG_LEVEL  SFCB_LOG_CALL
+    #else
+        #define SFCB_LOG_LEVEL  SFCB_LOG_OFF
+    #endif
+#endif
+#if SFCB_LOG_LEVEL >= SFCB_LOG_ERO
+    #define sfcb_log_ero(...) sfcb_printf(__VA_ARGS__)
+#else
+    #define sfcb_log_ero(...)
+#endif
+#if SFCB_LOG_LEVEL >= SFCB_LOG_INFO
+    #define sfcb_log_info(...) sfcb_printf(__VA_ARGS__)
+#else
+    #define sfcb_log_info(...)
+#endif
+#if SFCB_LOG_LEVEL >= SFCB_LOG_CALL
+    #define sfcb_log_call(...) sfcb_printf(__VA_ARGS__)
+#else
+    #define sfcb_log_call(...)
+#endif
+/** @} */   // SFCB_LOG_LEVEL
+
+
+
 /**
  *  @defgroup FALL_THROUGH
  *
@@ -67,6 +107,104 @@
 
 
 
+/**
+ *  @defgroup SFCB_FLASH_RT_EN
+ *
+ *  @brief Flash descriptor access
+ *
+ *  With SFCB_FLASH_RT_EN the flash parameters are read from the runtime
+ *  descriptor #t_sfcb::ptrFlash, see #sfcb_init_flash. Otherwise the compile-time
+ *  selected flash of sfcb_flash_types.h is used and folded into constants.
+ *
+ *  @since  2026-10-14
+ *  @{
+ */
+#ifdef SFCB_FLASH_RT_EN
+    #define SFCB_FL_IST_WR_ENA(self)          ((self)->ptrFlash->uint8IstWrEna)
+    #define SFCB_FL_IST_ERASE_SECTOR(self)    ((self)->ptrFlash->uint8IstEraseSector)
+    #define SFCB_FL_IST_ERASE_BLK32(self)     ((self)->ptrFlash->uint8IstEraseBlk32)
+    #define SFCB_FL_IST_ERASE_BLK64(self)     ((self)->ptrFlash->uint8IstEraseBlk64)
+    #define SFCB_FL_IST_ERASE_SUSPEND(self)   ((self)->ptrFlash->uint8IstEraseSuspend)
+    #define SFCB_FL_IST_ERASE_RESUME(self)    ((self)->ptrFlash->uint8IstEraseResume)
+    #define SFCB_FL_IST_RD_STATE_REG(self)    ((self)->ptrFlash->uint8IstRdStateReg)
+    #define SFCB_FL_IST_RD_DATA(self)         ((self)->ptrFlash->uint8IstRdData)
+    #define SFCB_FL_IST_WR_PAGE(self)         ((self)->ptrFlash->uint8IstWrPage)
+    #define SFCB_FL_IST_WR_PAGE_QUAD(self)    ((self)->ptrFlash->uint8IstWrPageQuad)
+    #define SFCB_FL_IST_RD_FAST(self)         ((self)->ptrFlash->uint8IstRdFast)
+    #define SFCB_FL_IST_RD_DUAL(self)         ((self)->ptrFlash->uint8IstRdDual)
+    #define SFCB_FL_IST_RD_QUAD(self)         ((self)->ptrFlash->uint8IstRdQuad)
+    #define SFCB_FL_IST_RD_QUAD_IO(self)      ((self)->ptrFlash->uint8IstRdQuadIo)
+    #define SFCB_FL_TOPO_ADR_BYTE(self)       ((self)->ptrFlash->uint8AdrByte)
+    #define SFCB_FL_TOPO_SECTOR_SIZE(self)    ((self)->ptrFlash->uint32SectorSize)
+    #define SFCB_FL_TOPO_BLK32_SIZE(self)     ((self)->ptrFlash->uint32Blk32Size)
+    #define SFCB_FL_TOPO_BLK64_SIZE(self)     ((self)->ptrFlash->uint32Blk64Size)
+    #define SFCB_FL_TOPO_PAGE_SIZE(self)      ((self)->ptrFlash->uint16PageSize)
+    #define SFCB_FL_TOPO_FLASH_SIZE(self)     ((self)->ptrFlash->uint32FlashSize)
+    #define SFCB_FL_TOPO_RD_FAST_DUMMY(self)  ((self)->ptrFlash->uint8RdFastDummy)
+    #define SFCB_FL_TOPO_RD_QIO_DUMMY(self)   ((self)->ptrFlash->uint8RdQioDummy)
+    #define SFCB_FL_MNG_WIP_MSK(self)         ((self)->ptrFlash->uint8WipMsk)
+    #define SFCB_FL_MNG_RDSR_CONT(self)       ((self)->ptrFlash->uint8RdsrCont)
+    #define SFCB_FL_TIME_PAGE_PROG(self)      ((self)->ptrFlash->uint32TimePageProg)
+    #define SFCB_FL_TIME_ERASE_SECTOR(self)   ((self)->ptrFlash->uint32TimeEraseSector)
+    #define SFCB_FL_TIME_ERASE_BLK32(self)    ((self)->ptrFlash->uint32TimeEraseBlk32)
+    #define SFCB_FL_TIME_ERASE_BLK64(self)    ((self)->ptrFlash->uint32TimeEraseBlk64)
+#else
+    #define SFCB_FL_IST_WR_ENA(self)          (SFCB_FLASH_IST_WR_ENA)
+    #define SFCB_FL_IST_ERASE_SECTOR(self)    (SFCB_FLASH_IST_ERASE_SECTOR)
+    #define SFCB_FL_IST_ERASE_BLK32(self)     (SFCB_FLASH_IST_ERASE_BLK32)
+    #define SFCB_FL_IST_ERASE_BLK64(self)     (SFCB_FLASH_IST_ERASE_BLK64)
+    #define SFCB_FL_IST_ERASE_SUSPEND(self)   (SFCB_FLASH_IST_ERASE_SUSPEND)
+    #define SFCB_FL_IST_ERASE_RESUME(self)    (SFCB_FLASH_IST_ERASE_RESUME)
+    #define SFCB_FL_IST_RD_STATE_REG(self)    (SFCB_FLASH_IST_RD_STATE_REG)
+    #define SFCB_FL_IST_RD_DATA(self)         (SFCB_FLASH_IST_RD_DATA)
+    #define SFCB_FL_IST_WR_PAGE(self)         (SFCB_FLASH_IST_WR_PAGE)
+    #define SFCB_FL_IST_WR_PAGE_QUAD(self)    (SFCB_FLASH_IST_WR_PAGE_QUAD)
+    #define SFCB_FL_IST_RD_FAST(self)         (SFCB_FLASH_IST_RD_FAST)
+    #define SFCB_FL_IST_RD_DUAL(self)         (SFCB_FLASH_IST_RD_DUAL)
+    #define SFCB_FL_IST_RD_QUAD(self)         (SFCB_FLASH_IST_RD_QUAD)
+    #define SFCB_FL_IST_RD_QUAD_IO(self)      (SFCB_FLASH_IST_RD_QUAD_IO)
+    #define SFCB_FL_TOPO_ADR_BYTE(self)       (SFCB_FLASH_TOPO_ADR_BYTE)
+    #define SFCB_FL_TOPO_SECTOR_SIZE(self)    (SFCB_FLASH_TOPO_SECTOR_SIZE)
+    #define SFCB_FL_TOPO_BLK32_SIZE(self)     (SFCB_FLASH_TOPO_BLK32_SIZE)
+    #define SFCB_FL_TOPO_BLK64_SIZE(self)     (SFCB_FLASH_TOPO_BLK64_SIZE)
+    #define SFCB_FL_TOPO_PAGE_SIZE(self)      (SFCB_FLASH_TOPO_PAGE_SIZE)
+    #define SFCB_FL_TOPO_FLASH_SIZE(self)     (SFCB_FLASH_TOPO_FLASH_SIZE)
+    #define SFCB_FL_TOPO_RD_FAST_DUMMY(self)  (SFCB_FLASH_TOPO_RD_FAST_DUMMY)
+    #define SFCB_FL_TOPO_RD_QIO_DUMMY(self)   (SFCB_FLASH_TOPO_RD_QIO_DUMMY)
+    #define SFCB_FL_MNG_WIP_MSK(self)         (SFCB_FLASH_MNG_WIP_MSK)
+    #define SFCB_FL_MNG_RDSR_CONT(self)       (SFCB_FLASH_MNG_RDSR_CONT)
+    #define SFCB_FL_TIME_PAGE_PROG(self)      (SFCB_FLASH_TIME_PAGE_PROG)
+    #define SFCB_FL_TIME_ERASE_SECTOR(self)   (SFCB_FLASH_TIME_ERASE_SECTOR)
+    #define SFCB_FL_TIME_ERASE_BLK32(self)    (SFCB_FLASH_TIME_ERASE_BLK32)
+    #define SFCB_FL_TIME_ERASE_BLK64(self)    (SFCB_FLASH_TIME_ERASE_BLK64)
+#endif
+/** @} */   // SFCB_FLASH_RT_EN
+
+
+
+/**
+ *  @brief compile-time flash
+ *
+ *  descriptor of flash selected via compile switch, default of #sfcb_init
+ *
+ *  @since  2026-10-14
+ */
+static const t_sfcb_flash g_sfcbFlashDefault = SFCB_FLASH_DESC;
+
+
+
+/**
+ *  @brief single lane transfer
+ *
+ *  transfer mode of all packets without selectable lanes
+ *
+ *  @since  2026-10-14
+ */
+static const t_sfcb_xfer g_sfcbXferSingle = { .uint8AdrLanes = 1, .uint8DataLanes = 1, .uint8Dummy = 0, .uint8DummyClk = 0 };
+
+
+
+
 /**
  *  @defgroup MIN_MAX
  *
@@ -90,6 +228,58 @@
 
 
 
+/**
+ *  @defgroup SFCB_HDR
+ *
+ *  @brief Header state
+ *
+ *  Classification of read element header, see #sfcb_mkcb_hdr_read
+ *
+ *  @since  2026-10-14
+ */
+#define SFCB_HDR_ERO    (-1)    /**< corrupted header, neither valid nor erased */
+#define SFCB_HDR_MTY    (0)     /**< erased header, element slot is free */
+#define SFCB_HDR_USED   (1)     /**< valid header of current queue */
+/** @} */   // SFCB_HDR
+
+
+
+/**
+ *  @defgroup SFCB_SCAN
+ *
+ *  @brief Scan flags
+ *
+ *  Logarithmic queue scan state, stored in #t_sfcb::uint8IterFlg
+ *
+ *  @since  2026-10-14
+ */
+#define SFCB_SCAN_FIRST (1<<0)  /**< first element slot is used */
+#define SFCB_SCAN_LAST  (1<<1)  /**< last element slot is used */
+#define SFCB_SCAN_HIMTY (1<<2)  /**< upper bisect bound is a free element slot */
+#define SFCB_SCAN_MID   (1<<3)  /**< used run between free slots at both ring ends, caused by pre-erase */
+#define SFCB_SCAN_PRVMX (1<<4)  /**< linear scan, previous slot holds highest ID so far */
+/** @} */   // SFCB_SCAN
+
+
+
+/**
+ *  @defgroup SFCB_DEC
+ *
+ *  @brief Record decoder state
+ *
+ *  Parser state of encoded record stream, stored in #t_sfcb::uint8DecSt
+ *
+ *  @since  2026-10-14
+ */
+#define SFCB_DEC_HEAD   (0)     /**< record header expected */
+#define SFCB_DEC_LEN    (1)     /**< code length, varint */
+#define SFCB_DEC_CODE   (2)     /**< collects code bytes */
+#define SFCB_DEC_END    (3)     /**< erased record header, no further records in element */
+#define SFCB_DEC_ERO    (4)     /**< invalid record */
+/** @} */   // SFCB_DEC
+
+
+
 /**
  *  @brief ceildivide
  *
@@ -111,6 +301,339 @@ static uint32_t sfcb_ceildivide_uint32(uint32_t dividend, uint32_t divisor)
 
 
 
+/**
+ *  @brief CRC32
+ *
+ *  calculates CRC-32 (IEEE 802.3, reflected, polynom 0xEDB88320)
+ *  start with crc=0 and use last result for continuation. Backend selected
+ *  by compile switch: SFCB_CRC_EXT calls #sfcb_crc32_ext of the application,
+ *  SFCB_CRC_SLICE8 processes eight bytes per step with 8KB constant table, default
+ *  is a nibble table.
+ *
+ *  @param[in]      crc             CRC of previous data segment, zero for start
+ *  @param[in]      *data           pointer to data segment
+ *  @param[in]      len             number of bytes in *data
+ *  @return         uint32_t        CRC of data segement
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_crc32(uint32_t crc, const void *data, uint32_t len)
+{
+#if defined(SFCB_CRC_EXT)
+    return sfcb_crc32_ext(crc, data, len);
+#elif defined(SFCB_CRC_SLICE8)
+    /** Variables **/
+    static const uint32_t   uint32CrcTbl[8][256] = {    // slice tables, row j is CRC of byte followed by j zero bytes
+        {
+            0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+            0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+            0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+            0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+            0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+            0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+            0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+            0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+            0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+            0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+            0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+            0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+            0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+            0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+            0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+            0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+            0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+            0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+            0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+            0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+            0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+            0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+            0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+            0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+            0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+            0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+            0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+            0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+            0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+            0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+            0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+            0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+        },
+        {
+            0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+            0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+            0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+            0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+            0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+            0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+            0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+            0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+            0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+            0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+            0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+            0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+            0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+            0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+            0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+            0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+            0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+            0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+            0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+            0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+            0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+            0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+            0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+            0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+            0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+            0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+            0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+            0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+            0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+            0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+            0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+            0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72
+        },
+        {
+            0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+            0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+            0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+            0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+            0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+            0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+            0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+            0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+            0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+            0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+            0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+            0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+            0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+            0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+            0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+            0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+            0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+            0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+            0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+            0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+            0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+            0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+            0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+            0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+            0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+            0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+            0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+            0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+            0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+            0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+            0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+            0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed
+        },
+        {
+            0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+            0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+            0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+            0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+            0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+            0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+            0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+            0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+            0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+            0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+            0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+            0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+            0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+            0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+            0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+            0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+            0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+            0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+            0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+            0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+            0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+            0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+            0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+            0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+            0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+            0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+            0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+            0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+            0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+            0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+            0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+            0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1
+        },
+        {
+            0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+            0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+            0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+            0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+            0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+            0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+            0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+            0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+            0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+            0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+            0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+            0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+            0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+            0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+            0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+            0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+            0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+            0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+            0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+            0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+            0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+            0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+            0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+            0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+            0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+            0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+            0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+            0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+            0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+            0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+            0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+            0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c
+        },
+        {
+            0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+            0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+            0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+            0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+            0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+            0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+            0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+            0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+            0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+            0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+            0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+            0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+            0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+            0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+            0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+            0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+            0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+            0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+            0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+            0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+            0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+            0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+            0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+            0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+            0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+            0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+            0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+            0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+            0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+            0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+            0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+            0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc
+        },
+        {
+            0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+            0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+            0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+            0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+            0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+            0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+            0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+            0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+            0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+            0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+            0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+            0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+            0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+            0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+            0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+            0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+            0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+            0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+            0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+            0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+            0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+            0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+            0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+            0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+            0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+            0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+            0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+            0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+            0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+            0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+            0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+            0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30
+        },
+        {
+            0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+            0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+            0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+            0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+            0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+            0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+            0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+            0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+            0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+            0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+            0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+            0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+            0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+            0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+            0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+            0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+            0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+            0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+            0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+            0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+            0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+            0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+            0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+            0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+            0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+            0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+            0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+            0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+            0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+            0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+            0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+            0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6
+        }
+    };
+    const uint8_t*          uint8PtrData = (const uint8_t*) data;
+    uint32_t                uint32Lo;   // first four bytes of slice
+    uint32_t                uint32Hi;   // last four bytes of slice
+
+    crc = ~crc;
+    /* eight bytes per step, byte order independent */
+    while ( !(len < 8) ) {
+        uint32Lo = crc ^ ((uint32_t) uint8PtrData[0] | ((uint32_t) uint8PtrData[1] << 8) | ((uint32_t) uint8PtrData[2] << 16) | ((uint32_t) uint8PtrData[3] << 24));
+        uint32Hi = (uint32_t) uint8PtrData[4] | ((uint32_t) uint8PtrData[5] << 8) | ((uint32_t) uint8PtrData[6] << 16) | ((uint32_t) uint8PtrData[7] << 24);
+        crc =   uint32CrcTbl[7][uint32Lo & 0xFF] ^ uint32CrcTbl[6][(uint32Lo >> 8) & 0xFF] ^ uint32CrcTbl[5][(uint32Lo >> 16) & 0xFF] ^ uint32CrcTbl[4][uint32Lo >> 24]
+              ^ uint32CrcTbl[3][uint32Hi & 0xFF] ^ uint32CrcTbl[2][(uint32Hi >> 8) & 0xFF] ^ uint32CrcTbl[1][(uint32Hi >> 16) & 0xFF] ^ uint32CrcTbl[0][uint32Hi >> 24];
+        uint8PtrData += 8;
+        len -= 8;
+    }
+    /* remaining bytes */
+    for ( uint32_t i = 0; i < len; i++ ) {
+        crc = (crc >> 8) ^ uint32CrcTbl[0][(crc ^ uint8PtrData[i]) & 0xFF];
+    }
+    return ~crc;
+#else
+    /** Variables **/
+    static const uint32_t   uint32CrcTbl[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+    };
+    const uint8_t*          uint8PtrData = (const uint8_t*) data;
+
+    crc = ~crc;
+    for ( uint32_t i = 0; i < len; i++ ) {
+        crc = (crc >> 4) ^ uint32CrcTbl[(crc ^ uint8PtrData[i]) & 0x0F];
+        crc = (crc >> 4) ^ uint32CrcTbl[(crc ^ (uint32_t) (uint8PtrData[i] >> 4)) & 0x0F];
+    }
+    return ~crc;
+#endif
+}
+
+
+
 /**
  *  @brief address translation
  *
@@ -148,13 +671,37 @@ static void sfcb_adr32_uint8(uint32_t adr, uint8_t *spi, uint8_t adrBytes)
  */
 static int sfcb_wip_poll(t_sfcb *self)
 {
-    if ( (0 == self->uint16SpiLen) || (0 != (self->uint8PtrSpi[1] & SFCB_FLASH_MNG_WIP_MSK)) ) {
+    /** Variables **/
+    uint8_t uint8Sts = SFCB_FL_MNG_WIP_MSK(self);  // first request
+
+    /* last byte of continuous status register read */
+    if ( 1 < self->uint16SpiLen ) {
+        uint8Sts = self->uint8PtrSpi[self->uint16SpiLen - 1];
+    }
+    if ( 0 != (uint8Sts & SFCB_FL_MNG_WIP_MSK(self)) ) {
+        /* still busy, next poll not before poll interval */
+        if ( (1 < self->uint16SpiLen) && (NULL != self->ptrTick) && (0 != self->uint32WipUs) && (0 != self->uint32WipPollUs) ) {
+            self->uint32WipTick = self->ptrTick() + sfcb_ceildivide_uint32(self->uint32WipPollUs, self->uint32TickUs);
+            self->uint16SpiLen = 0;
+            return -1;
+        }
+        /* expected completion or next poll not reached, no SPI transfer */
+        if ( (NULL != self->ptrTick) && (0 != self->uint32WipUs) && (0 < (int32_t) (self->uint32WipTick - self->ptrTick())) ) {
+            self->uint16SpiLen = 0;
+            return -1;
+        }
         /* First Request or WIP */
-        self->uint8PtrSpi[0] = SFCB_FLASH_IST_RD_STATE_REG;
-        self->uint8PtrSpi[1] = 0;
-        self->uint16SpiLen = 2;
+        self->uint8PtrSpi[0] = SFCB_FL_IST_RD_STATE_REG(self);
+        memset(self->uint8PtrSpi+1, 0, self->uint16WipLen);
+        self->uint16SpiLen = (uint16_t) (self->uint16WipLen + 1);
         return -1;
     }
+    /* pending operation done */
+    self->uint32WipUs = 0;
+    /* background erase done */
+    if ( 0 == self->uint8EraseSus ) {
+        self->uint8EraseAct = 0;
+    }
     self->uint16SpiLen = 0;
     return 0;
 }
@@ -162,252 +709,3772 @@ static int sfcb_wip_poll(t_sfcb *self)
 
 
 /**
- *  sfcb_init
- *    initializes handle
+ *  @brief WIP set
+ *
+ *  records the typical duration of the just requested page program or sector erase
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      us                  typical duration in us
+ *  @return         void
+ *  @since          2026-10-14
  */
-int sfcb_init (t_sfcb *self, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen)
+static void sfcb_wip_set(t_sfcb *self, uint32_t us)
 {
-    /* Function call message */
-    sfcb_printf("__FUNCTION__ = %s\n", __FUNCTION__);
-    /* check if provided flash type is valid */
-    if ( 0 == (sizeof(SFCB_FLASH_NAME) - 1) ) {
-        sfcb_printf("  ERROR:%s: no flash type selected\n", __FUNCTION__);
-        return SFCB_E_NO_FLASH; // no flash type selected, use proper compile switch
+    self->uint32WipUs = us;
+    if ( NULL != self->ptrTick ) {
+        self->uint32WipTick = self->ptrTick() + (us + self->uint32TickUs - 1) / self->uint32TickUs;
     }
-    sfcb_printf("  INFO:%s: flash '%s' selected\n", __FUNCTION__, SFCB_FLASH_NAME);
-    /* set up list of flash circular buffers */
-    self->uint8NumCbs = cbLen;
-    self->uint16SpiLen = 0;
-    self->uint8Busy = 0;
-    self->cmd = SFCB_CMD_IDLE;  // free for request
-    self->stage = SFCB_STG00;
-    self->ptrCbs = (t_sfcb_cb*) cb;     // circular buffer element array
-    self->uint8PtrSpi = (uint8_t*) spi; // uint8 array
-    self->uint16SpiMax = spiLen;        // max array length
-    self->error = SFCB_E_NOERO;
-    self->ptrCbElemPl = NULL;
-    self->uint16CbElemPlSize = 0;
-    /* memory addresses */
-    sfcb_printf("  INFO:%s:sfcb:spi_p            = %p\n", __FUNCTION__, self->uint8PtrSpi); // spi buffer
-    /* SPI buffer needs at least space for one page and address and instruction */
-    if ( (SFCB_FLASH_TOPO_PAGE_SIZE + SFCB_FLASH_TOPO_ADR_BYTE + 1) > self->uint16SpiMax ) {
-        sfcb_printf("  ERROR:%s: spi buffer to small, is=%d byte, req=%d byte\n", __FUNCTION__, self->uint16SpiMax, SFCB_FLASH_TOPO_PAGE_SIZE + SFCB_FLASH_TOPO_ADR_BYTE + 1);
-        return SFCB_E_MEM;  // not enough SPI buffer to write at least one complete page to flash
+}
+
+
+/**
+ *  @brief WIP poll with erase suspend
+ *
+ *  checks write-in-progress like #sfcb_wip_poll, but suspends a background
+ *  sector erase. Used by read commands, the erase is resumed with
+ *  the end of the job.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 WIP state
+ *  @retval         0                   flash ready for read
+ *  @retval         -1                  SPI transfer of status register read or suspend is required
+ *  @since          2026-10-14
+ */
+static int sfcb_wip_poll_sus(t_sfcb *self)
+{
+    /* suspend background erase */
+    if ( (0 != SFCB_FL_IST_ERASE_SUSPEND(self)) && (0 != self->uint8EraseAct) && (0 == self->uint8EraseSus) ) {
+        self->uint32WipUs = 0;  // read does not wait for erase completion
     }
-    /* init circular buffer handles */
-    for ( uint8_t i = 0; i < (self->uint8NumCbs); i++ ) {
-        (self->ptrCbs[i]).uint8Used = 0;
-        (self->ptrCbs[i]).uint8MgmtValid = 0;
-        sfcb_printf("  INFO:%s:ptrCbs[%i]_p           = %p\n", __FUNCTION__, i, (&self->ptrCbs[i]));                    // unit test output
-        sfcb_printf("  INFO:%s:ptrCbs[%i].uint8Used_p = %p\n", __FUNCTION__, i, &((self->ptrCbs[i]).uint8Used));        // output address
-        sfcb_printf("  INFO:%s:ptrCbs[%i].uint8Init_p = %p\n", __FUNCTION__, i, &((self->ptrCbs[i]).uint8MgmtValid));   // output address
+    if (    (0 != SFCB_FL_IST_ERASE_SUSPEND(self))
+         && (0 != self->uint8EraseAct)
+         && (0 == self->uint8EraseSus)
+         && (1 < self->uint16SpiLen)
+         && (0 != (self->uint8PtrSpi[self->uint16SpiLen - 1] & SFCB_FL_MNG_WIP_MSK(self)))
+    ) {
+        self->uint8PtrSpi[0] = SFCB_FL_IST_ERASE_SUSPEND(self);
+        self->uint16SpiLen = 1; // forces status register read after suspend
+        self->uint8EraseSus = 1;
+        return -1;
     }
-    /* normal end */
+    return sfcb_wip_poll(self);
+}
+
+
+
+/**
+ *  @brief job set
+ *
+ *  stores request with arguments in job
+ *
+ *  @param[out]     job                 job, #t_sfcb_job
+ *  @param[in]      api                 requested function, #t_sfcb_api
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      adr                 flash address
+ *  @param[in]      data                data buffer
+ *  @param[in]      len                 number of bytes in data
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_job_set(t_sfcb_job *job, t_sfcb_api api, uint8_t cbID, uint32_t adr, void *data, uint32_t len)
+{
+    job->api = api;
+    job->uint8Cb = cbID;
+    job->uint32Adr = adr;
+    job->ptrData = data;
+    job->uint32Len = len;
+    job->ptrIter = NULL;
+}
+
+
+
+/**
+ *  @brief job wait
+ *
+ *  checks if a request needs to wait in the job queue. Requests waits
+ *  while the worker is busy or older requests are queued.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 wait state
+ *  @retval         0                   request can start
+ *  @retval         1                   request needs to wait
+ *  @since          2026-10-14
+ */
+static int sfcb_job_wait(t_sfcb *self)
+{
+    if ( (0 != self->uint8Busy) || ((0 != self->uint8JobCnt) && (0 == self->uint8JobPop)) ) {
+        return 1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief job post
+ *
+ *  appends request to job queue
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      api                 requested function, #t_sfcb_api
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      adr                 flash address
+ *  @param[in]      data                data buffer
+ *  @param[in]      len                 number of bytes in data
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            request queued
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy and job queue full or not present
+ *  @since          2026-10-14
+ */
+static int sfcb_job_post(t_sfcb *self, t_sfcb_api api, uint8_t cbID, uint32_t adr, void *data, uint32_t len)
+{
+    /* no space left */
+    if ( (NULL == self->ptrJobs) || !(self->uint8JobCnt < self->uint8JobMax) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;  // Worker is busy, wait for processing last job
+    }
+    /* queue request */
+    sfcb_job_set(&(self->ptrJobs[(self->uint8JobRd + self->uint8JobCnt) % self->uint8JobMax]), api, cbID, adr, data, len);
+    (self->uint8JobCnt)++;
+    sfcb_log_info("  INFO:%s: api=%d queued, jobs=%d\n", __FUNCTION__, api, self->uint8JobCnt);
     return SFCB_OK;
 }
 
 
 
 /**
- *  spi_flash_cb_worker
- *    executes request from ...
+ *  @brief job start
+ *
+ *  starts queued request
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      job                 job, #t_sfcb_job
+ *  @return         int                 return code of requested function
+ *  @since          2026-10-14
  */
-void sfcb_worker (t_sfcb *self)
+static int sfcb_job_start(t_sfcb *self, t_sfcb_job *job)
+{
+    switch (job->api) {
+        case SFCB_API_MKCB:
+            return sfcb_mkcb(self);
+        case SFCB_API_ADD:
+            return sfcb_add(self, job->uint8Cb, job->ptrData, (uint16_t) job->uint32Len);
+        case SFCB_API_ADD_DONE:
+            return sfcb_add_done(self, job->uint8Cb);
+        case SFCB_API_GET_LAST:
+            return sfcb_get_last(self, job->uint8Cb, job->ptrData, (uint16_t) job->uint32Len);
+        case SFCB_API_FLASH_READ:
+            return sfcb_flash_read(self, job->uint32Adr, job->ptrData, job->uint32Len);
+        case SFCB_API_CKPT:
+            return sfcb_ckpt(self);
+        case SFCB_API_ITER:
+            return sfcb_iter(self, job->uint8Cb, job->uint32Adr, job->uint32Len, job->ptrIter, job->ptrData);
+        case SFCB_API_ADD_BATCH:
+            return sfcb_add_batch(self, job->uint8Cb, job->ptrData, (uint16_t) job->uint32Len, (uint16_t) job->uint32Adr);
+        case SFCB_API_ADD_REC:
+            return sfcb_add_rec(self, job->uint8Cb, job->ptrData);
+        default:
+            break;
+    }
+    return SFCB_OK;
+}
+
+
+
+#ifdef SFCB_RING_EN
+/**
+ *  @brief ring slot
+ *
+ *  slot of ring position
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      pos                 ring position
+ *  @return         t_sfcb_ring_slot*   slot header, record follows
+ *  @since          2026-10-14
+ */
+static t_sfcb_ring_slot* sfcb_ring_slot(t_sfcb *self, uint32_t pos)
+{
+    return (t_sfcb_ring_slot*) ((void*) (self->ptrRing + (pos & (self->uint32RingNum - 1)) * self->uint32RingStride));
+}
+
+
+
+/**
+ *  @brief ring record fit
+ *
+ *  checks if the record fits behind the open element payload, staged bytes
+ *  included. Without open element every record up to the payload size fits.
+ *
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @param[in]      len                 record size in bytes
+ *  @return         int                 state
+ *  @retval         1                   record fits, or no open element
+ *  @retval         0                   open element needs to be closed
+ *  @since          2026-10-14
+ */
+static int sfcb_ring_fit(const t_sfcb_cb *cb, uint16_t len)
 {
     /** Variables **/
-    uint8_t                 uint8Good;              // check was good
-    uint16_t                uint16PagesBytesAvail;  // number of used page bytes
-    uint16_t                uint16CpyLen;           // number of Bytes to copy
-    uint32_t                uint32Temp;             // temporaray 32bit variable
-    spi_flash_cb_elem_head  writeHead;              // header/footer written to flash
-    spi_flash_cb_elem_head  readHead;               // header readen from flash
+    uint32_t    uint32Used; // written and staged bytes of open element, header included
 
-    /* Function call message */
-    sfcb_printf("__FUNCTION__ = %s\n", __FUNCTION__);
-    sfcb_printf("  INFO:%s:sfcb_p            = %p\n", __FUNCTION__, self);
-    sfcb_printf("  INFO:%s:sfcb:spi_p        = %p\n", __FUNCTION__, self->uint8PtrSpi); // spi buffer
-    /* select part of FSM */
-    switch (self->cmd) {
-        /*
-         *
-         * nothing todo
-         *
-         */
-        case SFCB_CMD_IDLE:
-            sfcb_printf("  INFO:%s:IDLE\n", __FUNCTION__);
-            return;
-        /*
-         *
-         * Allocate Next Free Element for Circular Buffers
-         *
-         */
-        case SFCB_CMD_MKCB:
-            /* select excution state, allows break & cont */
-            switch (self->stage) {
-                /* check for WIP */
-                case SFCB_STG00:
-                    /* Debug message */
-                    sfcb_printf (  "  INFO:%s:MKCB:STG0:check for WIP, uint16SpiLen=%d, uint8PtrSpi[1]=0x%02x\n",
-                                   __FUNCTION__,
-                                   self->uint16SpiLen,
-                                   self->uint8PtrSpi[1]
-                                );
-                    /* WIP Check */
-                    if ( 0 != sfcb_wip_poll(self) ) return;
-                    /* free for new request */
-                    self->stage = SFCB_STG01;   // Go one with search for Free Segment
-                    FALL_THROUGH;   // Go one with next
-                /* Find Page for next Circulat buffer element */
-                case SFCB_STG01:
-                    /* Debug message */
-                    sfcb_printf("  INFO:%s:MKCB:STG1: find empty page for new element\n", __FUNCTION__);
-                    /* check last response */
-                    if ( 0 != self->uint16SpiLen ) {
-                        /* Debug Message */
-                        sfcb_printf("  INFO:%s:MKCB:STG1: SPI ", __FUNCTION__);
-                        for ( uint8_t i = 0; i < (uint8_t) (sizeof(spi_flash_cb_elem_head) + SFCB_FLASH_TOPO_ADR_BYTE + 1); i++ ) { // +1: SPI Flash IST
-                            sfcb_printf("0x%x ", self->uint8PtrSpi[i]);
-                        }
-                        sfcb_printf("\n");
-                        /* copy head from SPI packet*/
-                        memcpy(&readHead, self->uint8PtrSpi+SFCB_FLASH_TOPO_ADR_BYTE+1, sizeof(readHead));  // ensure alignment to processor architecture
-                        sfcb_printf("  INFO:%s:MKCB:STG1: RDHEAD,magicnum=0x%x\n", __FUNCTION__, readHead.uint32MagicNum);
-                        /* Flash Area is used by circular buffer, check magic number
-                         *   +4: Read instruction + 32bit address
-                         */
-                        if ( readHead.uint32MagicNum == ((self->ptrCbs)[self->uint8IterCb]).uint32MagicNum ) {
-                            /* Debug Message */
-                            sfcb_printf("  INFO:%s:MKCB:STG1: Valid Entry Found\n", __FUNCTION__);
-                            /* count available elements */
-                            (((self->ptrCbs)[self->uint8IterCb]).uint16NumEntries)++;
-                            /* get highest number of numbered circular buffer elements, needed for next entry */
-                            if ( readHead.uint32IdNum > ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax ) {
-                                /* save new highest number in circular buffer */
-                                ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax = readHead.uint32IdNum;
-                                ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMax = self->uint32IterAdr; // needed by sfcb_get_last
-                            }
-                            /* get lowest number of circular buffer, needed for erase sector, and start get function */
-                            if ( readHead.uint32IdNum < ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin ) {
-                                ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin = readHead.uint32IdNum;
-                                ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMin = self->uint32IterAdr; // needed by Sector-Erase
-                            }
-                        } else {
-                            /* check for unused header
-                             * first unused pages is alocated, iterate over all elements to get all IDs
-                             */
-                            if ( 0 == ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid ) {
-                                uint8Good = 1;
-                                for ( uint8_t i = SFCB_FLASH_TOPO_ADR_BYTE + 1; i < SFCB_FLASH_TOPO_ADR_BYTE + 1 + sizeof(spi_flash_cb_elem_head); i++ ) {  // +1: IST
-                                    /* corrupted empty page found, leave as it is */
-                                    if ( 0xFF != self->uint8PtrSpi[i] ) {
-                                        uint8Good = 0;  // try to find next free clean page
-                                        sfcb_printf ("  ERROR:%s:MKCB:STG1: corrupted empty page found at 0x%0x\n", __FUNCTION__, self->uint32IterAdr);
-                                        break;
-                                    }
-                                }
-                                /* save page number for next circular buffer entry */
-                                if ( 0 != uint8Good ) {
-                                    ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite = self->uint32IterAdr;
-                                    ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid = 1; // prepared for writing next element
-                                }
-                            }
-                        }
-                    }
-                    /* Current Status Message */
-                    sfcb_printf ( "  INFO:%s:MKCB:STG1: cb=%d, elem=%d, flashadr=0x%x, idmin=0x%x, idmax=0x%x\n",
-                                  __FUNCTION__,
-                                  self->uint8IterCb,
-                                  self->uint16Iter,
-                                  self->uint32IterAdr,
-                                  ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin,
-                                  ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax
-                                );
-                    /* request next header of circular buffer */
-                    self->uint32IterAdr =   ((self->ptrCbs)[self->uint8IterCb]).uint32StartSector * (uint32_t) SFCB_FLASH_TOPO_SECTOR_SIZE
-                                            +
-                                            ((self->ptrCbs)[self->uint8IterCb]).uint16NumPagesPerElem *
-                                            (uint32_t) SFCB_FLASH_TOPO_PAGE_SIZE *
-                                            self->uint16Iter;
-                    self->uint16SpiLen = SFCB_FLASH_TOPO_ADR_BYTE + 1 + sizeof(spi_flash_cb_elem_head); // +1: IST, + Address bytes
-                    memset(self->uint8PtrSpi, 0, self->uint16SpiLen);
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_RD_DATA;
-                    sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+1, SFCB_FLASH_TOPO_ADR_BYTE);   // +1 first byte is instruction
-                    /* prepare iterator for next */
-                    if ( self->uint16Iter < ((self->ptrCbs)[self->uint8IterCb]).uint16NumEntriesMax ) {
-                        /* next element in current queue */
-                        (self->uint16Iter)++;
-                    } else {
-                        /* Free Page Found */
-                        if ( 0 != ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid) {
-                            /* prepare for next queue */
-                            self->uint16Iter = 0;   // reset element counter
-                            (self->uint8IterCb)++;      // process next queue
-                            /* look ahead if service of some queue can skipped */
-                            for ( uint8_t i=self->uint8IterCb; i<self->uint8NumCbs; i++ ) {
-                                /* all active circular buffer queues processed? */
-                                if ( 0 == ((self->ptrCbs)[i]).uint8Used ) {
-                                    self->uint16SpiLen = 0;
-                                    self->cmd = SFCB_CMD_IDLE;
-                                    self->stage = SFCB_STG00;
-                                    self->uint8Busy = 0;
-                                    return;
-                                /* active queue found */
-                                } else {
-                                    if ( 0 == ((self->ptrCbs)[i]).uint8MgmtValid ) {
-                                        self->uint8IterCb = i;  // search for unintializied queue, in case of only on circular buffer needes to rebuild
-                                        break;
-                                    }
-                                }
-                            }
-                            /* all available queues processed, go in idle */
-                            if ( !(self->uint8IterCb < self->uint8NumCbs) ) {
-                                self->uint16SpiLen = 0;
-                                self->cmd = SFCB_CMD_IDLE;
-                                self->stage = SFCB_STG00;
-                                self->uint8Busy = 0;
-                                return;
-                            }
-                        /* Go on with sector erase */
-                        } else {
-                            self->uint8PtrSpi[0] = SFCB_FLASH_IST_WR_ENA;   // enable write
-                            self->uint16SpiLen = 1;
-                            self->stage = SFCB_STG02;
-                        }
-                    }
-                    return; // DONE or SPI transfer is required
-                    break;
-                /* Assemble Command for Sector ERASE */
-                case SFCB_STG02:
-                    sfcb_printf( "  INFO:%s:MKCB:STG2: Assemble Command for Sector ERASE\n", __FUNCTION__);
-                    sfcb_printf( "  INFO:%s:MKCB:STG2: cb=%d, uint32StartPageIdMin=0x%x\n",
-                                 __FUNCTION__,
-                                 self->uint8IterCb,
-                                 ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMin
-                                );
-                    uint32Temp = (self->ptrCbs[self->uint8IterCb]).uint32StartPageIdMin;        // get startpage of oldest entry, prepare for delete
-                    uint32Temp = (uint32Temp & (uint32_t) ~(SFCB_FLASH_TOPO_SECTOR_SIZE - 1));  // align to sub sector address
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_ERASE_SECTOR;
-                    sfcb_adr32_uint8(uint32Temp, self->uint8PtrSpi+1, SFCB_FLASH_TOPO_ADR_BYTE);    // +1 first byte is instruction
-                    self->uint16SpiLen = SFCB_FLASH_TOPO_ADR_BYTE + 1;  // address + instruction
-                    self->stage = SFCB_STG03;
-                    return; // DONE or SPI transfer is required
-                    break;
-                /* Wait for Sector Erase */
-                case SFCB_STG03:
-                    sfcb_printf("  INFO:%s:MKCB:STG3: Wait for Sector Erase\n", __FUNCTION__);
-                    /* Start at zero Element with search for free page */
-                    self->uint16Iter = 0;
-                    /* Assemble command for WIP */
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_RD_STATE_REG;
-                    self->uint8PtrSpi[1] = 0;
-                    self->uint16SpiLen = 2;
-                    self->stage = SFCB_STG00;   // wait for erase, and search for free page for next element
-                    return; // DONE or SPI transfer is required
-                    break;
-                /* something strange happend */
-                default:
-                    sfcb_printf("  ERROR:%s:MKCB: unexpected use of default path\n", __FUNCTION__);
-                    self->error = SFCB_E_UNKBEH;
+    if ( (0 == cb->uint16PlFlashOfs) && (0 == cb->uint16StageLen) ) {
+        return 1;
+    }
+    uint32Used = cb->uint16StageLen + ((0 != cb->uint16PlFlashOfs) ? cb->uint16PlFlashOfs : (uint32_t) sizeof(spi_flash_cb_elem_head));
+    return ((uint32_t) len + uint32Used) <= (cb->uint16PlSize + sizeof(spi_flash_cb_elem_head));
+}
+#endif
+
+
+
+/**
+ *  @brief ring reset
+ *
+ *  disables the record ring
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_ring_rst(t_sfcb *self)
+{
+    self->ptrRing = NULL;
+    self->uint32RingNum = 0;
+    self->uint32RingStride = 0;
+    self->uint16RingRec = 0;
+    self->uint8RingAct = 0;
+    self->uint32RingHead = 0;
+    self->uint32RingTail = 0;
+    self->uint32RingDrop = 0;
+}
+
+
+
+/**
+ *  @brief ring ready
+ *
+ *  checks for a record waiting in the record ring
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         1                   record waits for the worker
+ *  @retval         0                   ring empty or disabled
+ *  @since          2026-10-14
+ */
+static int sfcb_ring_rdy(t_sfcb *self)
+{
+#ifdef SFCB_RING_EN
+    return (NULL != self->ptrRing) && ((self->uint32RingTail + 1) == __atomic_load_n(&(sfcb_ring_slot(self, self->uint32RingTail)->uint32Seq), __ATOMIC_ACQUIRE));
+#else
+    (void) self;    // ring disabled
+    return 0;
+#endif
+}
+
+
+
+/**
+ *  @brief ring select
+ *
+ *  releases the slot of the stored record and starts storing of the next
+ *  record in the record ring. Records are only taken if the worker is idle
+ *  and no job is queued. Rejected records are dropped and reported.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   record store started
+ *  @retval         -1                  nothing to do
+ *  @since          2026-10-14
+ */
+static int sfcb_ring_sel(t_sfcb *self)
+{
+#ifdef SFCB_RING_EN
+    /** Variables **/
+    t_sfcb_ring_slot*   slot;   // tail slot
+    t_sfcb_cb*          cb;     // queue of record
+    t_sfcb_job          job;    // rejected record
+    int                 intRet; // store state
+
+    while ( (NULL != self->ptrRing) && (0 == self->uint8Busy) && (0 == self->uint8JobCnt) ) {
+        slot = sfcb_ring_slot(self, self->uint32RingTail);
+        /* record stored, release slot for producers */
+        if ( 0 != self->uint8RingAct ) {
+            self->uint8RingAct = 0;
+            __atomic_store_n(&(slot->uint32Seq), self->uint32RingTail + self->uint32RingNum, __ATOMIC_RELEASE);
+            (self->uint32RingTail)++;
+            continue;
+        }
+        /* record ready? */
+        if ( (self->uint32RingTail + 1) != __atomic_load_n(&(slot->uint32Seq), __ATOMIC_ACQUIRE) ) {
+            return -1;
+        }
+        self->uint8RingAct = 1;
+        intRet = SFCB_E_NO_CB_Q;
+        if ( slot->uint8Cb < self->uint8NumCbs ) {
+            cb = &(self->ptrCbs[slot->uint8Cb]);
+            /* packed queue, record size fixed */
+            if ( 0 != cb->uint16RecSize ) {
+                intRet = (slot->uint16Len == cb->uint16RecSize) ? sfcb_add_rec(self, slot->uint8Cb, slot + 1) : SFCB_E_MEM;
+            /* record does not fit into open element payload, close element and retry */
+            } else if ( (NULL == cb->ptrCodec) && (0 == sfcb_ring_fit(cb, slot->uint16Len)) ) {
+                self->uint8RingAct = 0;
+                intRet = sfcb_add_done(self, slot->uint8Cb);
+                if ( SFCB_OK == intRet ) {
+                    continue;
+                }
+                self->uint8RingAct = 1;
+            /* records are not split across elements */
+            } else if ( (NULL == cb->ptrCodec) && (slot->uint16Len > cb->uint16PlSize) ) {
+                intRet = SFCB_E_MEM;
+            } else {
+                intRet = sfcb_add(self, slot->uint8Cb, slot + 1, slot->uint16Len);
+            }
+        }
+        /* record rejected */
+        if ( SFCB_OK != intRet ) {
+            sfcb_log_ero("  ERROR:%s: ring record of queue %d dropped, ret=%d\n", __FUNCTION__, slot->uint8Cb, intRet);
+            (self->uint32RingDrop)++;
+            if ( NULL != self->ptrJobDone ) {
+                sfcb_job_set(&job, SFCB_API_ADD, slot->uint8Cb, 0, slot + 1, slot->uint16Len);
+                self->ptrJobDone(self->ptrJobDoneArg, &job, intRet);
+            }
+        }
+    }
+    return (0 != self->uint8Busy) ? 0 : -1;
+#else
+    (void) self;    // ring disabled
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  @brief job done
+ *
+ *  updates the codec reference of a written record, reports finished job
+ *  and starts next queued job
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_job_done(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_job  job;    // finished or started job
+    int         intRet; // job state
+
+    /* report finished job */
+    if ( SFCB_API_NONE != self->jobAct.api ) {
+        job = self->jobAct;
+        /* record codec, written record is reference of next record */
+        if (    (SFCB_API_ADD == job.api) && (SFCB_E_NOERO == self->error)
+             && (NULL != ((self->ptrCbs)[job.uint8Cb]).ptrCodec) && (job.uint32Len == ((self->ptrCbs)[job.uint8Cb]).uint16CodecRec)
+        ) {
+            memcpy(((self->ptrCbs)[job.uint8Cb]).ptrCodecBuf, job.ptrData, job.uint32Len);
+        }
+        self->jobAct.api = SFCB_API_NONE;
+        intRet = (SFCB_E_NOERO == self->error) ? SFCB_OK : SFCB_E_WKR_ERO;
+        if ( NULL != self->ptrJobDone ) {
+            self->ptrJobDone(self->ptrJobDoneArg, &job, intRet);
+        }
+    }
+    /* start next queued job */
+    while ( (0 == self->uint8Busy) && (0 != self->uint8JobCnt) ) {
+        job = self->ptrJobs[self->uint8JobRd];
+        self->uint8JobRd = (uint8_t) ((self->uint8JobRd + 1) % self->uint8JobMax);
+        (self->uint8JobCnt)--;
+        self->uint8JobPop = 1;
+        intRet = sfcb_job_start(self, &job);
+        self->uint8JobPop = 0;
+        /* request rejected, report and go on with next */
+        if ( SFCB_OK != intRet ) {
+            sfcb_log_ero("  ERROR:%s: queued api=%d rejected, ret=%d\n", __FUNCTION__, job.api, intRet);
+            if ( NULL != self->ptrJobDone ) {
+                self->ptrJobDone(self->ptrJobDoneArg, &job, intRet);
+            }
+        /* nothing to do, f. e. footer merged with payload */
+        } else if ( (0 == self->uint8Busy) && (NULL != self->ptrJobDone) ) {
+            self->ptrJobDone(self->ptrJobDoneArg, &job, intRet);
+        }
+    }
+    /* next record of record ring */
+    (void) sfcb_ring_sel(self);
+}
+
+
+
+/**
+ *  @brief stats worker call
+ *
+ *  counts worker call, the first call of the busy worker starts the job
+ *  measurement. Called before the worker FSM.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_stats_call(t_sfcb *self)
+{
+#ifdef SFCB_STATS_EN
+    /** Variables **/
+    t_sfcb_stats*   stats = self->ptrStats; // performance counters
+
+    if ( NULL == stats ) {
+        return;
+    }
+    (stats->uint32WorkerCalls)++;
+    /* job start */
+    if ( (SFCB_CMD_IDLE == stats->uint8JobCmd) && (0 != self->uint8Busy) && (SFCB_CMD_IDLE != self->cmd) ) {
+        stats->uint8JobCmd = (uint8_t) self->cmd;
+        stats->uint32JobTick = (NULL == self->ptrTick) ? 0 : self->ptrTick();
+        stats->uint32JobCall = 0;
+    }
+    if ( SFCB_CMD_IDLE != stats->uint8JobCmd ) {
+        (stats->uint32JobCall)++;
+    }
+#else
+    (void) self;    // stats disabled
+#endif
+}
+
+
+
+/**
+ *  @brief stats transfer
+ *
+ *  accounts SPI packet of last worker call to the running job
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_stats_rec(t_sfcb *self)
+{
+#ifdef SFCB_STATS_EN
+    /** Variables **/
+    t_sfcb_stats*   stats = self->ptrStats;     // performance counters
+    const uint16_t  uint16Len = sfcb_spi_len(self);
+    uint8_t         uint8Cmd;                   // accounted command
+
+    if ( (NULL == stats) || (0 == uint16Len) ) {
+        return;
+    }
+    uint8Cmd = (SFCB_CMD_IDLE == stats->uint8JobCmd) ? (uint8_t) self->cmd : stats->uint8JobCmd;
+    (stats->uint32SpiNum[uint8Cmd])++;
+    stats->uint32SpiBytes[uint8Cmd] += uint16Len;
+    if ( SFCB_FL_IST_RD_STATE_REG(self) == sfcb_spi_buf(self)[0] ) {
+        (stats->uint32WipPolls)++;
+    }
+#else
+    (void) self;    // stats disabled
+#endif
+}
+
+
+
+/**
+ *  @brief stats erase
+ *
+ *  counts erased sectors of processed queue
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      len                 erased bytes
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_stats_erase(t_sfcb *self, uint32_t len)
+{
+#ifdef SFCB_STATS_EN
+    if ( (NULL != self->ptrStats) && (self->uint8IterCb < SFCB_STATS_CB) ) {
+        self->ptrStats->uint32EraseSectors[self->uint8IterCb] += len / SFCB_FL_TOPO_SECTOR_SIZE(self);
+    }
+#else
+    (void) self;    // stats disabled
+    (void) len;
+#endif
+}
+
+
+
+/**
+ *  @brief stats job end
+ *
+ *  records worker calls and latency of the finished job
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_stats_job(t_sfcb *self)
+{
+#ifdef SFCB_STATS_EN
+    /** Variables **/
+    t_sfcb_stats*   stats = self->ptrStats; // performance counters
+    uint8_t         uint8Cmd;               // command of finished job
+    uint8_t         uint8Bin = 0;           // histogram bin
+    uint32_t        uint32Lat;              // job latency in ticks
+
+    if ( (NULL == stats) || (SFCB_CMD_IDLE == stats->uint8JobCmd) ) {
+        return;
+    }
+    uint8Cmd = stats->uint8JobCmd;
+    stats->uint8JobCmd = SFCB_CMD_IDLE;
+    (stats->uint32JobNum[uint8Cmd])++;
+    stats->uint32JobCalls[uint8Cmd] += stats->uint32JobCall;
+    if ( stats->uint32JobCall > stats->uint32JobCallsMax[uint8Cmd] ) {
+        stats->uint32JobCallsMax[uint8Cmd] = stats->uint32JobCall;
+    }
+    /* latency requires tick source */
+    if ( NULL == self->ptrTick ) {
+        return;
+    }
+    uint32Lat = self->ptrTick() - stats->uint32JobTick;
+    if ( (1 == stats->uint32JobNum[uint8Cmd]) || (uint32Lat < stats->uint32LatMin[uint8Cmd]) ) {
+        stats->uint32LatMin[uint8Cmd] = uint32Lat;
+    }
+    if ( uint32Lat > stats->uint32LatMax[uint8Cmd] ) {
+        stats->uint32LatMax[uint8Cmd] = uint32Lat;
+    }
+    /* log2 bins */
+    while ( (0 != uint32Lat) && (uint8Bin < (SFCB_STATS_HIST - 1)) ) {
+        uint32Lat >>= 1;
+        uint8Bin++;
+    }
+    (stats->uint32LatHist[uint8Cmd][uint8Bin])++;
+#else
+    (void) self;    // stats disabled
+#endif
+}
+
+
+
+/**
+ *  @brief worker idle
+ *
+ *  finishes current job and releases worker for new requests.
+ *  A suspended background erase is resumed before.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_worker_idle(t_sfcb *self)
+{
+    /* resume background erase, afterwards idle */
+    if ( 0 != self->uint8EraseSus ) {
+        self->uint8EraseSus = 0;
+        self->uint8PtrSpi[0] = SFCB_FL_IST_ERASE_RESUME(self);
+        self->uint16SpiLen = 1;
+        self->cmd = SFCB_CMD_ERASE;
+        self->stage = SFCB_STG02;
+        return;
+    }
+    self->uint16SpiLen = 0;
+    self->cmd = SFCB_CMD_IDLE;
+    self->stage = SFCB_STG00;
+    self->uint8Busy = 0;
+    sfcb_stats_job(self);
+    sfcb_job_done(self);    // report job, and start next
+}
+
+
+
+/**
+ *  @brief slot address
+ *
+ *  calculates flash address of the element header in circular buffer queue slot
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @param[in]      slot                element slot number in queue, starts at zero
+ *  @return         uint32_t            flash byte address of element header
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_slot_adr(t_sfcb *self, t_sfcb_cb *cb, uint32_t slot)
+{
+    (void) self;    // unused with compile-time flash
+    return cb->uint32StartSector * (uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self) + cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self) * slot;
+}
+
+
+
+/**
+ *  @brief slot number
+ *
+ *  calculates element slot number in circular buffer queue from flash address
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @param[in]      adr                 flash byte address inside queue
+ *  @return         uint32_t            element slot number in queue, starts at zero
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_slot_num(t_sfcb *self, t_sfcb_cb *cb, uint32_t adr)
+{
+    (void) self;    // unused with compile-time flash
+    return (adr - cb->uint32StartSector * (uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self)) / (cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self));
+}
+
+
+
+/**
+ *  @brief erase group
+ *
+ *  smallest erasable unit of the queue without partial erased elements. Elements
+ *  divide a sector or span complete sectors, see #sfcb_new_cb
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @return         uint32_t            erase group size in bytes, sector or element size
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_grp_size(t_sfcb *self, t_sfcb_cb *cb)
+{
+    (void) self;    // unused with compile-time flash
+    return sfcb_max((uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self), cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self));
+}
+
+
+
+/**
+ *  @brief slots per erase group
+ *
+ *  number of element slots in one erase group, see #sfcb_grp_size
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @return         uint32_t            element slots per erase group, at least one
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_slot_grp(t_sfcb *self, t_sfcb_cb *cb)
+{
+    return sfcb_grp_size(self, cb) / (cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self));
+}
+
+
+
+/**
+ *  @brief queue alignment
+ *
+ *  alignment of the queue start, erase groups covering an erase block
+ *  start block aligned, see #sfcb_new_cb
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @return         uint32_t            alignment in sectors
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_cb_align(t_sfcb *self, t_sfcb_cb *cb)
+{
+    /** Variables **/
+    const uint32_t  uint32GrpSectors = sfcb_grp_size(self, cb) / SFCB_FL_TOPO_SECTOR_SIZE(self);  // sectors per erase group
+
+    if ( (0 != SFCB_FL_IST_ERASE_BLK64(self)) && !(uint32GrpSectors < (SFCB_FL_TOPO_BLK64_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self))) ) {
+        return SFCB_FL_TOPO_BLK64_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self);
+    }
+    if ( (0 != SFCB_FL_IST_ERASE_BLK32(self)) && !(uint32GrpSectors < (SFCB_FL_TOPO_BLK32_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self))) ) {
+        return SFCB_FL_TOPO_BLK32_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self);
+    }
+    return 1;
+}
+
+
+
+/**
+ *  @brief queue span
+ *
+ *  places queue at first aligned sector starting with start. The queue
+ *  occupies complete erase groups, at least two.
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in,out]  cb                  circular buffer queue with element size, #t_sfcb_cb
+ *  @param[in]      start               first sector candidate
+ *  @param[in]      numElems            minimal number of elements
+ *  @return         int                 state
+ *  @retval         0                   sector range and element slots set
+ *  @retval         -1                  number of elements exceeds flash
+ *  @since          2026-10-14
+ */
+static int sfcb_cb_span(t_sfcb *self, t_sfcb_cb *cb, uint32_t start, uint32_t numElems)
+{
+    /** Variables **/
+    const uint32_t  uint32PagesPerSector = SFCB_FL_TOPO_SECTOR_SIZE(self) / SFCB_FL_TOPO_PAGE_SIZE(self);
+    const uint32_t  uint32GrpSectors = sfcb_grp_size(self, cb) / SFCB_FL_TOPO_SECTOR_SIZE(self);  // sectors per erase group
+    const uint32_t  uint32Align = sfcb_cb_align(self, cb);
+    uint32_t        uint32NumSectors;
+
+    /* limit to flash size, prevents 32bit overflow in the checks below */
+    if ( numElems > (SFCB_FL_TOPO_FLASH_SIZE(self) / SFCB_FL_TOPO_PAGE_SIZE(self)) / cb->uint32NumPagesPerElem ) {
+        return -1;
+    }
+    uint32NumSectors = sfcb_ceildivide_uint32(numElems * cb->uint32NumPagesPerElem, uint32PagesPerSector);
+    uint32NumSectors = sfcb_max(2 * uint32GrpSectors, uint32NumSectors);  // at least two erase groups
+    uint32NumSectors = sfcb_ceildivide_uint32(uint32NumSectors, uint32GrpSectors) * uint32GrpSectors;   // complete erase groups
+    cb->uint32StartSector = sfcb_ceildivide_uint32(start, uint32Align) * uint32Align;
+    cb->uint32StopSector = cb->uint32StartSector + uint32NumSectors - 1;
+    cb->uint32NumEntriesMax = (uint32NumSectors * uint32PagesPerSector) / cb->uint32NumPagesPerElem;
+    return 0;
+}
+
+
+
+/**
+ *  @brief queue overlap
+ *
+ *  checks sector range against the other active queues
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cbID                checked queue, not compared
+ *  @param[in]      start               first sector
+ *  @param[in]      stop                last sector
+ *  @return         int                 state
+ *  @retval         0                   range is free
+ *  @retval         -1                  range used by other queue
+ *  @since          2026-10-14
+ */
+static int sfcb_cb_overlap(t_sfcb *self, uint8_t cbID, uint32_t start, uint32_t stop)
+{
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        if ( (i == cbID) || (0 == ((self->ptrCbs)[i]).uint8Used) ) {
+            continue;
+        }
+        if ( !(stop < ((self->ptrCbs)[i]).uint32StartSector) && !(((self->ptrCbs)[i]).uint32StopSector < start) ) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief sector wear
+ *
+ *  erase cycles of sector, see #sfcb_init_wear
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      sector              sector number
+ *  @return         uint32_t            erase cycles, zero for sectors without counter
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_wear_sec(t_sfcb *self, uint32_t sector)
+{
+    if ( (NULL == self->ptrWear) || !(sector < self->uint32WearNum) ) {
+        return 0;
+    }
+    return self->ptrWear[sector];
+}
+
+
+
+/**
+ *  @brief automatic placement
+ *
+ *  slides the queue span over the flash and selects the free aligned range
+ *  with the least erase cycles, the first one in case of equal cycles
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cbID                placed queue, its current range counts as free
+ *  @param[in,out]  cb                  placement with element size, #t_sfcb_cb
+ *  @param[in]      numElems            minimal number of elements
+ *  @return         int                 state
+ *  @retval         0                   range found
+ *  @retval         -1                  no free range
+ *  @since          2026-10-14
+ */
+static int sfcb_place_auto(t_sfcb *self, uint8_t cbID, t_sfcb_cb *cb, uint32_t numElems)
+{
+    /** Variables **/
+    const uint32_t  uint32Sectors = SFCB_FL_TOPO_FLASH_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self);    // sectors in flash
+    const uint32_t  uint32Align = sfcb_cb_align(self, cb);
+    uint32_t        uint32Len;                  // sectors of queue
+    uint32_t        uint32Cost = 0;             // erase cycles in range
+    uint32_t        uint32Best = 0;             // least erase cycles
+    uint32_t        uint32BestStart = __UINT32_MAX__;   // start of best range
+
+    if ( 0 != sfcb_cb_span(self, cb, 0, numElems) ) {
+        return -1;
+    }
+    uint32Len = cb->uint32StopSector + 1;
+    for ( uint32_t i = 0; i < uint32Len; i++ ) {
+        uint32Cost += sfcb_wear_sec(self, i);
+    }
+    for ( uint32_t uint32Start = 0; !(uint32Sectors < (uint32Start + uint32Len)); uint32Start += uint32Align ) {
+        if ( (0 == sfcb_cb_overlap(self, cbID, uint32Start, uint32Start + uint32Len - 1)) && ((__UINT32_MAX__ == uint32BestStart) || (uint32Cost < uint32Best)) ) {
+            uint32Best = uint32Cost;
+            uint32BestStart = uint32Start;
+        }
+        /* next aligned range */
+        for ( uint32_t i = 0; i < uint32Align; i++ ) {
+            uint32Cost = uint32Cost - sfcb_wear_sec(self, uint32Start + i) + sfcb_wear_sec(self, uint32Start + uint32Len + i);
+        }
+    }
+    if ( __UINT32_MAX__ == uint32BestStart ) {
+        return -1;
+    }
+    cb->uint32StartSector = uint32BestStart;
+    cb->uint32StopSector = uint32BestStart + uint32Len - 1;
+    return 0;
+}
+
+
+
+/**
+ *  @brief erase span
+ *
+ *  flash span to reclaim in queue, starts with the erase group of the oldest
+ *  element and is extended by complete erase groups until the pre-erase watermark
+ *  is reached. Groups with the newest or the next write element are only taken
+ *  if no free element is left, and then as first group only.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cb                  circular buffer queue, #t_sfcb_cb
+ *  @param[in]      force               non zero: queue has no free element, the first group is erased in any case
+ *  @return         int                 state
+ *  @retval         0                   span found, #t_sfcb::uint32EraseAdr and #t_sfcb::uint32EraseEnd set
+ *  @retval         -1                  nothing to erase
+ *  @since          2026-10-14
+ */
+static int sfcb_erase_span(t_sfcb *self, t_sfcb_cb *cb, uint8_t force)
+{
+    /** Variables **/
+    const uint32_t  uint32Grp = sfcb_grp_size(self, cb);                                        // erase group size
+    const uint32_t  uint32Start = cb->uint32StartSector * (uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self); // first queue address
+    const uint32_t  uint32Stop = sfcb_slot_adr(self, cb, cb->uint32NumEntriesMax);              // first address behind queue
+    const uint32_t  uint32Need = sfcb_max((uint32_t) cb->uint16NumFreeMin, (uint32_t) (0 != force));  // free elements after erase
+    uint32_t        uint32Free = cb->uint32NumEntriesMax - cb->uint32NumEntries;                // free elements
+    uint32_t        uint32End;                                                                  // end of next group
+
+    if ( (0 == force) && ((0 == cb->uint32NumEntries) || !(uint32Free < uint32Need)) ) {
+        return -1;
+    }
+    self->uint32EraseAdr = uint32Start + ((cb->uint32StartPageIdMin - uint32Start) / uint32Grp) * uint32Grp;
+    self->uint32EraseEnd = self->uint32EraseAdr;
+    while ( self->uint32EraseEnd < uint32Stop ) {
+        uint32End = self->uint32EraseEnd + uint32Grp;
+        /* group holds newest or next write element */
+        if (    ((0 == force) || (self->uint32EraseEnd != self->uint32EraseAdr))
+             && (    ((cb->uint32StartPageIdMax >= self->uint32EraseEnd) && (cb->uint32StartPageIdMax < uint32End))
+                  || ((0 == force) && (cb->uint32StartPageWrite >= self->uint32EraseEnd) && (cb->uint32StartPageWrite < uint32End)) )
+        ) {
+            break;
+        }
+        self->uint32EraseEnd = uint32End;
+        /* watermark reached */
+        if ( cb->uint32StartPageIdMin < uint32End ) {
+            uint32Free = cb->uint32NumEntriesMax - cb->uint32NumEntries + sfcb_min(sfcb_slot_num(self, cb, uint32End) - sfcb_slot_num(self, cb, cb->uint32StartPageIdMin), cb->uint32NumEntries);
+        }
+        if ( !(uint32Free < uint32Need) ) {
+            break;
+        }
+    }
+    return (self->uint32EraseEnd == self->uint32EraseAdr) ? -1 : 0;
+}
+
+
+
+/**
+ *  @brief pre-erase select
+ *
+ *  finds queue with less free elements than its watermark and selects the
+ *  span to reclaim, see #sfcb_erase_span
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   queue found, #t_sfcb::uint8IterCb and erase span set
+ *  @retval         -1                  nothing to erase
+ *  @since          2026-10-14
+ */
+static int sfcb_erase_sel(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb;         // queue
+
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        cb = &((self->ptrCbs)[i]);
+        /* all active circular buffer queues processed? */
+        if ( 0 == cb->uint8Used ) {
+            break;
+        }
+        /* no valid management data, or enough free elements */
+        if ( (0 == cb->uint8MgmtValid) || (0 != sfcb_erase_span(self, cb, 0)) ) {
+            continue;
+        }
+        self->uint8IterCb = i;
+        return 0;
+    }
+    return -1;
+}
+
+
+
+/**
+ *  @brief pre-erase update
+ *
+ *  removes the completely erased elements from management data
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in,out]  cb                  circular buffer queue, #t_sfcb_cb
+ *  @param[in]      end                 end of erased flash, first address behind
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_erase_mgmt(t_sfcb *self, t_sfcb_cb *cb, uint32_t end)
+{
+    /** Variables **/
+    uint32_t    uint32Slot; // first slot behind erased flash
+    uint32_t    uint32Num;  // number of erased elements
+
+    uint32Slot = sfcb_slot_num(self, cb, end);
+    if ( !(sfcb_slot_num(self, cb, cb->uint32StartPageIdMin) < uint32Slot) ) {
+        return; // oldest element not completely erased
+    }
+    uint32Num = sfcb_min(uint32Slot - sfcb_slot_num(self, cb, cb->uint32StartPageIdMin), cb->uint32NumEntries);
+    cb->uint32IdNumMin = cb->uint32IdNumMin + uint32Num;
+    cb->uint32NumEntries = (cb->uint32NumEntries - uint32Num);
+    cb->uint32StartPageIdMin = sfcb_slot_adr(self, cb, uint32Slot % cb->uint32NumEntriesMax);
+}
+
+
+
+/**
+ *  @brief erase request
+ *
+ *  assembles SPI packet for the largest erase at #t_sfcb::uint32EraseAdr which is
+ *  aligned and inside the erase span: 64KB block, 32KB block or sector. The
+ *  management data of the queue is updated.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in,out]  cb                  circular buffer queue, #t_sfcb_cb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_erase_req(t_sfcb *self, t_sfcb_cb *cb)
+{
+    /** Variables **/
+    const uint32_t  uint32Rem = self->uint32EraseEnd - self->uint32EraseAdr;   // remaining bytes
+    uint32_t        uint32Len = SFCB_FL_TOPO_SECTOR_SIZE(self);                 // erased bytes
+    uint32_t        uint32Us = SFCB_FL_TIME_ERASE_SECTOR(self);                 // typ. erase time
+
+    self->uint8PtrSpi[0] = SFCB_FL_IST_ERASE_SECTOR(self);
+    if (    (0 != SFCB_FL_IST_ERASE_BLK64(self))
+         && (0 == (self->uint32EraseAdr % SFCB_FL_TOPO_BLK64_SIZE(self)))
+         && !(uint32Rem < SFCB_FL_TOPO_BLK64_SIZE(self))
+    ) {
+        self->uint8PtrSpi[0] = SFCB_FL_IST_ERASE_BLK64(self);
+        uint32Len = SFCB_FL_TOPO_BLK64_SIZE(self);
+        uint32Us = SFCB_FL_TIME_ERASE_BLK64(self);
+    } else if (    (0 != SFCB_FL_IST_ERASE_BLK32(self))
+                && (0 == (self->uint32EraseAdr % SFCB_FL_TOPO_BLK32_SIZE(self)))
+                && !(uint32Rem < SFCB_FL_TOPO_BLK32_SIZE(self))
+    ) {
+        self->uint8PtrSpi[0] = SFCB_FL_IST_ERASE_BLK32(self);
+        uint32Len = SFCB_FL_TOPO_BLK32_SIZE(self);
+        uint32Us = SFCB_FL_TIME_ERASE_BLK32(self);
+    }
+    sfcb_log_info("  INFO:%s: ist=0x%02x, adr=0x%x, len=0x%x\n", __FUNCTION__, self->uint8PtrSpi[0], self->uint32EraseAdr, uint32Len);
+    sfcb_adr32_uint8(self->uint32EraseAdr, self->uint8PtrSpi+1, SFCB_FL_TOPO_ADR_BYTE(self));   // +1 first byte is instruction
+    self->uint16SpiLen = (uint16_t) (SFCB_FL_TOPO_ADR_BYTE(self) + 1);  // address + instruction
+    /* erase cycles of erased sectors */
+    if ( NULL != self->ptrWear ) {
+        for ( uint32_t i = self->uint32EraseAdr / SFCB_FL_TOPO_SECTOR_SIZE(self); i < ((self->uint32EraseAdr + uint32Len) / SFCB_FL_TOPO_SECTOR_SIZE(self)) && (i < self->uint32WearNum); i++ ) {
+            ++(self->ptrWear[i]);
+        }
+    }
+    self->uint32EraseAdr += uint32Len;
+    sfcb_erase_mgmt(self, cb, self->uint32EraseAdr);
+    sfcb_stats_erase(self, uint32Len);
+    sfcb_wip_set(self, uint32Us);
+}
+
+
+
+/**
+ *  @brief reset queue
+ *
+ *  invalidates management data of circular buffer queue, prepares for rebuild by #sfcb_worker
+ *
+ *  @param[in,out]  cb                  circular buffer queue, #t_sfcb_cb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_qrst(t_sfcb_cb *cb)
+{
+    cb->uint8MgmtValid = 0;
+    cb->uint32IdNumMax = 0;                 // in case of uninitialized memory
+    cb->uint32IdNumMin = __UINT32_MAX__;    // assign highest number
+    cb->uint32NumEntries = 0;
+    cb->uint16PlFlashOfs = 0;               // reset payload offset counter
+    cb->uint16StageLen = 0;                 // staged bytes refer to old element
+    cb->uint32CrcWr = 0;
+    cb->uint8MgmtCkpt = 0;
+}
+
+
+
+/**
+ *  @brief read header
+ *
+ *  number of bytes in front of the read data: instruction, address and
+ *  dummy bytes of the selected read mode
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         uint16_t            offset of read data in spi packet
+ *  @since          2026-10-14
+ */
+static uint16_t sfcb_rd_hdr(t_sfcb *self)
+{
+    return (uint16_t) (1 + SFCB_FL_TOPO_ADR_BYTE(self) + self->xferRd.uint8Dummy);  // +1: IST
+}
+
+
+
+/**
+ *  @brief read request
+ *
+ *  assembles spi packet for flash read in selected read mode,
+ *  read data bytes are written as zero
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      adr                 flash start address
+ *  @param[in]      len                 number of read bytes
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_rd_req(t_sfcb *self, uint32_t adr, uint32_t len)
+{
+    self->uint16SpiLen = (uint16_t) (sfcb_rd_hdr(self) + len);
+    self->uint8PtrSpi[0] = self->uint8IstRd;
+    sfcb_adr32_uint8(adr, self->uint8PtrSpi+1, SFCB_FL_TOPO_ADR_BYTE(self));    // +1 first byte is instruction
+    memset(self->uint8PtrSpi + 1 + SFCB_FL_TOPO_ADR_BYTE(self), 0xFF, self->xferRd.uint8Dummy);  // dummy and mode bits, no continuous read
+    memset(self->uint8PtrSpi + sfcb_rd_hdr(self), 0, len);
+    self->xfer = self->xferRd;
+}
+
+
+
+/**
+ *  @brief read next
+ *
+ *  requests next chunk of a GET/RAW read stream. With payload CRC the stream
+ *  is continued up to the CRC in the element footer. The last payload chunk
+ *  covers the footer CRC if it fits into the chunk, otherwise the erased gap
+ *  in front of the footer is skipped and the CRC is read separately.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   read complete
+ *  @retval         -1                  SPI transfer is required
+ *  @since          2026-10-14
+ */
+static int sfcb_rd_next(t_sfcb *self)
+{
+    /** Variables **/
+    const t_sfcb_cb*    cb = &((self->ptrCbs)[self->uint8IterCb]);      // read queue
+    uint32_t            uint32End = self->uint32RdLen;                  // end of read stream
+    uint32_t            uint32Foot;                                     // footer CRC offset in stream
+    uint32_t            uint32CrcEnd;                                   // end of footer CRC in stream
+
+    /* stream with payload CRC */
+    if ( 0 != self->uint8RdCrc ) {
+        uint32Foot = cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self) - 2 * (uint32_t) sizeof(spi_flash_cb_elem_head);
+        uint32CrcEnd = uint32Foot + (uint32_t) sizeof(self->uint32CrcFoot);
+        uint32End = sfcb_max(uint32End, (uint32_t) cb->uint16PlSize);
+        if ( uint32End < uint32Foot ) {
+            /* payload and footer CRC in one chunk */
+            if ( self->uint32RdIter < uint32End ) {
+                if ( (uint32CrcEnd - self->uint32RdIter) <= self->uint16RdChunk ) {
+                    uint32End = uint32CrcEnd;
+                }
+            /* skip erased gap */
+            } else {
+                if ( self->uint32RdIter < uint32Foot ) {
+                    self->uint32IterAdr += uint32Foot - self->uint32RdIter;
+                    self->uint32RdIter = uint32Foot;
+                }
+                uint32End = uint32CrcEnd;
+            }
+        } else {
+            uint32End = sfcb_max(uint32End, uint32CrcEnd);
+        }
+    }
+    /* read complete */
+    if ( !(self->uint32RdIter < uint32End) ) {
+        return 0;
+    }
+    sfcb_rd_req(self, self->uint32IterAdr, sfcb_min(self->uint16RdChunk, uint32End - self->uint32RdIter));    // reads are not page bound
+    return -1;
+}
+
+
+
+/**
+ *  @brief read CRC
+ *
+ *  updates the payload CRC with the read chunk and captures the
+ *  footer CRC, see #sfcb_rd_next
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      data                read bytes at stream offset #t_sfcb::uint32RdIter
+ *  @param[in]      len                 number of read bytes
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_rd_crc(t_sfcb *self, const uint8_t *data, uint32_t len)
+{
+    /** Variables **/
+    const t_sfcb_cb*    cb = &((self->ptrCbs)[self->uint8IterCb]);  // read queue
+    const uint32_t      uint32Foot = cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self) - 2 * (uint32_t) sizeof(spi_flash_cb_elem_head);
+    uint32_t            uint32Ofs;  // stream offset
+
+    /* payload */
+    if ( self->uint32RdIter < cb->uint16PlSize ) {
+        self->uint32CrcRd = sfcb_crc32(self->uint32CrcRd, data, sfcb_min(len, cb->uint16PlSize - self->uint32RdIter));
+    }
+    /* footer CRC */
+    for ( uint32Ofs = sfcb_max(self->uint32RdIter, uint32Foot); uint32Ofs < sfcb_min(self->uint32RdIter + len, uint32Foot + (uint32_t) sizeof(self->uint32CrcFoot)); uint32Ofs++ ) {
+        ((uint8_t*) &(self->uint32CrcFoot))[uint32Ofs - uint32Foot] = data[uint32Ofs - self->uint32RdIter];
+    }
+}
+
+
+
+/**
+ *  @brief header request
+ *
+ *  assembles SPI packet for read of element header in current queue
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      slot                element slot number in queue
+ *  @param[in]      stage               stage which evaluates the read header
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_hdr_req(t_sfcb *self, uint32_t slot, t_sfcb_stage stage)
+{
+    self->uint32IterSlot = slot;
+    self->uint32IterAdr = sfcb_slot_adr(self, &((self->ptrCbs)[self->uint8IterCb]), slot);
+    sfcb_rd_req(self, self->uint32IterAdr, (uint32_t) sizeof(spi_flash_cb_elem_head));
+    self->stage = stage;
+}
+
+
+
+/**
+ *  @brief header read
+ *
+ *  extracts element header from SPI response and classifies it
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      ofs                 byte offset of header in read data, non zero for burst reads
+ *  @param[out]     head                read element header
+ *  @return         int                 header state
+ *  @retval         #SFCB_HDR_USED      valid element of current queue
+ *  @retval         #SFCB_HDR_MTY       unused element, all bytes erased
+ *  @retval         #SFCB_HDR_ERO       corrupted element header
+ *  @since          2026-10-14
+ */
+static int sfcb_mkcb_hdr_read(t_sfcb *self, uint16_t ofs, spi_flash_cb_elem_head *head)
+{
+    /** Variables **/
+    const uint8_t*  uint8PtrHead = self->uint8PtrSpi + sfcb_rd_hdr(self) + ofs;  // skip instruction, address and dummy
+
+    /* copy head from SPI packet, ensure alignment to processor architecture */
+    memcpy(head, uint8PtrHead, sizeof(spi_flash_cb_elem_head));
+    /* Flash Area is used by circular buffer */
+    if ( head->uint32MagicNum == ((self->ptrCbs)[self->uint8IterCb]).uint32MagicNum ) {
+        return SFCB_HDR_USED;
+    }
+    /* check for unused header */
+    for ( uint8_t i = 0; i < sizeof(spi_flash_cb_elem_head); i++ ) {
+        if ( 0xFF != uint8PtrHead[i] ) {
+            return SFCB_HDR_ERO;
+        }
+    }
+    return SFCB_HDR_MTY;
+}
+
+
+
+/**
+ *  @brief header burst request
+ *
+ *  assembles SPI packet for linear scan. Reads as many consecutive element
+ *  headers of current queue as fit into the SPI buffer with one transfer,
+ *  the footers of the preceding elements are part of the read.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      slot                first element slot number in burst
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_hdr_burst(t_sfcb *self, uint32_t slot)
+{
+    /** Variables **/
+    const uint32_t  uint32Stride = ((self->ptrCbs)[self->uint8IterCb]).uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self);  // distance between two headers
+    uint32_t        uint32Num;  // number of headers in burst
+
+    /* headers fitting into SPI buffer, at least one */
+    uint32Num = (uint32_t) ((uint32_t) (self->uint16SpiMax - sfcb_rd_hdr(self)) - (uint32_t) sizeof(spi_flash_cb_elem_head)) / uint32Stride + 1;
+    uint32Num = sfcb_min(uint32Num, ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax - slot);
+    /* assemble read */
+    sfcb_mkcb_hdr_req(self, slot, SFCB_STG01);
+    self->uint16SpiLen = (uint16_t) (self->uint16SpiLen + (uint32Num - 1) * uint32Stride);
+    memset(self->uint8PtrSpi + sfcb_rd_hdr(self), 0, (size_t) (self->uint16SpiLen - sfcb_rd_hdr(self)));
+}
+
+
+
+/**
+ *  @brief header burst number
+ *
+ *  number of element headers in response of linear scan burst read
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         uint32_t            number of headers
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_mkcb_hdr_num(t_sfcb *self)
+{
+    /** Variables **/
+    const uint32_t  uint32Stride = ((self->ptrCbs)[self->uint8IterCb]).uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self);  // distance between two headers
+
+    return ((uint32_t) (self->uint16SpiLen - sfcb_rd_hdr(self)) - (uint32_t) sizeof(spi_flash_cb_elem_head)) / uint32Stride + 1;
+}
+
+
+
+/**
+ *  @brief header burst evaluate
+ *
+ *  evaluates all element headers of a linear scan burst read and
+ *  updates the management data of the current queue
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         uint32_t            number of evaluated headers
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_mkcb_hdr_eval(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_cb*              cb = &((self->ptrCbs)[self->uint8IterCb]);
+    const uint32_t          uint32Stride = cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self);  // distance between two headers
+    spi_flash_cb_elem_head  readHead;   // read element header
+    uint32_t                uint32Num;  // number of headers in burst
+    uint32_t                uint32Adr;  // flash address of header
+    int                     intHead;    // header state
+
+    uint32Num = sfcb_mkcb_hdr_num(self);
+    for ( uint32_t i = 0; i < uint32Num; i++ ) {
+        uint32Adr = self->uint32IterAdr + i * uint32Stride;
+        /* classify read header */
+        intHead = sfcb_mkcb_hdr_read(self, (uint16_t) (i * uint32Stride), &readHead);
+        sfcb_log_info("  INFO:%s: cb=%d, flashadr=0x%x, head=%d, magicnum=0x%x\n", __FUNCTION__, self->uint8IterCb, uint32Adr, intHead, readHead.uint32MagicNum);
+        /* Flash Area is used by circular buffer */
+        if ( SFCB_HDR_USED == intHead ) {
+            /* count available elements */
+            (cb->uint32NumEntries)++;
+            /* get highest number of numbered circular buffer elements, needed for next entry */
+            self->uint8IterFlg &= (uint8_t) ~SFCB_SCAN_PRVMX;
+            if ( readHead.uint32IdNum > cb->uint32IdNumMax ) {
+                cb->uint32IdNumMax = readHead.uint32IdNum;
+                cb->uint32StartPageIdMax = uint32Adr;   // needed by sfcb_get_last
+                self->uint8IterFlg |= SFCB_SCAN_PRVMX;
+            }
+            /* get lowest number of circular buffer, needed for erase sector, and start get function */
+            if ( readHead.uint32IdNum < cb->uint32IdNumMin ) {
+                cb->uint32IdNumMin = readHead.uint32IdNum;
+                cb->uint32StartPageIdMin = uint32Adr;   // needed by Sector-Erase
+            }
+        /* first unused pages is alocated, iterate over all elements to get all IDs */
+        /* free page behind newest element is preferred, keeps free slots contiguous */
+        } else if ( SFCB_HDR_MTY == intHead ) {
+            if ( (0 == cb->uint8MgmtValid) || (0 != (self->uint8IterFlg & SFCB_SCAN_PRVMX)) ) {
+                cb->uint32StartPageWrite = uint32Adr;
+                cb->uint8MgmtValid = 1; // prepared for writing next element
+            }
+            self->uint8IterFlg &= (uint8_t) ~SFCB_SCAN_PRVMX;
+        /* corrupted empty page found, leave as it is */
+        } else {
+            sfcb_log_ero ("  ERROR:%s: corrupted empty page found at 0x%0x\n", __FUNCTION__, uint32Adr);
+            self->uint8IterFlg &= (uint8_t) ~SFCB_SCAN_PRVMX;
+        }
+    }
+    return uint32Num;
+}
+
+
+
+/**
+ *  @brief next queue
+ *
+ *  searches next active circular buffer queue with invalid management data
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      start               first queue number to check
+ *  @return         int                 state
+ *  @retval         0                   queue found, #t_sfcb::uint8IterCb points to queue
+ *  @retval         -1                  all active queues processed
+ *  @since          2026-10-14
+ */
+static int sfcb_mkcb_nxtq(t_sfcb *self, uint8_t start)
+{
+    for ( uint8_t i = start; i < self->uint8NumCbs; i++ ) {
+        /* all active circular buffer queues processed? */
+        if ( 0 == ((self->ptrCbs)[i]).uint8Used ) {
+            break;
+        }
+        /* dirty queue found */
+        if ( 0 == ((self->ptrCbs)[i]).uint8MgmtValid ) {
+            self->uint8IterCb = i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+
+
+/**
+ *  @brief start queue scan
+ *
+ *  starts logarithmic header scan of current circular buffer queue with first element slot
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_bs_start(t_sfcb *self)
+{
+    sfcb_log_info("  INFO:%s: start scan of queue cb=%d\n", __FUNCTION__, self->uint8IterCb);
+    sfcb_mkcb_qrst(&((self->ptrCbs)[self->uint8IterCb]));
+    self->uint8IterFlg = 0;
+    sfcb_mkcb_hdr_req(self, 0, SFCB_STG04);
+}
+
+
+
+/**
+ *  @brief start linear scan
+ *
+ *  fallback to header scan over all element slots in current queue, used in case of corrupted headers
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_lin_start(t_sfcb *self)
+{
+    sfcb_log_ero("  ERROR:%s: inconsistent header at 0x%x, cb=%d, fall back to linear scan\n", __FUNCTION__, self->uint32IterAdr, self->uint8IterCb);
+    sfcb_mkcb_qrst(&((self->ptrCbs)[self->uint8IterCb]));
+    self->uint8IterFlg = 0;
+    self->uint32IterSlot = 0;
+    self->uint16SpiLen = 0; // no response to evaluate
+    self->stage = SFCB_STG01;
+}
+
+
+
+/**
+ *  @brief start queue
+ *
+ *  starts rebuild of current circular buffer queue. Management data restored
+ *  from checkpoint is verified, otherwise the logarithmic scan is started.
+ *  A placed queue is erased first, see #sfcb_place_cb.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_qstart(t_sfcb *self)
+{
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);
+
+    /* placement changed, erase all sectors of queue and scan afterwards */
+    if ( 0 != cb->uint8Fmt ) {
+        sfcb_log_info("  INFO:%s: erase placed queue cb=%d, sectors=0x%x..0x%x\n", __FUNCTION__, self->uint8IterCb, cb->uint32StartSector, cb->uint32StopSector);
+        cb->uint8Fmt = 0;
+        sfcb_mkcb_qrst(cb);
+        self->uint32EraseAdr = cb->uint32StartSector * (uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self);
+        self->uint32EraseEnd = (cb->uint32StopSector + 1) * (uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self);
+        self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);   // enable write
+        self->uint16SpiLen = 1;
+        self->stage = SFCB_STG02;
+        return;
+    }
+    /* no checkpoint, scan flash */
+    if ( 0 == cb->uint8MgmtCkpt ) {
+        sfcb_mkcb_bs_start(self);
+        return;
+    }
+    cb->uint8MgmtCkpt = 0;
+    sfcb_log_info("  INFO:%s: verify checkpoint of queue cb=%d\n", __FUNCTION__, self->uint8IterCb);
+    /* oldest element still present? */
+    if ( 0 != cb->uint32NumEntries ) {
+        sfcb_mkcb_hdr_req(self, sfcb_slot_num(self, cb, cb->uint32StartPageIdMin), SFCB_STG09);
+        return;
+    }
+    /* elements written after checkpoint? */
+    sfcb_mkcb_hdr_req(self, sfcb_slot_num(self, cb, cb->uint32StartPageWrite), SFCB_STG10);
+}
+
+
+
+/**
+ *  @brief checkpoint size
+ *
+ *  size of checkpoint snapshot without CRC, queue entries and
+ *  erase cycles with base and 16bit offset per sector
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         uint32_t            snapshot size in bytes
+ *  @since          2026-10-14
+ */
+static uint32_t sfcb_ckpt_len(t_sfcb *self)
+{
+    /** Variables **/
+    uint32_t    uint32Len = (uint32_t) (self->uint8NumCbs * sizeof(t_sfcb_ckpt_elem));
+
+    if ( NULL != self->ptrWear ) {
+        uint32Len += (uint32_t) (sizeof(uint32_t) + self->uint32WearNum * sizeof(uint16_t));
+    }
+    return uint32Len;
+}
+
+
+
+/**
+ *  @brief checkpoint placement
+ *
+ *  placement of queue after checkpoint restore. Entries of dirty queues with
+ *  matching magic number and a sector range of complete erase groups in the
+ *  flash are taken, otherwise the current placement is kept.
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[out]     start               first sector
+ *  @param[out]     stop                last sector
+ *  @return         int                 state
+ *  @retval         0                   placement from checkpoint
+ *  @retval         -1                  current placement
+ *  @since          2026-10-14
+ */
+static int sfcb_ckpt_geo(t_sfcb *self, uint8_t cbID, uint32_t *start, uint32_t *stop)
+{
+    /** Variables **/
+    t_sfcb_ckpt_elem    ckpt;       // snapshot of queue
+    t_sfcb_cb*          cb = &((self->ptrCbs)[cbID]);
+    uint32_t            uint32Grp;  // sectors per erase group
+
+    *start = cb->uint32StartSector;
+    *stop = cb->uint32StopSector;
+    memcpy(&ckpt, ((uint8_t*) self->ptrCkpt) + cbID*sizeof(t_sfcb_ckpt_elem), sizeof(ckpt));
+    /* only dirty queues with matching magic, not placed since mount */
+    if ( (0 == cb->uint8Used) || (0 != cb->uint8MgmtValid) || (0 != cb->uint8Fmt) || (cbID == self->uint8CkptCb) || (ckpt.uint32MagicNum != cb->uint32MagicNum) ) {
+        return -1;
+    }
+    /* complete erase groups in flash */
+    uint32Grp = sfcb_grp_size(self, cb) / SFCB_FL_TOPO_SECTOR_SIZE(self);
+    if (    (ckpt.uint32StopSector < ckpt.uint32StartSector)
+         || !(ckpt.uint32StopSector < (SFCB_FL_TOPO_FLASH_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self)))
+         || (0 != ((ckpt.uint32StopSector - ckpt.uint32StartSector + 1) % uint32Grp))
+         || ((ckpt.uint32StopSector - ckpt.uint32StartSector + 1) < 2 * uint32Grp)
+    ) {
+        return -1;
+    }
+    *start = ckpt.uint32StartSector;
+    *stop = ckpt.uint32StopSector;
+    return 0;
+}
+
+
+
+/**
+ *  @brief checkpoint apply
+ *
+ *  restores placement, management data of all dirty queues and erase cycles
+ *  from read checkpoint, entries with wrong magic number or inconsistent data
+ *  are skipped. The checkpoint is dropped if restored placements overlap.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_ckpt_apply(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_ckpt_elem    ckpt;       // snapshot of one queue
+    t_sfcb_cb*          cb;         // queue
+    uint32_t            uint32Crc;  // stored CRC
+    uint32_t            uint32Len;  // snapshot size without CRC
+    uint32_t            uint32Stop; // first address behind queue
+    uint32_t            uint32Start[2]; // placement
+    uint32_t            uint32End[2];
+    uint32_t            uint32Base; // erase cycles base
+    uint16_t            uint16Ofs;  // erase cycles offset
+
+    /* check CRC */
+    uint32Len = sfcb_ckpt_len(self);
+    memcpy(&uint32Crc, ((uint8_t*) self->ptrCkpt) + uint32Len, sizeof(uint32Crc));
+    if ( uint32Crc != sfcb_crc32(0, self->ptrCkpt, uint32Len) ) {
+        sfcb_log_ero("  ERROR:%s: checkpoint CRC mismatch\n", __FUNCTION__);
+        return;
+    }
+    /* restored placement overlap free */
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        (void) sfcb_ckpt_geo(self, i, &(uint32Start[0]), &(uint32End[0]));
+        for ( uint8_t j = (uint8_t) (i + 1); (0 != ((self->ptrCbs)[i]).uint8Used) && (j < self->uint8NumCbs); j++ ) {
+            (void) sfcb_ckpt_geo(self, j, &(uint32Start[1]), &(uint32End[1]));
+            if ( (0 != ((self->ptrCbs)[j]).uint8Used) && !(uint32End[0] < uint32Start[1]) && !(uint32End[1] < uint32Start[0]) ) {
+                sfcb_log_ero("  ERROR:%s: checkpoint placement of cb=%d and cb=%d overlaps\n", __FUNCTION__, i, j);
+                return;
+            }
+        }
+    }
+    /* erase cycles */
+    if ( NULL != self->ptrWear ) {
+        uint32Len = (uint32_t) (self->uint8NumCbs * sizeof(t_sfcb_ckpt_elem));
+        memcpy(&uint32Base, ((uint8_t*) self->ptrCkpt) + uint32Len, sizeof(uint32Base));
+        uint32Len += (uint32_t) sizeof(uint32Base);
+        for ( uint32_t i = 0; i < self->uint32WearNum; i++ ) {
+            memcpy(&uint16Ofs, ((uint8_t*) self->ptrCkpt) + uint32Len + i*sizeof(uint16Ofs), sizeof(uint16Ofs));
+            self->ptrWear[i] = sfcb_max(self->ptrWear[i], uint32Base + uint16Ofs);
+        }
+    }
+    /* restore queues */
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        cb = &((self->ptrCbs)[i]);
+        memcpy(&ckpt, ((uint8_t*) self->ptrCkpt) + i*sizeof(t_sfcb_ckpt_elem), sizeof(ckpt));
+        /* only dirty queues with matching magic and valid placement */
+        if ( 0 != sfcb_ckpt_geo(self, i, &(uint32Start[0]), &(uint32End[0])) ) {
+            continue;
+        }
+        /* placement */
+        if ( (cb->uint32StartSector != uint32Start[0]) || (cb->uint32StopSector != uint32End[0]) ) {
+            sfcb_log_info("  INFO:%s: cb=%d placed at sectors=0x%x..0x%x\n", __FUNCTION__, i, uint32Start[0], uint32End[0]);
+        }
+        cb->uint32StartSector = uint32Start[0];
+        cb->uint32StopSector = uint32End[0];
+        cb->uint32NumEntriesMax = ((uint32End[0] - uint32Start[0] + 1) * (SFCB_FL_TOPO_SECTOR_SIZE(self) / SFCB_FL_TOPO_PAGE_SIZE(self))) / cb->uint32NumPagesPerElem;
+        /* plausibility */
+        uint32Stop = sfcb_slot_adr(self, cb, cb->uint32NumEntriesMax);
+        if (    (ckpt.uint32NumEntries > cb->uint32NumEntriesMax)
+             || (ckpt.uint32StartPageWrite >= uint32Stop) || (ckpt.uint32StartPageWrite != sfcb_slot_adr(self, cb, sfcb_slot_num(self, cb, ckpt.uint32StartPageWrite)))
+             || (ckpt.uint32StartPageIdMin >= uint32Stop) || (ckpt.uint32StartPageIdMin != sfcb_slot_adr(self, cb, sfcb_slot_num(self, cb, ckpt.uint32StartPageIdMin)))
+             || (ckpt.uint32StartPageIdMax >= uint32Stop) || (ckpt.uint32StartPageIdMax != sfcb_slot_adr(self, cb, sfcb_slot_num(self, cb, ckpt.uint32StartPageIdMax)))
+             || ((0 != ckpt.uint32NumEntries) && ((ckpt.uint32IdNumMax - ckpt.uint32IdNumMin + 1) != ckpt.uint32NumEntries))
+        ) {
+            sfcb_log_ero("  ERROR:%s: checkpoint of cb=%d inconsistent\n", __FUNCTION__, i);
+            continue;
+        }
+        /* restore */
+        cb->uint32IdNumMax = ckpt.uint32IdNumMax;
+        cb->uint32IdNumMin = ckpt.uint32IdNumMin;
+        cb->uint32StartPageWrite = ckpt.uint32StartPageWrite;
+        cb->uint32StartPageIdMin = ckpt.uint32StartPageIdMin;
+        cb->uint32StartPageIdMax = ckpt.uint32StartPageIdMax;
+        cb->uint32NumEntries = ckpt.uint32NumEntries;
+        cb->uint8MgmtCkpt = 1;  // verify with flash
+        sfcb_log_info("  INFO:%s: cb=%d restored from checkpoint\n", __FUNCTION__, i);
+    }
+}
+
+
+
+/**
+ *  @brief checkpoint read
+ *
+ *  requests next chunk of newest checkpoint. If completely read, restores queues
+ *  from the checkpoint and continues with the rebuild of the first dirty queue.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_ckpt_rd(t_sfcb *self)
+{
+    /** Variables **/
+    uint16_t    uint16Len;  // chunk size
+
+    /* request next chunk */
+    if ( self->uint16Iter < ((self->ptrCbs)[self->uint8CkptCb]).uint16PlSize ) {
+        uint16Len = (uint16_t) sfcb_min(self->uint16SpiMax - sfcb_rd_hdr(self), ((self->ptrCbs)[self->uint8CkptCb]).uint16PlSize - self->uint16Iter);
+        self->uint32IterAdr = ((self->ptrCbs)[self->uint8CkptCb]).uint32StartPageIdMax + (uint32_t) sizeof(spi_flash_cb_elem_head) + self->uint16Iter;
+        sfcb_rd_req(self, self->uint32IterAdr, uint16Len);
+        self->stage = SFCB_STG08;
+        return;
+    }
+    /* checkpoint complete */
+    sfcb_mkcb_ckpt_apply(self);
+    if ( 0 == sfcb_mkcb_nxtq(self, 0) ) {
+        sfcb_mkcb_qstart(self);
+        return;
+    }
+    sfcb_worker_idle(self);
+}
+
+
+
+/**
+ *  @brief queue done
+ *
+ *  finishes scan of current queue. In case of free element continues with next queue,
+ *  otherwise prepares sector erase of oldest element.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_qdone(t_sfcb *self)
+{
+    /** Variables **/
+    uint8_t uint8Start = (uint8_t) (self->uint8IterCb + 1); // next queue to check
+
+    /* Free Page Found */
+    if ( 0 != ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid ) {
+        sfcb_log_info ( "  INFO:%s: cb=%d, idmin=0x%x, idmax=0x%x, entries=%d, wrpage=0x%x\n",
+                        __FUNCTION__,
+                        self->uint8IterCb,
+                        ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin,
+                        ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax,
+                        ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntries,
+                        ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite
+                      );
+        /* checkpoint queue mounted, restore dirty queues from newest checkpoint */
+        if ( (NULL != self->ptrCkpt) && (self->uint8IterCb == self->uint8CkptCb) ) {
+            if ( (0 != ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntries) && (0 == sfcb_mkcb_nxtq(self, 0)) ) {
+                self->uint8IterCb = self->uint8CkptCb;
+                self->uint16Iter = 0;
+                sfcb_mkcb_ckpt_rd(self);
+                return;
+            }
+            uint8Start = 0; // checkpoint queue is mounted first, continue with first queue
+        }
+        /* look ahead if service of some queue can skipped */
+        if ( 0 == sfcb_mkcb_nxtq(self, uint8Start) ) {
+            sfcb_mkcb_qstart(self);
+            return;
+        }
+        /* all available queues processed, go in idle */
+        sfcb_worker_idle(self);
+        return;
+    }
+    /* Go on with erase of oldest elements */
+    (void) sfcb_erase_span(self, &((self->ptrCbs)[self->uint8IterCb]), 1);
+    self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);   // enable write
+    self->uint16SpiLen = 1;
+    self->stage = SFCB_STG02;
+}
+
+
+
+/**
+ *  @brief bisect oldest
+ *
+ *  bisects run of ascending IDs which ends at last element slot. Requests next header
+ *  or evaluates the run start, the run start is the oldest element in the queue.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_bs_new(t_sfcb *self);
+static void sfcb_mkcb_bs_old(t_sfcb *self)
+{
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);
+
+    /* request next header */
+    if ( (self->uint32IterHi - self->uint32IterLo) > 1 ) {
+        sfcb_mkcb_hdr_req(self, self->uint32IterLo + (self->uint32IterHi - self->uint32IterLo) / 2, SFCB_STG07);
+        return;
+    }
+    /* oldest element found */
+    cb->uint32IdNumMin = self->uint32IterIdLast - ((uint32_t) (cb->uint32NumEntriesMax - 1) - self->uint32IterHi);
+    cb->uint32StartPageIdMin = sfcb_slot_adr(self, cb, self->uint32IterHi);
+    /* used run between free slots, continue with newest element */
+    if ( 0 != (self->uint8IterFlg & SFCB_SCAN_MID) ) {
+        self->uint32IterLo = self->uint32IterHi;
+        self->uint32IterHi = (uint32_t) (cb->uint32NumEntriesMax - 1);
+        self->uint8IterFlg |= SFCB_SCAN_HIMTY;
+        sfcb_mkcb_bs_new(self);
+        return;
+    }
+    cb->uint32NumEntries = (cb->uint32IdNumMax - cb->uint32IdNumMin + 1);
+    sfcb_mkcb_qdone(self);
+}
+
+
+
+/**
+ *  @brief bisect newest
+ *
+ *  bisects run of ascending IDs starting at first element slot. Requests next header
+ *  or evaluates the run end, the run end is the newest element in the queue.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_mkcb_bs_new(t_sfcb *self)
+{
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);
+
+    /* request next header */
+    if ( (self->uint32IterHi - self->uint32IterLo) > 1 ) {
+        sfcb_mkcb_hdr_req(self, self->uint32IterLo + (self->uint32IterHi - self->uint32IterLo) / 2, SFCB_STG06);
+        return;
+    }
+    /* newest element found */
+    cb->uint32IdNumMax = self->uint32IterIdFirst + self->uint32IterLo;
+    cb->uint32StartPageIdMax = sfcb_slot_adr(self, cb, self->uint32IterLo);
+    /* following slot is free */
+    if ( (self->uint32IterLo != self->uint32IterHi) && (0 != (self->uint8IterFlg & SFCB_SCAN_HIMTY)) ) {
+        cb->uint32StartPageWrite = sfcb_slot_adr(self, cb, self->uint32IterHi);
+        cb->uint8MgmtValid = 1;
+        /* oldest elements at ring end */
+        if ( 0 != (self->uint8IterFlg & SFCB_SCAN_LAST) ) {
+            self->uint32IterLo = self->uint32IterHi;
+            self->uint32IterHi = (uint32_t) (cb->uint32NumEntriesMax - 1);
+            sfcb_mkcb_bs_old(self);
+            return;
+        }
+        /* oldest element is first slot */
+        if ( 0 == (self->uint8IterFlg & SFCB_SCAN_MID) ) {
+            cb->uint32IdNumMin = self->uint32IterIdFirst;
+            cb->uint32StartPageIdMin = sfcb_slot_adr(self, cb, 0);
+        }
+    /* no free slot, oldest element follows newest */
+    } else {
+        cb->uint32IdNumMin = cb->uint32IdNumMax + 1 - cb->uint32NumEntriesMax;
+        cb->uint32StartPageIdMin = sfcb_slot_adr(self, cb, (self->uint32IterLo + 1) % cb->uint32NumEntriesMax);
+    }
+    cb->uint32NumEntries = (cb->uint32IdNumMax - cb->uint32IdNumMin + 1);
+    sfcb_mkcb_qdone(self);
+}
+
+
+
+/**
+ *  @brief add commit
+ *
+ *  updates management data in RAM after the element in the write
+ *  slot is completely written, header and footer
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[in,out]  cb                  queue, #t_sfcb_cb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_add_commit(t_sfcb *self, t_sfcb_cb *cb)
+{
+    ++(cb->uint32IdNumMax);
+    cb->uint32StartPageIdMax = cb->uint32StartPageWrite;
+    if ( 0 == cb->uint32NumEntries ) {
+        cb->uint32IdNumMin = cb->uint32IdNumMax;
+        cb->uint32StartPageIdMin = cb->uint32StartPageWrite;
+    }
+    ++(cb->uint32NumEntries);
+    cb->uint32StartPageWrite = sfcb_slot_adr(self, cb, (sfcb_slot_num(self, cb, cb->uint32StartPageWrite) + 1) % cb->uint32NumEntriesMax);
+    cb->uint16PlFlashOfs = 0;
+    cb->uint32CrcWr = 0;
+}
+
+
+
+/**
+ *  @brief close element
+ *
+ *  marks payload of open element as complete, the next #sfcb_worker ADD
+ *  cycle writes the footer. Erased payload bytes are part of the CRC.
+ *
+ *  @param[in,out]  cb                  circular buffer queue, #t_sfcb_cb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_add_close(t_sfcb_cb *cb)
+{
+    /** Variables **/
+    static const uint8_t    uint8Erased[16] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+    uint32_t                uint32Len;  // not programmed payload bytes
+
+    if ( 0 != cb->uint8Crc ) {
+        uint32Len = (uint32_t) (cb->uint16PlSize + sizeof(spi_flash_cb_elem_head) - cb->uint16PlFlashOfs);
+        while ( 0 != uint32Len ) {
+            cb->uint32CrcWr = sfcb_crc32(cb->uint32CrcWr, uint8Erased, sfcb_min(uint32Len, (uint32_t) sizeof(uint8Erased)));
+            uint32Len -= sfcb_min(uint32Len, (uint32_t) sizeof(uint8Erased));
+        }
+    }
+    cb->uint16PlFlashOfs = (uint16_t) (cb->uint16PlSize + sizeof(spi_flash_cb_elem_head));
+}
+
+
+
+/**
+ *  @brief stage flush
+ *
+ *  starts page program of the staged bytes of the queue, see #sfcb_stage_cfg.
+ *  The staging buffer is used by the worker until the job is done.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      foot                non zero: write footer after staged bytes, see #sfcb_add_done
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_stage_flush(t_sfcb *self, uint8_t cbID, uint8_t foot)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[cbID]);   // staged queue
+
+    sfcb_log_info("  INFO:%s: cb=%d, staged=%d, foot=%d\n", __FUNCTION__, cbID, cb->uint16StageLen, foot);
+    self->uint8IterCb = cbID;   // used as pointer to queue
+    self->uint32IterAdr = cb->uint32StartPageWrite + cb->uint16PlFlashOfs;   // select page for write
+    self->ptrCbElemPl = cb->ptrStage;
+    self->uint16CbElemPlSize = cb->uint16StageLen;
+    self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
+    self->uint16BatchNum = 0;   // single record
+    self->uint8AddFoot = foot;
+    self->ptrCbElemPlNext = NULL;
+    cb->uint16StageLen = 0;
+    /* Setup new Job */
+    self->uint8Busy = 1;
+    self->cmd = SFCB_CMD_ADD;
+    self->stage = SFCB_STG00;
+    self->error = SFCB_E_NOERO;
+}
+
+
+
+/**
+ *  @brief stage select
+ *
+ *  finds queue with staged bytes older than the staging timeout and
+ *  starts their page program, see #sfcb_stage_cfg
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   page program started
+ *  @retval         -1                  nothing to program
+ *  @since          2026-10-14
+ */
+static int sfcb_stage_sel(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb;         // queue
+
+    if ( NULL == self->ptrTick ) {
+        return -1;  // no time base
+    }
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        cb = &((self->ptrCbs)[i]);
+        /* all active circular buffer queues processed? */
+        if ( 0 == cb->uint8Used ) {
+            break;
+        }
+        if (    (0 == cb->uint8MgmtValid) || (0 == cb->uint16StageLen) || (0 == cb->uint32StageUs)
+             || ((self->ptrTick() - cb->uint32StageTick) < sfcb_ceildivide_uint32(cb->uint32StageUs, self->uint32TickUs))
+        ) {
+            continue;
+        }
+        sfcb_stage_flush(self, i, 0);
+        return 0;
+    }
+    return -1;
+}
+
+
+
+/**
+ *  @brief stage wait
+ *
+ *  checks for staged bytes, which are programmed after timeout by the idle worker
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   no staging timeout pending
+ *  @retval         1                   staging timeout pending
+ *  @since          2026-10-14
+ */
+static int sfcb_stage_wait(t_sfcb *self)
+{
+    if ( NULL == self->ptrTick ) {
+        return 0;   // no time base
+    }
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        if ( 0 == ((self->ptrCbs)[i]).uint8Used ) {
+            break;
+        }
+        if ( (0 != ((self->ptrCbs)[i]).uint16StageLen) && (0 != ((self->ptrCbs)[i]).uint32StageUs) ) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief stage add
+ *
+ *  collects append in staging buffer of queue, see #sfcb_stage_cfg.
+ *  Program starts if the staged bytes reach a page end or complete the payload.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      data                appended bytes
+ *  @param[in]      len                 number of appended bytes
+ *  @param[out]     ret                 return code of #sfcb_add
+ *  @return         int                 state
+ *  @retval         0                   append handled, see ret
+ *  @retval         -1                  append larger then staging buffer, program directly
+ *  @since          2026-10-14
+ */
+static int sfcb_stage_add(t_sfcb *self, uint8_t cbID, void *data, uint16_t len, int *ret)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[cbID]);   // staged queue
+    uint32_t    uint32PlWr; // committed payload bytes
+    uint32_t    uint32Adr;  // flash address of first staged byte
+
+    /* nothing staged, append exceeds buffer */
+    if ( (0 == cb->uint16StageLen) && (len > cb->uint16StageMax) ) {
+        return -1;
+    }
+    /* no space left, program staged bytes and append in one job */
+    if ( (cb->uint16StageLen + (uint32_t) len) > cb->uint16StageMax ) {
+        sfcb_stage_flush(self, cbID, 0);
+        self->ptrCbElemPlNext = data;
+        self->uint16CbElemPlNextSize = len;
+        sfcb_job_set(&(self->jobAct), SFCB_API_ADD, cbID, 0, data, len);
+        *ret = SFCB_OK;
+        return 0;
+    }
+    /* collect */
+    if ( (0 == cb->uint16StageLen) && (NULL != self->ptrTick) ) {
+        cb->uint32StageTick = self->ptrTick();  // age of oldest staged byte
+    }
+    memcpy(cb->ptrStage+cb->uint16StageLen, data, len);
+    cb->uint16StageLen = (uint16_t) (cb->uint16StageLen + len);
+    *ret = SFCB_OK;
+    /* payload complete or page end reached? */
+    uint32PlWr = (0 == cb->uint16PlFlashOfs) ? 0 : (uint32_t) (cb->uint16PlFlashOfs - sizeof(spi_flash_cb_elem_head));
+    uint32Adr = cb->uint32StartPageWrite + (uint32_t) sizeof(spi_flash_cb_elem_head) + uint32PlWr;
+    if (    ((uint32PlWr + cb->uint16StageLen) < cb->uint16PlSize)
+         && ((uint32Adr / SFCB_FL_TOPO_PAGE_SIZE(self)) == ((uint32Adr + cb->uint16StageLen) / SFCB_FL_TOPO_PAGE_SIZE(self)))
+    ) {
+        return 0;   // keep in RAM
+    }
+    sfcb_stage_flush(self, cbID, 0);
+    sfcb_job_set(&(self->jobAct), SFCB_API_ADD, cbID, 0, data, len);
+    return 0;
+}
+
+
+
+/**
+ *  @brief add page
+ *
+ *  appends the payload bytes of the current flash page to the page program
+ *  packet. If the payload of the element is complete and the footer is placed in
+ *  the same page, the erased gap and the footer are appended too. Saves the
+ *  separate footer program, #sfcb_add_done has nothing to do.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      foot                footer, equal to header
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_add_page(t_sfcb *self, const spi_flash_cb_elem_head *foot)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);  // written queue
+    uint32_t    uint32PageEnd;  // first address of next page
+    uint32_t    uint32FootAdr;  // footer address
+    uint16_t    uint16CpyLen;   // number of payload bytes
+
+    /* payload bytes in page */
+    uint32PageEnd = (self->uint32IterAdr & (uint32_t) ~(SFCB_FL_TOPO_PAGE_SIZE(self) - 1)) + SFCB_FL_TOPO_PAGE_SIZE(self);
+    /* packed queue: record header in front of record, record and element share page */
+    if ( (0 != cb->uint16RecSize) && (0 == self->uint16Iter) ) {
+        self->uint8PtrSpi[self->uint16SpiLen] = SFCB_REC_VALID;
+        self->uint16SpiLen = (uint16_t) (self->uint16SpiLen + SFCB_REC_HEAD_SIZE);
+        cb->uint16PlFlashOfs = (uint16_t) (cb->uint16PlFlashOfs + SFCB_REC_HEAD_SIZE);
+        self->uint32IterAdr += SFCB_REC_HEAD_SIZE;
+    }
+    uint16CpyLen = (uint16_t) sfcb_min(uint32PageEnd - self->uint32IterAdr, (uint32_t) (self->uint16CbElemPlSize - self->uint16Iter));
+    memcpy(self->uint8PtrSpi+self->uint16SpiLen, ((uint8_t*) self->ptrCbElemPl)+self->uint16Iter, uint16CpyLen);
+    if ( 0 != cb->uint8Crc ) {
+        cb->uint32CrcWr = sfcb_crc32(cb->uint32CrcWr, self->uint8PtrSpi+self->uint16SpiLen, uint16CpyLen);
+    }
+    self->uint16SpiLen = (uint16_t) (self->uint16SpiLen + uint16CpyLen);
+    self->uint16Iter = (uint16_t) (self->uint16Iter + uint16CpyLen);
+    cb->uint16PlFlashOfs = (uint16_t) (cb->uint16PlFlashOfs + uint16CpyLen);    // payload internal flash offset
+    self->uint32IterAdr += uint16CpyLen;
+    /* payload complete and footer in same page */
+    uint32FootAdr = cb->uint32StartPageWrite + cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self) - (uint32_t) sizeof(*foot);
+    if ( (cb->uint16PlFlashOfs == (cb->uint16PlSize + sizeof(*foot))) && (uint32FootAdr < uint32PageEnd) ) {
+        sfcb_log_info("  INFO:%s: footer merged, adr=0x%x\n", __FUNCTION__, uint32FootAdr);
+        memset(self->uint8PtrSpi+self->uint16SpiLen, 0xff, uint32FootAdr - self->uint32IterAdr);   // keep erased
+        self->uint16SpiLen = (uint16_t) (self->uint16SpiLen + uint32FootAdr - self->uint32IterAdr);
+        memcpy(self->uint8PtrSpi+self->uint16SpiLen, foot, sizeof(*foot));
+        if ( 0 != cb->uint8Crc ) {
+            memcpy(self->uint8PtrSpi+self->uint16SpiLen+offsetof(spi_flash_cb_elem_head, uint32MagicNum), &(cb->uint32CrcWr), sizeof(cb->uint32CrcWr));
+        }
+        self->uint16SpiLen = (uint16_t) (self->uint16SpiLen + sizeof(*foot));
+        ++(cb->uint16PlFlashOfs);   // footer written
+        self->uint32IterAdr = uint32PageEnd;
+    }
+}
+
+
+
+/**
+ *  @brief varint put
+ *
+ *  appends unsigned value with seven bits per byte, lowest group first
+ *
+ *  @param[out]     code                code buffer
+ *  @param[in]      codeMax             size of code buffer in bytes
+ *  @param[in,out]  len                 used bytes in code buffer
+ *  @param[in]      val                 value
+ *  @return         int                 state
+ *  @retval         0                   value appended
+ *  @retval         -1                  code buffer exceeded
+ *  @since          2026-10-14
+ */
+static int sfcb_codec_put(uint8_t *code, uint16_t codeMax, uint32_t *len, uint32_t val)
+{
+    do {
+        if ( !(*len < codeMax) ) {
+            return -1;
+        }
+        code[(*len)++] = (uint8_t) ((val & 0x7f) | ((val > 0x7f) ? 0x80 : 0));
+        val >>= 7;
+    } while ( 0 != val );
+    return 0;
+}
+
+
+
+/**
+ *  @brief varint get
+ *
+ *  reads unsigned value written by #sfcb_codec_put, limited to 16bit
+ *
+ *  @param[in]      code                code buffer
+ *  @param[in]      codeLen             number of bytes in code buffer
+ *  @param[in,out]  pos                 read position in code buffer
+ *  @param[out]     val                 value
+ *  @return         int                 state
+ *  @retval         0                   value read
+ *  @retval         -1                  truncated or too large value
+ *  @since          2026-10-14
+ */
+static int sfcb_codec_get(const uint8_t *code, uint16_t codeLen, uint32_t *pos, uint32_t *val)
+{
+    *val = 0;
+    for ( uint8_t uint8Shift = 0; uint8Shift < 21; uint8Shift = (uint8_t) (uint8Shift + 7) ) {
+        if ( !(*pos < codeLen) ) {
+            return -1;
+        }
+        *val |= (uint32_t) (code[*pos] & 0x7f) << uint8Shift;
+        if ( 0 == (code[(*pos)++] & 0x80) ) {
+            return (*val > __UINT16_MAX__) ? -1 : 0;
+        }
+    }
+    return -1;
+}
+
+
+
+/**
+ *  @brief built-in encoder
+ *
+ *  delta encoding of record against reference. Unchanged bytes are skipped, every
+ *  run of changed bytes is stored as varint skip count, varint byte count and the
+ *  changed bytes. Runs are split at four unchanged bytes, trailing unchanged bytes
+ *  are not stored. An unchanged record has no code, the code is at most
+ *  #SFCB_CODEC_HEAD bytes larger than the record.
+ *
+ *  @param[in]      ref                 reference record
+ *  @param[in]      rec                 record
+ *  @param[in]      recSize             record size in bytes
+ *  @param[out]     code                encoded record
+ *  @param[in]      codeMax             size of code in bytes
+ *  @return         int                 number of code bytes, negative if codeMax exceeded
+ *  @since          2026-10-14
+ */
+static int sfcb_codec_enc(const uint8_t *ref, const uint8_t *rec, uint16_t recSize, uint8_t *code, uint16_t codeMax)
+{
+    /** Variables **/
+    uint32_t    uint32Len = 0;  // code length
+    uint32_t    uint32Pos = 0;  // record position
+    uint32_t    uint32Chg;      // first changed byte
+    uint32_t    uint32End;      // end of changed run
+    uint32_t    uint32Same;     // unchanged bytes at end of run
+
+    while ( uint32Pos < recSize ) {
+        /* unchanged bytes */
+        for ( uint32Chg = uint32Pos; (uint32Chg < recSize) && (ref[uint32Chg] == rec[uint32Chg]); uint32Chg++ ) { }
+        if ( !(uint32Chg < recSize) ) {
+            break;  // trailing unchanged bytes
+        }
+        /* changed run, ends with four unchanged bytes */
+        uint32Same = 0;
+        for ( uint32End = uint32Chg; (uint32End < recSize) && (uint32Same < 4); uint32End++ ) {
+            uint32Same = (ref[uint32End] == rec[uint32End]) ? (uint32Same + 1) : 0;
+        }
+        uint32End -= uint32Same;
+        if (    (0 != sfcb_codec_put(code, codeMax, &uint32Len, uint32Chg - uint32Pos))
+             || (0 != sfcb_codec_put(code, codeMax, &uint32Len, uint32End - uint32Chg))
+             || ((uint32Len + uint32End - uint32Chg) > codeMax)
+        ) {
+            return -1;
+        }
+        memcpy(code+uint32Len, rec+uint32Chg, uint32End - uint32Chg);
+        uint32Len += uint32End - uint32Chg;
+        uint32Pos = uint32End;
+    }
+    return (int) uint32Len;
+}
+
+
+
+/**
+ *  @brief built-in decoder
+ *
+ *  applies the changed byte runs of #sfcb_codec_enc to the reference record
+ *
+ *  @param[in,out]  rec                 reference record, decoded record
+ *  @param[in]      recSize             record size in bytes
+ *  @param[in]      code                encoded record
+ *  @param[in]      codeLen             number of code bytes
+ *  @return         int                 zero if code is valid
+ *  @since          2026-10-14
+ */
+static int sfcb_codec_dec(uint8_t *rec, uint16_t recSize, const uint8_t *code, uint16_t codeLen)
+{
+    /** Variables **/
+    uint32_t    uint32Pos = 0;  // code position
+    uint32_t    uint32Rec = 0;  // record position
+    uint32_t    uint32Skip;     // unchanged bytes
+    uint32_t    uint32Num;      // changed bytes
+
+    while ( uint32Pos < codeLen ) {
+        if (    (0 != sfcb_codec_get(code, codeLen, &uint32Pos, &uint32Skip))
+             || (0 != sfcb_codec_get(code, codeLen, &uint32Pos, &uint32Num))
+             || ((uint32Rec + uint32Skip + uint32Num) > recSize)
+             || ((uint32Pos + uint32Num) > codeLen)
+        ) {
+            return -1;
+        }
+        memcpy(rec+uint32Rec+uint32Skip, code+uint32Pos, uint32Num);
+        uint32Rec += uint32Skip + uint32Num;
+        uint32Pos += uint32Num;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief built-in codec
+ *
+ *  delta encoding with varint run lengths, selected by #sfcb_codec_cfg without codec
+ *
+ *  @since  2026-10-14
+ */
+static const t_sfcb_codec g_sfcbCodecDelta = { .enc = sfcb_codec_enc, .dec = sfcb_codec_dec };
+
+
+
+/**
+ *  @brief codec add
+ *
+ *  encodes record and starts its page program behind the last record of the open
+ *  element, the first record opens the element. If the remaining payload can not
+ *  take a worst case encoded record, the footer is written with the record.
+ *  The record becomes the reference of the next record in #sfcb_job_done.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      data                record
+ *  @param[in]      len                 record size in bytes
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted
+ *  @retval         #SFCB_E_MEM         len unequal record size, or code exceeds payload
+ *  @since          2026-10-14
+ */
+static int sfcb_codec_add(t_sfcb *self, uint8_t cbID, void *data, uint16_t len)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[cbID]);   // written queue
+    uint8_t*    uint8PtrRef = cb->ptrCodecBuf;  // previous record of element
+    uint8_t*    uint8PtrCode = cb->ptrCodecBuf + 2 * (uint32_t) cb->uint16CodecRec;    // record header, code length, code
+    uint8_t     uint8Head[SFCB_CODEC_HEAD]; // record header and code length
+    uint32_t    uint32Head = 1;     // bytes in front of code
+    uint32_t    uint32Free;         // free payload bytes
+    int         intCode;            // code length
+
+    if ( len != cb->uint16CodecRec ) {
+        sfcb_log_ero("  ERROR:%s: len=%d unequal record size=%d\n", __FUNCTION__, len, cb->uint16CodecRec);
+        return SFCB_E_MEM;
+    }
+    /* first record of element against zeros */
+    if ( 0 == cb->uint16PlFlashOfs ) {
+        memset(uint8PtrRef, 0, cb->uint16CodecRec);
+    }
+    intCode = cb->ptrCodec->enc(uint8PtrRef, data, len, uint8PtrCode+SFCB_CODEC_HEAD, (uint16_t) (cb->uint16CodecMax - SFCB_CODEC_HEAD));
+    uint8Head[0] = SFCB_REC_VALID;
+    if ( (intCode < 0) || (intCode > (cb->uint16CodecMax - SFCB_CODEC_HEAD)) || (0 != sfcb_codec_put(uint8Head, sizeof(uint8Head), &uint32Head, (uint32_t) intCode)) ) {
+        sfcb_log_ero("  ERROR:%s: code exceeds %d bytes\n", __FUNCTION__, cb->uint16CodecMax - SFCB_CODEC_HEAD);
+        return SFCB_E_MEM;
+    }
+    uint8PtrCode += SFCB_CODEC_HEAD - uint32Head;
+    memcpy(uint8PtrCode, uint8Head, uint32Head);
+    /* free payload */
+    uint32Free = (0 == cb->uint16PlFlashOfs) ? cb->uint16PlSize : (uint32_t) (cb->uint16PlSize + sizeof(spi_flash_cb_elem_head) - cb->uint16PlFlashOfs);
+    if ( (uint32Head + (uint32_t) intCode) > uint32Free ) {
+        sfcb_log_ero("  ERROR:%s: code exceeds payload\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    sfcb_log_info("  INFO:%s: cb=%d, record=%d, code=%d\n", __FUNCTION__, cbID, len, intCode);
+    /* store information for insertion */
+    self->uint8IterCb = cbID;   // used as pointer to queue
+    self->uint32IterAdr = cb->uint32StartPageWrite + cb->uint16PlFlashOfs;  // select page for write
+    self->ptrCbElemPl = uint8PtrCode;
+    self->uint16CbElemPlSize = (uint16_t) (uint32Head + (uint32_t) intCode);
+    self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
+    self->uint16BatchNum = 0;   // single record
+    self->uint8AddFoot = (uint8_t) ((uint32Free - self->uint16CbElemPlSize) < cb->uint16CodecMax);  // element full, forced footer
+    self->ptrCbElemPlNext = NULL;
+    /* Setup new Job */
+    self->uint8Busy = 1;
+    self->cmd = SFCB_CMD_ADD;
+    self->stage = SFCB_STG00;
+    self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_ADD, cbID, 0, data, len);
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  @brief codec reset
+ *
+ *  prepares record decoder for the first record of an element
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_codec_rst(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);  // read queue
+
+    self->uint8DecSt = SFCB_DEC_HEAD;
+    self->uint16DecNum = 0;
+    memset(cb->ptrCodecBuf+cb->uint16CodecRec, 0, cb->uint16CodecRec);  // first record is encoded against zeros
+}
+
+
+
+/**
+ *  @brief codec read
+ *
+ *  parses payload chunk of element with encoded records. Complete records are
+ *  decoded, #sfcb_iter hands every record to the iterator callback.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      data                payload chunk
+ *  @param[in]      len                 number of bytes in chunk
+ *  @return         int                 state
+ *  @retval         0                   chunk processed
+ *  @retval         -1                  invalid record
+ *  @since          2026-10-14
+ */
+static int sfcb_codec_rd(t_sfcb *self, const uint8_t *data, uint32_t len)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);      // read queue
+    uint8_t*    uint8PtrRec = cb->ptrCodecBuf + cb->uint16CodecRec;     // decoded record
+    uint8_t*    uint8PtrCode = uint8PtrRec + cb->uint16CodecRec;        // collected code
+    uint32_t    uint32Cpy;  // processed bytes
+
+    while ( (0 != len) && (self->uint8DecSt < SFCB_DEC_END) ) {
+        uint32Cpy = 1;
+        switch (self->uint8DecSt) {
+            /* written or erased record */
+            case SFCB_DEC_HEAD:
+                self->uint8DecSt = (SFCB_REC_VALID == data[0]) ? SFCB_DEC_LEN : SFCB_DEC_END;
+                self->uint8DecShift = 0;
+                self->uint16DecLen = 0;
+                self->uint16DecPos = 0;
+                break;
+            /* code length */
+            case SFCB_DEC_LEN:
+                if (    (self->uint8DecShift > 14)
+                     || ((self->uint16DecLen | ((uint32_t) (data[0] & 0x7f) << self->uint8DecShift)) > (uint32_t) (cb->uint16CodecMax - SFCB_CODEC_HEAD))
+                ) {
+                    self->uint8DecSt = SFCB_DEC_ERO;
+                    break;
+                }
+                self->uint16DecLen = (uint16_t) (self->uint16DecLen | ((uint32_t) (data[0] & 0x7f) << self->uint8DecShift));
+                self->uint8DecShift = (uint8_t) (self->uint8DecShift + 7);
+                if ( 0 == (data[0] & 0x80) ) {
+                    self->uint8DecSt = SFCB_DEC_CODE;
+                }
+                break;
+            /* code */
+            default:
+                uint32Cpy = sfcb_min(len, (uint32_t) (self->uint16DecLen - self->uint16DecPos));
+                memcpy(uint8PtrCode+self->uint16DecPos, data, uint32Cpy);
+                self->uint16DecPos = (uint16_t) (self->uint16DecPos + uint32Cpy);
+                break;
+        }
+        data += uint32Cpy;
+        len -= uint32Cpy;
+        /* record complete */
+        if ( (SFCB_DEC_CODE == self->uint8DecSt) && (self->uint16DecPos == self->uint16DecLen) ) {
+            if ( 0 != cb->ptrCodec->dec(uint8PtrRec, cb->uint16CodecRec, uint8PtrCode, self->uint16DecLen) ) {
+                self->uint8DecSt = SFCB_DEC_ERO;
+                break;
+            }
+            if ( SFCB_CMD_ITER == self->cmd ) {
+                self->ptrIter(self->ptrIterArg, self->uint32ItId, self->uint16DecNum, uint8PtrRec, cb->uint16CodecRec);
+            }
+            ++(self->uint16DecNum);
+            self->uint8DecSt = SFCB_DEC_HEAD;
+        }
+    }
+    if ( SFCB_DEC_ERO == self->uint8DecSt ) {
+        sfcb_log_ero("  ERROR:%s: invalid record=%d\n", __FUNCTION__, self->uint16DecNum);
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief iterator request
+ *
+ *  requests next read of element iterator. The read covers the contiguous
+ *  stream of payload, footer and following elements up to the next erased
+ *  gap between payload and footer, the queue end or the chunk size.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   all elements read
+ *  @retval         -1                  SPI transfer is required
+ *  @since          2026-10-14
+ */
+static int sfcb_iter_req(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &((self->ptrCbs)[self->uint8IterCb]);  // iterated queue
+    uint32_t    uint32Elem = cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self);  // element size
+    uint32_t    uint32PlEnd = cb->uint16PlSize + (uint32_t) sizeof(spi_flash_cb_elem_head);     // end of payload in element
+    uint32_t    uint32Foot = uint32Elem - (uint32_t) sizeof(spi_flash_cb_elem_head);            // footer offset in element
+    uint32_t    uint32Ofs;  // offset in element
+    uint32_t    uint32Slot; // element slot
+    uint32_t    uint32Num;  // pending elements
+    uint32_t    uint32Len;  // contiguous bytes
+
+    /* all done */
+    if ( 0 == self->uint32ItNum ) {
+        return 0;
+    }
+    /* skip erased gap */
+    if ( (self->uint32ItOfs >= uint32PlEnd) && (self->uint32ItOfs < uint32Foot) ) {
+        self->uint32ItOfs = uint32Foot;
+    }
+    /* contiguous stream */
+    uint32Ofs = self->uint32ItOfs;
+    uint32Slot = self->uint32ItSlot;
+    uint32Num = self->uint32ItNum;
+    uint32Len = 0;
+    while ( uint32Len < self->uint16RdChunk ) {
+        /* payload followed by gap */
+        if ( (uint32Ofs < uint32PlEnd) && (uint32PlEnd < uint32Foot) ) {
+            uint32Len += uint32PlEnd - uint32Ofs;
+            break;
+        }
+        /* till element end, go on with next element if not wrapped */
+        uint32Len += uint32Elem - uint32Ofs;
+        uint32Ofs = 0;
+        --uint32Num;
+        ++uint32Slot;
+        if ( (0 == uint32Num) || !(uint32Slot < cb->uint32NumEntriesMax) ) {
+            break;
+        }
+    }
+    uint32Len = sfcb_min(uint32Len, self->uint16RdChunk);
+    /* assemble packet */
+    sfcb_rd_req(self, sfcb_slot_adr(self, cb, self->uint32ItSlot) + self->uint32ItOfs, uint32Len);
+    sfcb_log_info("  INFO:%s: id=0x%x, slot=%d, ofs=%d, len=%d\n", __FUNCTION__, self->uint32ItId, self->uint32ItSlot, self->uint32ItOfs, uint32Len);
+    return -1;
+}
+
+
+
+/**
+ *  @brief iterator records
+ *
+ *  splits payload chunk of packed queue element into records, hands
+ *  written records to the iterator callback and skips free record slots
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      data                payload chunk, starts at #t_sfcb::uint32ItOfs
+ *  @param[in]      len                 number of bytes in chunk
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_iter_rec(t_sfcb *self, const uint8_t *data, uint32_t len)
+{
+    /** Variables **/
+    t_sfcb_cb*      cb = &((self->ptrCbs)[self->uint8IterCb]);                          // iterated queue
+    const uint32_t  uint32Slot = (uint32_t) (cb->uint16RecSize + SFCB_REC_HEAD_SIZE);   // record slot size
+    uint32_t        uint32Ofs = self->uint32ItOfs - (uint32_t) sizeof(spi_flash_cb_elem_head);  // offset in payload
+    uint32_t        uint32Pos;  // offset in record slot
+    uint32_t        uint32Cpy;  // processed bytes
+    uint32_t        uint32Id;   // record id
+
+    while ( 0 != len ) {
+        uint32Pos = uint32Ofs % uint32Slot;
+        /* record header */
+        if ( uint32Pos < SFCB_REC_HEAD_SIZE ) {
+            self->uint8ItRec = data[0];
+            uint32Cpy = SFCB_REC_HEAD_SIZE;
+        /* record */
+        } else {
+            uint32Cpy = sfcb_min(len, uint32Slot - uint32Pos);
+            if ( SFCB_REC_VALID == self->uint8ItRec ) {
+                uint32Id = (self->uint32ItId - 1) * (cb->uint16PlSize / uint32Slot) + uint32Ofs / uint32Slot + 1;
+                self->ptrIter(self->ptrIterArg, uint32Id, (uint16_t) (uint32Pos - SFCB_REC_HEAD_SIZE), data, (uint16_t) uint32Cpy);
+                if ( (uint32Pos + uint32Cpy) == uint32Slot ) {
+                    self->ptrIter(self->ptrIterArg, uint32Id, cb->uint16RecSize, NULL, 0); // record complete
+                }
+            }
+        }
+        uint32Ofs += uint32Cpy;
+        data += uint32Cpy;
+        len -= uint32Cpy;
+    }
+}
+
+
+
+/**
+ *  @brief iterator evaluate
+ *
+ *  parses read stream of element iterator, checks header/footer and
+ *  hands the payload to the iterator callback
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   stream valid
+ *  @retval         -1                  invalid element header or footer
+ *  @retval         -2                  payload CRC mismatch, see #sfcb_crc_cfg
+ *  @retval         -3                  invalid encoded record, see #sfcb_codec_cfg
+ *  @since          2026-10-14
+ */
+static int sfcb_iter_eval(t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_cb*      cb = &((self->ptrCbs)[self->uint8IterCb]);  // iterated queue
+    uint32_t        uint32Elem = cb->uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self);  // element size
+    uint32_t        uint32PlEnd = cb->uint16PlSize + (uint32_t) sizeof(spi_flash_cb_elem_head);     // end of payload in element
+    uint32_t        uint32Foot = uint32Elem - (uint32_t) sizeof(spi_flash_cb_elem_head);            // footer offset in element
+    const uint8_t*  uint8PtrDat = self->uint8PtrSpi + sfcb_rd_hdr(self);                        // skip instruction, address and dummy
+    uint32_t        uint32Len = (uint32_t) (self->uint16SpiLen - sfcb_rd_hdr(self));            // read bytes
+    uint32_t        uint32Cpy;  // processed bytes
+
+    while ( 0 != uint32Len ) {
+        /* header */
+        if ( self->uint32ItOfs < sizeof(spi_flash_cb_elem_head) ) {
+            uint32Cpy = sfcb_min(uint32Len, (uint32_t) sizeof(spi_flash_cb_elem_head) - self->uint32ItOfs);
+            memcpy(((uint8_t*) &(self->itHead)) + self->uint32ItOfs, uint8PtrDat, uint32Cpy);
+            if (    ((self->uint32ItOfs + uint32Cpy) == sizeof(spi_flash_cb_elem_head))
+                 && ((cb->uint32MagicNum != self->itHead.uint32MagicNum) || (self->uint32ItId != self->itHead.uint32IdNum))
+            ) {
+                sfcb_log_ero("  ERROR:%s: slot=%d, header exp,id=0x%x, is,id=0x%x\n", __FUNCTION__, self->uint32ItSlot, self->uint32ItId, self->itHead.uint32IdNum);
+                return -1;
+            }
+            self->uint32CrcRd = 0;
+            if ( NULL != cb->ptrCodec ) {
+                sfcb_codec_rst(self);
+            }
+        /* payload */
+        } else if ( self->uint32ItOfs < uint32PlEnd ) {
+            uint32Cpy = sfcb_min(uint32Len, uint32PlEnd - self->uint32ItOfs);
+            if ( 0 != cb->uint8Crc ) {
+                self->uint32CrcRd = sfcb_crc32(self->uint32CrcRd, uint8PtrDat, uint32Cpy);
+            }
+            if ( 0 != cb->uint16RecSize ) {
+                sfcb_iter_rec(self, uint8PtrDat, uint32Cpy);
+            } else if ( NULL != cb->ptrCodec ) {
+                if ( 0 != sfcb_codec_rd(self, uint8PtrDat, uint32Cpy) ) {
+                    return -3;
+                }
+            } else {
+                self->ptrIter(self->ptrIterArg, self->uint32ItId, (uint16_t) (self->uint32ItOfs - sizeof(spi_flash_cb_elem_head)), uint8PtrDat, (uint16_t) uint32Cpy);
+            }
+        /* erased gap */
+        } else if ( self->uint32ItOfs < uint32Foot ) {
+            uint32Cpy = sfcb_min(uint32Len, uint32Foot - self->uint32ItOfs);
+        /* footer */
+        } else {
+            uint32Cpy = sfcb_min(uint32Len, uint32Elem - self->uint32ItOfs);
+            memcpy(((uint8_t*) &(self->itHead)) + (self->uint32ItOfs - uint32Foot), uint8PtrDat, uint32Cpy);
+            if ( (self->uint32ItOfs + uint32Cpy) == uint32Elem ) {
+                if ( self->uint32ItId != self->itHead.uint32IdNum ) {
+                    sfcb_log_ero("  ERROR:%s: slot=%d, footer exp,id=0x%x, is,id=0x%x\n", __FUNCTION__, self->uint32ItSlot, self->uint32ItId, self->itHead.uint32IdNum);
+                    return -1;
+                }
+                if ( (0 != cb->uint8Crc) && (self->uint32CrcRd != self->itHead.uint32MagicNum) ) {
+                    sfcb_log_ero("  ERROR:%s: slot=%d, payload CRC exp=0x%x, is=0x%x\n", __FUNCTION__, self->uint32ItSlot, self->itHead.uint32MagicNum, self->uint32CrcRd);
+                    return -2;
+                }
+                if ( (0 == cb->uint8Crc) && (cb->uint32MagicNum != self->itHead.uint32MagicNum) ) {
+                    sfcb_log_ero("  ERROR:%s: slot=%d, footer magic=0x%x\n", __FUNCTION__, self->uint32ItSlot, self->itHead.uint32MagicNum);
+                    return -1;
+                }
+                if ( NULL != cb->ptrCodec ) {
+                    self->ptrIter(self->ptrIterArg, self->uint32ItId, self->uint16DecNum, NULL, 0); // element complete, number of records
+                } else if ( 0 == cb->uint16RecSize ) {
+                    self->ptrIter(self->ptrIterArg, self->uint32ItId, cb->uint16PlSize, NULL, 0);   // element complete
+                }
+                /* next element */
+                ++(self->uint32ItId);
+                --(self->uint32ItNum);
+                self->uint32ItSlot = (self->uint32ItSlot + 1) % cb->uint32NumEntriesMax;
+                self->uint32ItOfs = 0;
+                uint8PtrDat += uint32Cpy;
+                uint32Len -= uint32Cpy;
+                continue;
+            }
+        }
+        self->uint32ItOfs += uint32Cpy;
+        uint8PtrDat += uint32Cpy;
+        uint32Len -= uint32Cpy;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  sfcb_init
+ *    initializes handle
+ */
+int sfcb_init (t_sfcb *self, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen)
+{
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* check if provided flash type is valid */
+#ifndef SFCB_FLASH_RT_EN
+    if ( 0 == (sizeof(SFCB_FLASH_NAME) - 1) ) {
+        sfcb_log_ero("  ERROR:%s: no flash type selected\n", __FUNCTION__);
+        return SFCB_E_NO_FLASH; // no flash type selected, use proper compile switch
+    }
+#endif
+    self->ptrFlash = &g_sfcbFlashDefault;   // compile-time selected flash, see #sfcb_init_flash
+    self->xfer = g_sfcbXferSingle;
+    self->xferRd = g_sfcbXferSingle;    // Read Data
+    self->xferWr = g_sfcbXferSingle;    // Page Program
+    self->uint8IstRd = SFCB_FL_IST_RD_DATA(self);
+    self->uint8IstWr = SFCB_FL_IST_WR_PAGE(self);
+    sfcb_log_info("  INFO:%s: flash '%s' selected\n", __FUNCTION__, self->ptrFlash->charName);
+    /* set up list of flash circular buffers */
+    self->uint8NumCbs = cbLen;
+    self->uint16SpiLen = 0;
+    self->uint8Busy = 0;
+    self->cmd = SFCB_CMD_IDLE;  // free for request
+    self->stage = SFCB_STG00;
+    self->ptrCbs = (t_sfcb_cb*) cb;     // circular buffer element array
+    self->uint8PtrSpi = (uint8_t*) spi; // uint8 array
+    self->uint16SpiMax = spiLen;        // max array length
+    self->error = SFCB_E_NOERO;
+    self->ptrCbElemPl = NULL;
+    self->uint16CbElemPlSize = 0;
+    self->ptrCkpt = NULL;   // no checkpoint queue
+    self->uint8CkptCb = 0;
+    self->uint8EraseAct = 0;
+    self->uint8EraseSus = 0;
+    self->uint32EraseAdr = 0;
+    self->uint32EraseEnd = 0;
+    self->ptrJobs = NULL;   // no job queue
+    self->uint8JobMax = 0;
+    self->uint8JobRd = 0;
+    self->uint8JobCnt = 0;
+    self->uint8JobPop = 0;
+    self->jobAct.api = SFCB_API_NONE;
+    self->ptrJobDone = NULL;
+    self->ptrJobDoneArg = NULL;
+    self->uint16WipLen = 1; // one status byte per poll
+    self->ptrTick = NULL;   // poll on every worker call
+    self->uint32TickUs = 0;
+    self->uint32WipPollUs = 0;
+    self->uint32WipUs = 0;
+    self->uint32WipTick = 0;
+    self->ptrSink = NULL;   // no read sink
+    self->ptrSinkArg = NULL;
+    self->uint32RdLen = 0;
+    self->uint32RdIter = 0;
+    self->uint8RdCrc = 0;   // no payload CRC check
+    self->uint8RdDec = 0;   // no record decoder
+    self->uint8DecSt = 0;
+    self->uint8DecShift = 0;
+    self->uint16DecLen = 0;
+    self->uint16DecPos = 0;
+    self->uint16DecNum = 0;
+    self->uint32CrcRd = 0;
+    self->uint32CrcFoot = 0;
+    self->uint16RdChunk = (uint16_t) (self->uint16SpiMax - sfcb_rd_hdr(self));  // read chunk limited by spi buffer
+    self->ptrIter = NULL;   // no element iterator
+    self->ptrIterArg = NULL;
+    self->uint32ItId = 0;
+    self->uint32ItNum = 0;
+    self->uint32ItSlot = 0;
+    self->uint32ItOfs = 0;
+    self->uint16BatchNum = 0;
+    self->uint8AddFoot = 0;
+    self->ptrCbElemPlNext = NULL;
+    self->uint16CbElemPlNextSize = 0;
+    self->ptrSpiPp[0] = self->uint8PtrSpi;  // single buffer
+    self->ptrSpiPp[1] = NULL;
+    self->ptrSpiOut = self->uint8PtrSpi;
+    self->uint16SpiOut = 0;
+    self->uint8PpCur = 0;
+    self->uint8PpBsy[0] = 0;
+    self->uint8PpBsy[1] = 0;
+    self->uint8PpAhead = 0;
+    self->ptrTrace = NULL;  // no trace ring
+    self->uint16TraceMax = 0;
+    self->uint32TraceCnt = 0;
+    self->ptrStats = NULL;  // no performance counters
+    self->ptrWear = NULL;   // no erase cycle table
+    self->uint32WearNum = 0;
+    sfcb_ring_rst(self);    // no record ring
+    /* memory addresses */
+    sfcb_log_info("  INFO:%s:sfcb:spi_p            = %p\n", __FUNCTION__, self->uint8PtrSpi); // spi buffer
+    /* SPI buffer needs at least space for one page and address and instruction */
+    if ( (SFCB_FL_TOPO_PAGE_SIZE(self) + SFCB_FL_TOPO_ADR_BYTE(self) + 1) > self->uint16SpiMax ) {
+        sfcb_log_ero("  ERROR:%s: spi buffer to small, is=%d byte, req=%d byte\n", __FUNCTION__, self->uint16SpiMax, SFCB_FL_TOPO_PAGE_SIZE(self) + SFCB_FL_TOPO_ADR_BYTE(self) + 1);
+        return SFCB_E_MEM;  // not enough SPI buffer to write at least one complete page to flash
+    }
+    /* init circular buffer handles */
+    for ( uint8_t i = 0; i < (self->uint8NumCbs); i++ ) {
+        (self->ptrCbs[i]).uint8Used = 0;
+        (self->ptrCbs[i]).uint8MgmtValid = 0;
+        (self->ptrCbs[i]).uint8MgmtCkpt = 0;
+        sfcb_log_info("  INFO:%s:ptrCbs[%i]_p           = %p\n", __FUNCTION__, i, (&self->ptrCbs[i]));                    // unit test output
+        sfcb_log_info("  INFO:%s:ptrCbs[%i].uint8Used_p = %p\n", __FUNCTION__, i, &((self->ptrCbs[i]).uint8Used));        // output address
+        sfcb_log_info("  INFO:%s:ptrCbs[%i].uint8Init_p = %p\n", __FUNCTION__, i, &((self->ptrCbs[i]).uint8MgmtValid));   // output address
+    }
+    /* normal end */
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_init_flash
+ *    assigns flash descriptor
+ */
+int sfcb_init_flash (t_sfcb *self, const t_sfcb_flash *flash)
+{
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* plausible descriptor */
+    if (    (NULL == flash)
+         || (0 == flash->uint8AdrByte)
+         || (0 == flash->uint16PageSize)
+         || (0 == flash->uint32SectorSize)
+         || (0 != (flash->uint32SectorSize % flash->uint16PageSize))
+         || (flash->uint32FlashSize < flash->uint32SectorSize)
+         || ((0 != flash->uint8IstEraseBlk32) && ((0 == flash->uint32Blk32Size) || (0 != (flash->uint32Blk32Size % flash->uint32SectorSize))))
+         || ((0 != flash->uint8IstEraseBlk64) && ((0 == flash->uint32Blk64Size) || (0 != (flash->uint32Blk64Size % flash->uint32SectorSize))))
+    ) {
+        sfcb_log_ero("  ERROR:%s: invalid flash descriptor\n", __FUNCTION__);
+        return SFCB_E_NO_FLASH;
+    }
+#ifndef SFCB_FLASH_RT_EN
+    /* flash parameters are compile-time constants */
+    if (    (SFCB_FLASH_IST_WR_ENA != flash->uint8IstWrEna)
+         || (SFCB_FLASH_IST_ERASE_SECTOR != flash->uint8IstEraseSector)
+         || (SFCB_FLASH_IST_ERASE_BLK32 != flash->uint8IstEraseBlk32)
+         || (SFCB_FLASH_IST_ERASE_BLK64 != flash->uint8IstEraseBlk64)
+         || (SFCB_FLASH_IST_ERASE_SUSPEND != flash->uint8IstEraseSuspend)
+         || (SFCB_FLASH_IST_ERASE_RESUME != flash->uint8IstEraseResume)
+         || (SFCB_FLASH_IST_RD_STATE_REG != flash->uint8IstRdStateReg)
+         || (SFCB_FLASH_IST_RD_DATA != flash->uint8IstRdData)
+         || (SFCB_FLASH_IST_WR_PAGE != flash->uint8IstWrPage)
+         || (SFCB_FLASH_IST_WR_PAGE_QUAD != flash->uint8IstWrPageQuad)
+         || (SFCB_FLASH_IST_RD_FAST != flash->uint8IstRdFast)
+         || (SFCB_FLASH_IST_RD_DUAL != flash->uint8IstRdDual)
+         || (SFCB_FLASH_IST_RD_QUAD != flash->uint8IstRdQuad)
+         || (SFCB_FLASH_IST_RD_QUAD_IO != flash->uint8IstRdQuadIo)
+         || (SFCB_FLASH_TOPO_RD_FAST_DUMMY != flash->uint8RdFastDummy)
+         || (SFCB_FLASH_TOPO_RD_QIO_DUMMY != flash->uint8RdQioDummy)
+         || (SFCB_FLASH_TOPO_ADR_BYTE != flash->uint8AdrByte)
+         || (SFCB_FLASH_MNG_WIP_MSK != flash->uint8WipMsk)
+         || (SFCB_FLASH_MNG_RDSR_CONT != flash->uint8RdsrCont)
+         || (SFCB_FLASH_TOPO_PAGE_SIZE != flash->uint16PageSize)
+         || (SFCB_FLASH_TOPO_SECTOR_SIZE != flash->uint32SectorSize)
+         || (SFCB_FLASH_TOPO_BLK32_SIZE != flash->uint32Blk32Size)
+         || (SFCB_FLASH_TOPO_BLK64_SIZE != flash->uint32Blk64Size)
+         || (SFCB_FLASH_TOPO_FLASH_SIZE != flash->uint32FlashSize)
+         || (SFCB_FLASH_TIME_PAGE_PROG != flash->uint32TimePageProg)
+         || (SFCB_FLASH_TIME_ERASE_SECTOR != flash->uint32TimeEraseSector)
+         || (SFCB_FLASH_TIME_ERASE_BLK32 != flash->uint32TimeEraseBlk32)
+         || (SFCB_FLASH_TIME_ERASE_BLK64 != flash->uint32TimeEraseBlk64)
+    ) {
+        sfcb_log_ero("  ERROR:%s: flash '%s' differs from compile-time flash, build with SFCB_FLASH_RT_EN\n", __FUNCTION__, flash->charName);
+        return SFCB_E_NO_FLASH;
+    }
+#endif
+    /* geometry is fixed after queue creation */
+    if ( (0 != self->uint8Busy) || ((0 != self->uint8NumCbs) && (0 != (self->ptrCbs[0]).uint8Used)) ) {
+        sfcb_log_ero("  ERROR:%s: queues already created\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* SPI buffer needs at least space for one page and address and instruction */
+    if ( (flash->uint16PageSize + flash->uint8AdrByte + 1) > self->uint16SpiMax ) {
+        sfcb_log_ero("  ERROR:%s: spi buffer to small, is=%d byte, req=%d byte\n", __FUNCTION__, self->uint16SpiMax, flash->uint16PageSize + flash->uint8AdrByte + 1);
+        return SFCB_E_MEM;
+    }
+    self->ptrFlash = flash;
+    self->xferRd = g_sfcbXferSingle;    // instructions of new flash, single lane
+    self->xferWr = g_sfcbXferSingle;
+    self->uint8IstRd = SFCB_FL_IST_RD_DATA(self);
+    self->uint8IstWr = SFCB_FL_IST_WR_PAGE(self);
+    self->uint16RdChunk = (uint16_t) (self->uint16SpiMax - sfcb_rd_hdr(self));  // read chunk limited by spi buffer
+    sfcb_log_info("  INFO:%s: flash '%s' selected\n", __FUNCTION__, flash->charName);
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_flash_desc
+ *    descriptor of driven flash
+ */
+const t_sfcb_flash* sfcb_flash_desc (t_sfcb *self)
+{
+    return self->ptrFlash;
+}
+
+
+
+/**
+ *  sfcb_init_copy
+ *    copies mounted queues of idle handle for reads
+ */
+int sfcb_init_copy (t_sfcb *self, const t_sfcb *src, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen, void *codec, uint16_t codecLen)
+{
+    /** Variables **/
+    t_sfcb_cb*  cbCpy = (t_sfcb_cb*) cb;    // queue list of copy
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* idle source */
+    if ( (0 != src->uint8Busy) || (0 != src->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: source worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* queue list, spi and codec buffer */
+    if ( (cbLen < src->uint8NumCbs) || (spiLen < src->uint16SpiMax) ) {
+        sfcb_log_ero("  ERROR:%s: queue list or spi buffer to small\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    for ( uint8_t i = 0; i < src->uint8NumCbs; i++ ) {
+        if (    (NULL != ((src->ptrCbs)[i]).ptrCodec)
+             && ((NULL == codec) || (codecLen < (2 * (uint32_t) ((src->ptrCbs)[i]).uint16CodecRec + ((src->ptrCbs)[i]).uint16CodecMax)))
+        ) {
+            sfcb_log_ero("  ERROR:%s: codec buffer of cb=%d to small\n", __FUNCTION__, i);
+            return SFCB_E_MEM;
+        }
+    }
+    /* copy mounted state */
+    *self = *src;
+    memcpy(cbCpy, src->ptrCbs, src->uint8NumCbs * sizeof(t_sfcb_cb));
+    self->ptrCbs = cbCpy;
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        cbCpy[i].ptrStage = NULL;   // staged bytes stay in source
+        cbCpy[i].uint16StageLen = 0;
+        if ( NULL != cbCpy[i].ptrCodec ) {
+            cbCpy[i].ptrCodecBuf = (uint8_t*) codec;
+        }
+    }
+    /* own spi buffer, single buffer */
+    self->uint8PtrSpi = (uint8_t*) spi;
+    self->uint16SpiMax = spiLen;
+    self->uint16SpiLen = 0;
+    self->ptrSpiPp[0] = self->uint8PtrSpi;
+    self->ptrSpiPp[1] = NULL;
+    self->ptrSpiOut = self->uint8PtrSpi;
+    self->uint16SpiOut = 0;
+    self->uint8PpCur = 0;
+    self->uint8PpBsy[0] = 0;
+    self->uint8PpBsy[1] = 0;
+    self->uint8PpAhead = 0;
+    /* buffers of source are not shared */
+    self->error = SFCB_E_NOERO;
+    self->ptrCkpt = NULL;
+    self->ptrJobs = NULL;
+    self->uint8JobMax = 0;
+    self->uint8JobRd = 0;
+    self->uint8JobCnt = 0;
+    self->uint8JobPop = 0;
+    self->jobAct.api = SFCB_API_NONE;
+    self->ptrJobDone = NULL;
+    self->ptrJobDoneArg = NULL;
+    self->ptrSink = NULL;
+    self->ptrSinkArg = NULL;
+    self->ptrIter = NULL;
+    self->ptrIterArg = NULL;
+    self->ptrTrace = NULL;
+    self->uint16TraceMax = 0;
+    self->uint32TraceCnt = 0;
+    self->ptrStats = NULL;
+    self->ptrWear = NULL;
+    self->uint32WearNum = 0;
+    sfcb_ring_rst(self);
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_init_jobq
+ *    assigns job queue
+ */
+int sfcb_init_jobq (t_sfcb *self, void *jobs, uint8_t jobsLen, t_sfcb_done done, void *arg)
+{
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* assign */
+    self->ptrJobs = (t_sfcb_job*) jobs;
+    self->uint8JobMax = jobsLen;
+    self->uint8JobRd = 0;
+    self->uint8JobCnt = 0;
+    self->ptrJobDone = done;
+    self->ptrJobDoneArg = arg;
+    sfcb_log_info("  INFO:%s:jobs_p = %p, len=%d\n", __FUNCTION__, self->ptrJobs, self->uint8JobMax);
+    /* normal end */
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_init_ring
+ *    assigns lock-free record ring
+ */
+int sfcb_init_ring (t_sfcb *self, void *ring, uint32_t ringLen, uint16_t recMax)
+{
+#ifdef SFCB_RING_EN
+    /** Variables **/
+    uint32_t    uint32Stride;   // slot size
+    uint32_t    uint32Num;      // number of slots
+#endif
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* no jobs pending */
+    if ( 0 != sfcb_busy(self) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* disable */
+    sfcb_ring_rst(self);
+    if ( NULL == ring ) {
+        return SFCB_OK;
+    }
+#ifndef SFCB_RING_EN
+    (void) ringLen;
+    (void) recMax;
+    sfcb_log_ero("  ERROR:%s: record ring disabled, build with SFCB_RING_EN\n", __FUNCTION__);
+    return SFCB_E_MEM;
+#else
+    /* slots, power of two for wrapping positions */
+    uint32Stride = (uint32_t) SFCB_RING_SLOT((uint32_t) recMax);
+    if ( (0 != ((uintptr_t) ring & 3)) || (ringLen < 2 * uint32Stride) ) {
+        sfcb_log_ero("  ERROR:%s: ring unaligned or to small, len=%u, slot=%u\n", __FUNCTION__, ringLen, uint32Stride);
+        return SFCB_E_MEM;
+    }
+    uint32Num = 2;
+    while ( (uint32Num <= (__UINT32_MAX__ / 2)) && (2 * uint32Num <= ringLen / uint32Stride) ) {
+        uint32Num = 2 * uint32Num;
+    }
+    /* assign, slot i free for position i */
+    self->ptrRing = (uint8_t*) ring;
+    self->uint32RingNum = uint32Num;
+    self->uint32RingStride = uint32Stride;
+    self->uint16RingRec = recMax;
+    for ( uint32_t i = 0; i < uint32Num; i++ ) {
+        sfcb_ring_slot(self, i)->uint32Seq = i;
+    }
+    sfcb_log_info("  INFO:%s:ring_p = %p, slots=%u, stride=%u\n", __FUNCTION__, self->ptrRing, self->uint32RingNum, self->uint32RingStride);
+    /* normal end */
+    return SFCB_OK;
+#endif
+}
+
+
+
+/**
+ *  sfcb_ring_add
+ *    appends record to record ring, interrupt safe
+ */
+int sfcb_ring_add (t_sfcb *self, uint8_t cbID, const void *data, uint16_t len)
+{
+#ifdef SFCB_RING_EN
+    /** Variables **/
+    t_sfcb_ring_slot*   slot;   // reserved slot
+    uint32_t            pos;    // ring position
+    int32_t             diff;   // slot sequence against position
+
+    /* no logging, called from interrupt */
+    if ( (NULL == self->ptrRing) || (len > self->uint16RingRec) ) {
+        return SFCB_E_MEM;
+    }
+    /* reserve slot */
+    pos = __atomic_load_n(&(self->uint32RingHead), __ATOMIC_RELAXED);
+    for ( ;; ) {
+        slot = sfcb_ring_slot(self, pos);
+        diff = (int32_t) (__atomic_load_n(&(slot->uint32Seq), __ATOMIC_ACQUIRE) - pos);
+        if ( 0 == diff ) {
+            if ( __atomic_compare_exchange_n(&(self->uint32RingHead), &pos, pos + 1, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED) ) {
+                break;  // slot owned
+            }
+        } else if ( diff < 0 ) {
+            return SFCB_E_WKR_BSY;  // ring full
+        } else {
+            pos = __atomic_load_n(&(self->uint32RingHead), __ATOMIC_RELAXED);
+        }
+    }
+    /* fill and publish */
+    slot->uint8Cb = cbID;
+    slot->uint8Res = 0;
+    slot->uint16Len = len;
+    memcpy(slot + 1, data, len);
+    __atomic_store_n(&(slot->uint32Seq), pos + 1, __ATOMIC_RELEASE);
+    return SFCB_OK;
+#else
+    (void) self;    // ring disabled, no ring assigned
+    (void) cbID;
+    (void) data;
+    (void) len;
+    return SFCB_E_MEM;
+#endif
+}
+
+
+
+/**
+ *  sfcb_init_sink
+ *    assigns read sink
+ */
+int sfcb_init_sink (t_sfcb *self, t_sfcb_sink sink, void *arg)
+{
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* assign */
+    self->ptrSink = sink;
+    self->ptrSinkArg = arg;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_init_pingpong
+ *    assigns second SPI buffer
+ */
+int sfcb_init_pingpong (t_sfcb *self, void *spi, uint16_t spiLen)
+{
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* both buffers with same usable size */
+    if ( (NULL != spi) && (spiLen < self->uint16SpiMax) ) {
+        sfcb_log_ero("  ERROR:%s: spi buffer to small, is=%d byte, req=%d byte\n", __FUNCTION__, spiLen, self->uint16SpiMax);
+        return SFCB_E_MEM;
+    }
+    /* assign */
+    self->ptrSpiPp[1] = (uint8_t*) spi;
+    self->uint8PpCur = 0;
+    self->uint8PtrSpi = self->ptrSpiPp[0];
+    self->ptrSpiOut = self->ptrSpiPp[0];
+    self->uint16SpiOut = 0;
+    self->uint8PpBsy[0] = 0;
+    self->uint8PpBsy[1] = 0;
+    self->uint8PpAhead = 0;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_init_trace
+ *    assigns trace ring
+ */
+int sfcb_init_trace (t_sfcb *self, void *ring, uint16_t ringLen)
+{
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    if ( (NULL != ring) && (0 == ringLen) ) {
+        sfcb_log_ero("  ERROR:%s: trace ring without record\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    /* assign */
+    self->ptrTrace = (t_sfcb_trace*) ring;
+    self->uint16TraceMax = ringLen;
+    self->uint32TraceCnt = 0;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_trace_cnt
+ *    number of written trace records
+ */
+uint32_t sfcb_trace_cnt (t_sfcb *self)
+{
+    return self->uint32TraceCnt;
+}
+
+
+
+/**
+ *  sfcb_init_stats
+ *    assigns performance counters
+ */
+int sfcb_init_stats (t_sfcb *self, t_sfcb_stats *stats)
+{
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* assign */
+    self->ptrStats = stats;
+    if ( NULL != stats ) {
+        memset(stats, 0, sizeof(*stats));
+        stats->uint8JobCmd = SFCB_CMD_IDLE;
+    }
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_stats_get
+ *    snapshot of performance counters
+ */
+int sfcb_stats_get (t_sfcb *self, t_sfcb_stats *stats)
+{
+    if ( NULL == self->ptrStats ) {
+        sfcb_log_ero("  ERROR:%s: no counters assigned\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    memcpy(stats, self->ptrStats, sizeof(*stats));
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_stats_reset
+ *    clears performance counters
+ */
+void sfcb_stats_reset (t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_stats*   stats = self->ptrStats; // performance counters
+    uint32_t        uint32Tick;             // running job
+    uint32_t        uint32Call;
+    uint8_t         uint8Cmd;
+
+    if ( NULL == stats ) {
+        return;
+    }
+    uint32Tick = stats->uint32JobTick;
+    uint32Call = stats->uint32JobCall;
+    uint8Cmd = stats->uint8JobCmd;
+    memset(stats, 0, sizeof(*stats));
+    stats->uint32JobTick = uint32Tick;
+    stats->uint32JobCall = uint32Call;
+    stats->uint8JobCmd = uint8Cmd;
+}
+
+
+
+/**
+ *  sfcb_read_chunk
+ *    sets read chunk size
+ */
+int sfcb_read_chunk (t_sfcb *self, uint16_t chunkLen)
+{
+    /** Variables **/
+    uint16_t    uint16Max = (uint16_t) (self->uint16SpiMax - sfcb_rd_hdr(self));   // IST, address and dummy bytes of read instruction
+
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* fits into spi buffer */
+    if ( chunkLen > uint16Max ) {
+        sfcb_log_ero("  ERROR:%s: chunk=%d, spi buffer allows max=%d\n", __FUNCTION__, chunkLen, uint16Max);
+        return SFCB_E_MEM;
+    }
+    /* zero selects spi buffer size */
+    if ( 0 == chunkLen ) {
+        chunkLen = uint16Max;
+    }
+    self->uint16RdChunk = chunkLen;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_xfer_cfg
+ *    selects read and page program instruction
+ */
+int sfcb_xfer_cfg (t_sfcb *self, t_sfcb_rdmode rd, uint8_t quadProg)
+{
+    /** Variables **/
+    t_sfcb_xfer xferRd = g_sfcbXferSingle;  // read lanes
+    t_sfcb_xfer xferWr = g_sfcbXferSingle;  // page program lanes
+    uint8_t     uint8IstRd;                 // read instruction
+    uint8_t     uint8IstWr;                 // page program instruction
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* no jobs pending */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: Worker is busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* read instruction */
+    switch (rd) {
+        case SFCB_RD_SINGLE:
+            uint8IstRd = SFCB_FL_IST_RD_DATA(self);
+            break;
+        case SFCB_RD_FAST:
+            uint8IstRd = SFCB_FL_IST_RD_FAST(self);
+            xferRd.uint8Dummy = SFCB_FL_TOPO_RD_FAST_DUMMY(self);
+            break;
+        case SFCB_RD_DUAL:
+            uint8IstRd = SFCB_FL_IST_RD_DUAL(self);
+            xferRd.uint8DataLanes = 2;
+            xferRd.uint8Dummy = SFCB_FL_TOPO_RD_FAST_DUMMY(self);
+            break;
+        case SFCB_RD_QUAD:
+            uint8IstRd = SFCB_FL_IST_RD_QUAD(self);
+            xferRd.uint8DataLanes = 4;
+            xferRd.uint8Dummy = SFCB_FL_TOPO_RD_FAST_DUMMY(self);
+            break;
+        case SFCB_RD_QUAD_IO:
+            uint8IstRd = SFCB_FL_IST_RD_QUAD_IO(self);
+            xferRd.uint8AdrLanes = 4;
+            xferRd.uint8DataLanes = 4;
+            xferRd.uint8Dummy = SFCB_FL_TOPO_RD_QIO_DUMMY(self);
+            break;
+        default:
+            uint8IstRd = 0;
+            break;
+    }
+    xferRd.uint8DummyClk = (uint8_t) (xferRd.uint8Dummy * 8 / xferRd.uint8AdrLanes);
+    /* page program instruction */
+    uint8IstWr = SFCB_FL_IST_WR_PAGE(self);
+    if ( 0 != quadProg ) {
+        uint8IstWr = SFCB_FL_IST_WR_PAGE_QUAD(self);
+        xferWr.uint8DataLanes = 4;
+    }
+    if ( (0 == uint8IstRd) || (0 == uint8IstWr) ) {
+        sfcb_log_ero("  ERROR:%s: rd=%d, quadProg=%d not supported by flash\n", __FUNCTION__, rd, quadProg);
+        return SFCB_E_NO_FLASH;
+    }
+    /* read header and at least one byte */
+    if ( !((1u + SFCB_FL_TOPO_ADR_BYTE(self) + xferRd.uint8Dummy) < self->uint16SpiMax) ) {
+        sfcb_log_ero("  ERROR:%s: spi buffer to small\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    self->xferRd = xferRd;
+    self->xferWr = xferWr;
+    self->uint8IstRd = uint8IstRd;
+    self->uint8IstWr = uint8IstWr;
+    /* limit read chunk to spi buffer */
+    self->uint16RdChunk = (uint16_t) sfcb_min(self->uint16RdChunk, (uint32_t) (self->uint16SpiMax - sfcb_rd_hdr(self)));
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  @brief ping-pong read ahead
+ *
+ *  creates the next read of a GET/RAW stream or linear header scan in the other
+ *  ping-pong buffer, while the response of the current read is in transfer.
+ *  The worker creates after evaluation of the current response the same read,
+ *  which is replaced by the queued read ahead. A differing read discards the
+ *  read ahead and is transferred instead.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   read ahead queued
+ *  @retval         -1                  no read ahead possible
+ *  @since          2026-10-14
+ */
+static int sfcb_pp_ahead(t_sfcb *self)
+{
+    /** Variables **/
+    const uint8_t   uint8Oth = (uint8_t) (self->uint8PpCur ^ 1);    // other buffer
+    const uint16_t  uint16Len = self->uint16SpiLen;                 // current read
+    const uint32_t  uint32Slot = self->uint32IterSlot;
+    const uint32_t  uint32Adr = self->uint32IterAdr;
+    const uint32_t  uint32RdIter = self->uint32RdIter;
+    uint32_t        uint32Pl;   // payload bytes of current read
+    int             intRet = -1;
+
+    /* one read ahead in free buffer behind a read */
+    if (    (0 != self->uint8PpAhead)
+         || (0 != self->uint8PpBsy[uint8Oth])
+         || (0 == uint16Len)
+         || (SFCB_STG01 != self->stage)
+    ) {
+        return -1;
+    }
+    self->uint8PtrSpi = self->ptrSpiPp[uint8Oth];
+    uint32Pl = (uint32_t) (uint16Len - sfcb_rd_hdr(self));
+    switch (self->cmd) {
+        /* next chunk */
+        case SFCB_CMD_GET:
+        case SFCB_CMD_RAW:
+            self->uint32IterAdr = uint32Adr + uint32Pl;
+            self->uint32RdIter = uint32RdIter + uint32Pl;
+            if ( 0 != sfcb_rd_next(self) ) {
+                intRet = 0;
+            }
+            break;
+        /* next header burst */
+        case SFCB_CMD_MKCB:
+            if ( (uint32Slot + sfcb_mkcb_hdr_num(self)) < ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax ) {
+                sfcb_mkcb_hdr_burst(self, uint32Slot + sfcb_mkcb_hdr_num(self));
+                intRet = 0;
+            }
+            break;
+        default:
+            break;
+    }
+    /* queue behind current read */
+    if ( 0 == intRet ) {
+        sfcb_log_info("  INFO:%s: read ahead, buf=%d, adr=0x%x, len=%d\n", __FUNCTION__, uint8Oth, self->uint32IterAdr, self->uint16SpiLen);
+        self->uint8PpAhead = 1;
+        self->uint16PpLen = self->uint16SpiLen;
+        self->uint32PpAdr = self->uint32IterAdr;
+        self->ptrSpiOut = self->uint8PtrSpi;
+        self->uint16SpiOut = self->uint16SpiLen;
+        self->uint8PpBsy[uint8Oth] = 1;
+    }
+    /* restore current read */
+    self->uint8PtrSpi = self->ptrSpiPp[self->uint8PpCur];
+    self->uint16SpiLen = uint16Len;
+    self->uint32IterSlot = uint32Slot;
+    self->uint32IterAdr = uint32Adr;
+    self->uint32RdIter = uint32RdIter;
+    self->stage = SFCB_STG01;
+    return intRet;
+}
+
+
+
+/**
+ *  @brief trace record
+ *
+ *  appends record of last worker call to trace ring, see #sfcb_init_trace.
+ *  Calls without SPI packet and without stage transition are skipped.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_trace_rec(t_sfcb *self)
+{
+#ifdef SFCB_TRACE_EN
+    /** Variables **/
+    t_sfcb_trace*   rec;        // written record
+    const uint8_t*  uint8Spi = sfcb_spi_buf(self);
+    const uint16_t  uint16Len = sfcb_spi_len(self);
+
+    if ( NULL == self->ptrTrace ) {
+        return;
+    }
+    /* no transfer, no transition */
+    if ( (0 == uint16Len) && (0 != self->uint32TraceCnt) ) {
+        rec = &(self->ptrTrace[(self->uint32TraceCnt - 1) % self->uint16TraceMax]);
+        if ( (rec->uint8Cmd == (uint8_t) self->cmd) && (rec->uint8Stage == (uint8_t) self->stage) && (rec->uint8Busy == self->uint8Busy) ) {
+            return;
+        }
+    }
+    rec = &(self->ptrTrace[self->uint32TraceCnt % self->uint16TraceMax]);
+    rec->uint32Tick = (NULL == self->ptrTick) ? 0 : self->ptrTick();
+    rec->uint32Adr = 0;
+    rec->uint16Len = uint16Len;
+    rec->uint8Ist = (0 == uint16Len) ? 0 : uint8Spi[0];
+    rec->uint8Cmd = (uint8_t) self->cmd;
+    rec->uint8Stage = (uint8_t) self->stage;
+    rec->uint8Error = (uint8_t) self->error;
+    rec->uint8Cb = self->uint8IterCb;
+    rec->uint8Busy = self->uint8Busy;
+    /* instruction with address */
+    if (    (uint16Len > SFCB_FL_TOPO_ADR_BYTE(self))
+         && (SFCB_FL_IST_WR_ENA(self) != rec->uint8Ist)
+         && (SFCB_FL_IST_RD_STATE_REG(self) != rec->uint8Ist)
+    ) {
+        for ( uint8_t i = 0; i < SFCB_FL_TOPO_ADR_BYTE(self); i++ ) {
+            rec->uint32Adr = (rec->uint32Adr << 8) | uint8Spi[1+i];
+        }
+    }
+    (self->uint32TraceCnt)++;
+#else
+    (void) self;    // trace disabled
+#endif
+}
+
+
+
+/**
+ *  @brief worker FSM
+ *
+ *  processes response of last SPI packet and creates next one
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void sfcb_worker_fsm (t_sfcb *self)
+{
+    /** Variables **/
+    int                     intHead;                // classified element header
+    uint16_t                uint16CpyLen;           // number of Bytes to copy
+    uint32_t                uint32Temp;             // temporaray 32bit variable
+    spi_flash_cb_elem_head  writeHead;              // header/footer written to flash
+    spi_flash_cb_elem_head  readHead;               // header readen from flash
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    sfcb_log_info("  INFO:%s:sfcb_p            = %p\n", __FUNCTION__, self);
+    sfcb_log_info("  INFO:%s:sfcb:spi_p        = %p\n", __FUNCTION__, self->uint8PtrSpi); // spi buffer
+    self->xfer = g_sfcbXferSingle;  // read and page program select lanes
+    /* select part of FSM */
+    switch (self->cmd) {
+        /*
+         *
+         * nothing todo
+         *
+         */
+        case SFCB_CMD_IDLE:
+            sfcb_log_info("  INFO:%s:IDLE\n", __FUNCTION__);
+            /* record ring filled? */
+            if ( 0 == sfcb_ring_sel(self) ) {
+                self->uint16SpiLen = 0;
+                return;
+            }
+            /* staged bytes timed out? */
+            if ( 0 == sfcb_stage_sel(self) ) {
+                self->uint16SpiLen = 0;
+                return;
+            }
+            /* queue below pre-erase watermark? */
+            if ( 0 != sfcb_erase_sel(self) ) {
+                return;
+            }
+            /* Setup new Job */
+            self->uint8Busy = 1;
+            self->cmd = SFCB_CMD_ERASE;
+            self->stage = SFCB_STG00;
+            self->error = SFCB_E_NOERO;
+            self->uint16SpiLen = 0;
+            FALL_THROUGH;
+        /*
+         *
+         * Background erase of oldest sector
+         *
+         */
+        case SFCB_CMD_ERASE:
+            /* select excution state, allows break & cont */
+            switch (self->stage) {
+                /* check for WIP */
+                case SFCB_STG00:
+                    sfcb_log_info("  INFO:%s:ERASE:STG0: check for WIP\n", __FUNCTION__);
+                    if ( 0 != sfcb_wip_poll(self) ) return;
+                    /* enable write */
+                    self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);
+                    self->uint16SpiLen = 1;
+                    self->stage = SFCB_STG01;
+                    return; // SPI transfer is required
+                /* Sector or Block Erase */
+                case SFCB_STG01:
+                    sfcb_log_info("  INFO:%s:ERASE:STG1: cb=%d, adr=0x%x, end=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32EraseAdr, self->uint32EraseEnd);
+                    sfcb_erase_req(self, &((self->ptrCbs)[self->uint8IterCb]));
+                    self->uint8EraseAct = 1;    // suspendable by reads
+                    self->stage = SFCB_STG02;
+                    /* erase group incomplete, wait and continue */
+                    if ( 0 != ((self->uint32EraseAdr - ((self->ptrCbs)[self->uint8IterCb]).uint32StartSector * (uint32_t) SFCB_FL_TOPO_SECTOR_SIZE(self)) % sfcb_grp_size(self, &((self->ptrCbs)[self->uint8IterCb]))) ) {
+                        self->stage = SFCB_STG03;
+                    }
+                    return; // SPI transfer is required
+                /* Erase started, next job waits for WIP, the next span is selected in idle */
+                case SFCB_STG02:
+                    sfcb_worker_idle(self);
+                    return;
+                /* wait for erase, sfcb_wip_poll works only for spiLen=0 */
+                case SFCB_STG03:
+                    self->uint16SpiLen = 0;
+                    self->stage = SFCB_STG00;
+                    return;
+                /* something strange happend */
+                default:
+                    sfcb_log_ero("  ERROR:%s:ERASE: unexpected use of default path\n", __FUNCTION__);
+                    self->error = SFCB_E_UNKBEH;
+                    break;
+            }
+            return;
+        /*
+         *
+         * Iterate over Circular Buffer Elements
+         *
+         */
+        case SFCB_CMD_ITER:
+            switch (self->stage) {
+                /* check for WIP */
+                case SFCB_STG00:
+                    sfcb_log_info("  INFO:%s:ITER:STG0: check for WIP\n", __FUNCTION__);
+                    /* WIP Check, suspends background erase */
+                    if ( 0 != sfcb_wip_poll_sus(self) ) return;
+                    self->stage = SFCB_STG01;
+                    FALL_THROUGH;
+                /* evaluate read stream, request next */
+                case SFCB_STG01:
+                    intHead = (0 != self->uint16SpiLen) ? sfcb_iter_eval(self) : 0;
+                    if ( 0 != intHead ) {
+                        self->error = (-2 == intHead) ? SFCB_E_CRC : ((-3 == intHead) ? SFCB_E_CODEC : SFCB_E_ELEM);   // job ends with error
+                        sfcb_worker_idle(self);
+                        return;
+                    }
+                    if ( 0 != sfcb_iter_req(self) ) return;  // SPI transfer is required
+                    sfcb_log_info("  INFO:%s:ITER:STG1: all elements read\n", __FUNCTION__);
+                    sfcb_worker_idle(self);
+                    return;
+                /* something strange happend */
+                default:
+                    sfcb_log_ero("  ERROR:%s:ITER: unexpected use of default path\n", __FUNCTION__);
+                    self->error = SFCB_E_UNKBEH;
+                    break;
+            }
+            return;
+        /*
+         *
+         * Allocate Next Free Element for Circular Buffers
+         *
+         */
+        case SFCB_CMD_MKCB:
+            /* select excution state, allows break & cont */
+            switch (self->stage) {
+                /* check for WIP */
+                case SFCB_STG00:
+                    /* Debug message */
+                    sfcb_log_info (  "  INFO:%s:MKCB:STG0:check for WIP, uint16SpiLen=%d, uint8PtrSpi[1]=0x%02x\n",
+                                     __FUNCTION__,
+                                     self->uint16SpiLen,
+                                     self->uint8PtrSpi[1]
+                                  );
+                    /* WIP Check */
+                    if ( 0 != sfcb_wip_poll(self) ) return;
+                    /* all queues are up to date */
+                    if ( !(self->uint8IterCb < self->uint8NumCbs) ) {
+                        sfcb_worker_idle(self);
+                        return;
+                    }
+                    /* checkpoint queue is up to date */
+                    if ( 0 != ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid ) {
+                        sfcb_mkcb_qdone(self);
+                        return;
+                    }
+                    /* start rebuild of queue */
+                    sfcb_mkcb_qstart(self);
+                    return; // SPI transfer is required
+                /* Linear scan, fallback in case of corrupted header */
+                case SFCB_STG01:
+                    /* Debug message */
+                    sfcb_log_info("  INFO:%s:MKCB:STG1: find empty page for new element\n", __FUNCTION__);
+                    /* check last response, next slot behind burst */
+                    uint32Temp = 0;
+                    if ( 0 != self->uint16SpiLen ) {
+                        uint32Temp = self->uint32IterSlot + sfcb_mkcb_hdr_eval(self);
+                    }
+                    /* Current Status Message */
+                    sfcb_log_info ( "  INFO:%s:MKCB:STG1: cb=%d, elem=%d, idmin=0x%x, idmax=0x%x\n",
+                                    __FUNCTION__,
+                                    self->uint8IterCb,
+                                    uint32Temp,
+                                    ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin,
+                                    ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax
+                                  );
+                    /* request next headers of circular buffer */
+                    if ( uint32Temp < ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax ) {
+                        sfcb_mkcb_hdr_burst(self, uint32Temp);
+                        return;
+                    }
+                    /* all elements processed, go on with next queue or sector erase */
+                    sfcb_mkcb_qdone(self);
+                    return; // DONE or SPI transfer is required
+                    break;
+                /* Assemble Command for Sector or Block ERASE */
+                case SFCB_STG02:
+                    sfcb_log_info( "  INFO:%s:MKCB:STG2: Assemble Command for ERASE\n", __FUNCTION__);
+                    sfcb_log_info( "  INFO:%s:MKCB:STG2: cb=%d, uint32StartPageIdMin=0x%x\n",
+                                   __FUNCTION__,
+                                   self->uint8IterCb,
+                                   ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMin
+                                  );
+                    sfcb_erase_req(self, &((self->ptrCbs)[self->uint8IterCb]));
+                    self->stage = SFCB_STG03;
+                    return; // DONE or SPI transfer is required
+                    break;
+                /* Wait for Erase */
+                case SFCB_STG03:
+                    sfcb_log_info("  INFO:%s:MKCB:STG3: Wait for Erase\n", __FUNCTION__);
+                    /* Assemble command for WIP */
+                    self->uint16SpiLen = 0;
+                    (void) sfcb_wip_poll(self);
+                    self->stage = SFCB_STG00;   // wait for erase, and rebuild erased queue
+                    if ( self->uint32EraseAdr < self->uint32EraseEnd ) {
+                        self->stage = SFCB_STG12;   // next erase of span
+                    }
+                    return; // DONE or SPI transfer is required
+                    break;
+                /* Erase span incomplete, enable write for next erase */
+                case SFCB_STG12:
+                    if ( 0 != sfcb_wip_poll(self) ) return;
+                    self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);
+                    self->uint16SpiLen = 1;
+                    self->stage = SFCB_STG02;
+                    return; // SPI transfer is required
+                /* Logarithmic scan: evaluate first element slot, request last element slot */
+                case SFCB_STG04:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG4: cb=%d, slot=0, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, intHead, readHead.uint32IdNum);
+                    if ( SFCB_HDR_ERO == intHead ) {
+                        sfcb_mkcb_lin_start(self);
+                        return;
+                    }
+                    if ( SFCB_HDR_USED == intHead ) {
+                        self->uint32IterIdFirst = readHead.uint32IdNum;
+                        self->uint8IterFlg |= SFCB_SCAN_FIRST;
+                    }
+                    sfcb_mkcb_hdr_req(self, (uint32_t) (((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax - 1), SFCB_STG05);
+                    return; // SPI transfer is required
+                /* Logarithmic scan: evaluate last element slot, select ring constellation */
+                case SFCB_STG05:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG5: cb=%d, slot=%d, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32IterSlot, intHead, readHead.uint32IdNum);
+                    if ( SFCB_HDR_ERO == intHead ) {
+                        sfcb_mkcb_lin_start(self);
+                        return;
+                    }
+                    uint32Temp = ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax;   // number of element slots
+                    self->uint32IterLo = 0;
+                    self->uint32IterHi = uint32Temp - 1;
+                    if ( SFCB_HDR_USED == intHead ) {
+                        self->uint32IterIdLast = readHead.uint32IdNum;
+                        self->uint8IterFlg |= SFCB_SCAN_LAST;
+                    }
+                    switch ( self->uint8IterFlg & (SFCB_SCAN_FIRST | SFCB_SCAN_LAST) ) {
+                        /* empty queue */
+                        case 0:
+                            /* pre-erase can leave free slots at both ends, runs start on erase group boundary */
+                            uint32Temp = sfcb_slot_grp(self, &((self->ptrCbs)[self->uint8IterCb]));
+                            if ( uint32Temp < self->uint32IterHi ) {
+                                sfcb_mkcb_hdr_req(self, uint32Temp, SFCB_STG11);
+                                return;
+                            }
+                            ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite = sfcb_slot_adr(self, &((self->ptrCbs)[self->uint8IterCb]), 0);
+                            ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid = 1;
+                            sfcb_mkcb_qdone(self);
+                            return;
+                        /* oldest elements at ring end, newest element is last slot */
+                        case SFCB_SCAN_LAST:
+                            ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax = self->uint32IterIdLast;
+                            ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMax = self->uint32IterAdr;
+                            ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite = sfcb_slot_adr(self, &((self->ptrCbs)[self->uint8IterCb]), 0);
+                            ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid = 1;
+                            sfcb_mkcb_bs_old(self);
+                            return;
+                        /* not wrapped, free slots at ring end */
+                        case SFCB_SCAN_FIRST:
+                            self->uint8IterFlg |= SFCB_SCAN_HIMTY;
+                            sfcb_mkcb_bs_new(self);
+                            return;
+                        /* both ends used */
+                        default:
+                            /* completely filled and not wrapped */
+                            if ( self->uint32IterIdLast == (self->uint32IterIdFirst + uint32Temp - 1) ) {
+                                self->uint32IterLo = self->uint32IterHi;
+                                sfcb_mkcb_bs_new(self);
+                                return;
+                            }
+                            /* wrapped, oldest elements at ring end */
+                            if ( self->uint32IterIdLast == (self->uint32IterIdFirst - 1) ) {
+                                sfcb_mkcb_bs_new(self);
+                                return;
+                            }
+                            /* IDs not consecutive */
+                            sfcb_mkcb_lin_start(self);
+                            return;
+                    }
+                    break;
+                /* Logarithmic scan: bisect run with newest elements, starts at first slot */
+                case SFCB_STG06:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG6: cb=%d, slot=%d, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32IterSlot, intHead, readHead.uint32IdNum);
+                    uint32Temp = ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax;   // number of element slots
+                    if ( (SFCB_HDR_USED == intHead) && (readHead.uint32IdNum == self->uint32IterIdFirst + self->uint32IterSlot) ) {
+                        self->uint32IterLo = self->uint32IterSlot;
+                    } else if ( SFCB_HDR_MTY == intHead ) {
+                        self->uint32IterHi = self->uint32IterSlot;
+                        self->uint8IterFlg |= SFCB_SCAN_HIMTY;
+                    } else if ( (SFCB_HDR_USED == intHead) && (0 != (self->uint8IterFlg & SFCB_SCAN_LAST)) && (readHead.uint32IdNum == self->uint32IterIdFirst - uint32Temp + self->uint32IterSlot) ) {
+                        self->uint32IterHi = self->uint32IterSlot;
+                        self->uint8IterFlg &= (uint8_t) ~SFCB_SCAN_HIMTY;
+                    } else {
+                        sfcb_mkcb_lin_start(self);
+                        return;
+                    }
+                    sfcb_mkcb_bs_new(self);
+                    return; // SPI transfer is required
+                /* Logarithmic scan: bisect run with oldest elements, ends at last slot */
+                case SFCB_STG07:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG7: cb=%d, slot=%d, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32IterSlot, intHead, readHead.uint32IdNum);
+                    uint32Temp = ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax;   // number of element slots
+                    if ( (SFCB_HDR_USED == intHead) && (readHead.uint32IdNum == self->uint32IterIdLast - (uint32Temp - 1 - self->uint32IterSlot)) ) {
+                        self->uint32IterHi = self->uint32IterSlot;
+                    } else if ( SFCB_HDR_MTY == intHead ) {
+                        self->uint32IterLo = self->uint32IterSlot;
+                    } else {
+                        sfcb_mkcb_lin_start(self);
+                        return;
+                    }
+                    sfcb_mkcb_bs_old(self);
+                    return; // SPI transfer is required
+                /* Logarithmic scan: both ends free, search used run on sector starts */
+                case SFCB_STG11:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG11: cb=%d, slot=%d, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32IterSlot, intHead, readHead.uint32IdNum);
+                    uint32Temp = ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax;   // number of element slots
+                    if ( SFCB_HDR_ERO == intHead ) {
+                        sfcb_mkcb_lin_start(self);
+                        return;
+                    }
+                    /* used run found, IDs relative to ring ends for bisection */
+                    if ( SFCB_HDR_USED == intHead ) {
+                        self->uint32IterIdFirst = readHead.uint32IdNum - self->uint32IterSlot;
+                        self->uint32IterIdLast = readHead.uint32IdNum + (uint32Temp - 1 - self->uint32IterSlot);
+                        self->uint8IterFlg |= SFCB_SCAN_MID;
+                        self->uint32IterHi = self->uint32IterSlot;
+                        self->uint32IterLo = self->uint32IterSlot - sfcb_slot_grp(self, &((self->ptrCbs)[self->uint8IterCb]));  // free erase group start
+                        sfcb_mkcb_bs_old(self);
+                        return;
+                    }
+                    /* next sector */
+                    if ( (self->uint32IterSlot + sfcb_slot_grp(self, &((self->ptrCbs)[self->uint8IterCb]))) < (uint32Temp - 1) ) {
+                        sfcb_mkcb_hdr_req(self, self->uint32IterSlot + sfcb_slot_grp(self, &((self->ptrCbs)[self->uint8IterCb])), SFCB_STG11);
+                        return;
+                    }
+                    /* empty queue */
+                    ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite = sfcb_slot_adr(self, &((self->ptrCbs)[self->uint8IterCb]), 0);
+                    ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid = 1;
+                    sfcb_mkcb_qdone(self);
+                    return;
+                /* Checkpoint: copy chunk of newest checkpoint */
+                case SFCB_STG08:
+                    sfcb_log_info("  INFO:%s:MKCB:STG8: read checkpoint, adr=0x%x\n", __FUNCTION__, self->uint32IterAdr);
+                    uint16CpyLen = (uint16_t) (self->uint16SpiLen - sfcb_rd_hdr(self));
+                    memcpy(((uint8_t*) self->ptrCkpt) + self->uint16Iter, self->uint8PtrSpi + sfcb_rd_hdr(self), uint16CpyLen);
+                    self->uint16Iter = (uint16_t) (self->uint16Iter + uint16CpyLen);
+                    sfcb_mkcb_ckpt_rd(self);
+                    return; // SPI transfer is required
+                /* Checkpoint: verify oldest element */
+                case SFCB_STG09:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG9: cb=%d, slot=%d, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32IterSlot, intHead, readHead.uint32IdNum);
+                    if ( (SFCB_HDR_USED != intHead) || (readHead.uint32IdNum != ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin) ) {
+                        sfcb_mkcb_bs_start(self);   // checkpoint outdated
+                        return;
+                    }
+                    sfcb_mkcb_hdr_req(self, sfcb_slot_num(self, &((self->ptrCbs)[self->uint8IterCb]), ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite), SFCB_STG10);
+                    return; // SPI transfer is required
+                /* Checkpoint: roll forward over elements written after checkpoint */
+                case SFCB_STG10:
+                    intHead = sfcb_mkcb_hdr_read(self, 0, &readHead);
+                    sfcb_log_info("  INFO:%s:MKCB:STG10: cb=%d, slot=%d, head=%d, id=0x%x\n", __FUNCTION__, self->uint8IterCb, self->uint32IterSlot, intHead, readHead.uint32IdNum);
+                    /* checkpoint is up to date */
+                    if ( SFCB_HDR_MTY == intHead ) {
+                        ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid = 1;
+                        sfcb_mkcb_qdone(self);
+                        return;
+                    }
+                    /* unexpected element, or ring full */
+                    if (    (SFCB_HDR_USED != intHead)
+                         || (readHead.uint32IdNum != ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax + 1)
+                         || (((self->ptrCbs)[self->uint8IterCb]).uint32NumEntries + 1 >= ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax)
+                    ) {
+                        sfcb_mkcb_bs_start(self);
+                        return;
+                    }
+                    /* element written after checkpoint */
+                    if ( 0 == ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntries ) {
+                        ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMin = readHead.uint32IdNum;
+                        ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMin = self->uint32IterAdr;
+                    }
+                    ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax = readHead.uint32IdNum;
+                    ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageIdMax = self->uint32IterAdr;
+                    (((self->ptrCbs)[self->uint8IterCb]).uint32NumEntries)++;
+                    uint32Temp = (self->uint32IterSlot + 1) % ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax;  // next slot
+                    ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite = sfcb_slot_adr(self, &((self->ptrCbs)[self->uint8IterCb]), uint32Temp);
+                    sfcb_mkcb_hdr_req(self, uint32Temp, SFCB_STG10);
+                    return; // SPI transfer is required
+                /* something strange happend */
+                default:
+                    sfcb_log_ero("  ERROR:%s:MKCB: unexpected use of default path\n", __FUNCTION__);
+                    self->error = SFCB_E_UNKBEH;
                     break;
             }
             return;
@@ -420,7 +4487,7 @@ void sfcb_worker (t_sfcb *self)
             switch (self->stage) {
                 /* check for WIP */
                 case SFCB_STG00:
-                    sfcb_printf("  INFO:%s:ADD:STG0: check for WIP\n", __FUNCTION__);
+                    sfcb_log_info("  INFO:%s:ADD:STG0: check for WIP\n", __FUNCTION__);
                     /* WIP Check */
                     if ( 0 != sfcb_wip_poll(self) ) return;
                     /* free for new request */
@@ -428,9 +4495,43 @@ void sfcb_worker (t_sfcb *self)
                     FALL_THROUGH;               // no SPI request required, therefore go on
                 /* Circular Buffer written, if not write enable */
                 case SFCB_STG01:
-                    sfcb_printf("  INFO:%s:ADD:STG1: Circular Buffer completly written, if not write enable\n", __FUNCTION__);
+                    sfcb_log_info("  INFO:%s:ADD:STG1: Circular Buffer completly written, if not write enable\n", __FUNCTION__);
+                    /* footer written, update management data in place */
+                    if ( ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs > (((self->ptrCbs)[self->uint8IterCb]).uint16PlSize + sizeof(spi_flash_cb_elem_head)) ) {
+                        sfcb_add_commit(self, &((self->ptrCbs)[self->uint8IterCb]));
+                        if ( 0 != self->uint16BatchNum ) {  // batch: go on with next record
+                            --(self->uint16BatchNum);
+                            self->ptrCbElemPl = ((uint8_t*) self->ptrCbElemPl) + self->uint16CbElemPlSize;
+                            self->uint16Iter = 0;
+                            self->uint32IterAdr = ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite;
+                        }
+                        /* no free element left, erase ahead */
+                        if (    !(((self->ptrCbs)[self->uint8IterCb]).uint32NumEntries < ((self->ptrCbs)[self->uint8IterCb]).uint32NumEntriesMax)
+                             && (0 == sfcb_erase_span(self, &((self->ptrCbs)[self->uint8IterCb]), 1))
+                        ) {
+                            self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);
+                            self->uint16SpiLen = 1;
+                            self->stage = SFCB_STG05;   // sector or block erase
+                            return;
+                        }
+                        if ( 0 == self->uint16BatchNum ) {
+                            sfcb_worker_idle(self);
+                            return;
+                        }
+                    }
+                    /* staged bytes programmed, go on with append behind staging overflow */
+                    if ( (NULL != self->ptrCbElemPlNext) && !(self->uint16Iter < self->uint16CbElemPlSize) ) {
+                        self->ptrCbElemPl = self->ptrCbElemPlNext;
+                        self->uint16CbElemPlSize = self->uint16CbElemPlNextSize;
+                        self->uint16Iter = 0;
+                        self->ptrCbElemPlNext = NULL;
+                    }
+                    /* batch or forced footer: record complete, force footer write */
+                    if ( ((0 != self->uint16BatchNum) || (0 != self->uint8AddFoot)) && !(self->uint16Iter < self->uint16CbElemPlSize) ) {
+                        sfcb_add_close(&((self->ptrCbs)[self->uint8IterCb]));
+                    }
                     /* Speculative expect Write, Enable Write Latch */
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_WR_ENA;   // uint8FlashIstWrEnable
+                    self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);   // uint8FlashIstWrEnable
                     self->uint16SpiLen = 1;
                     /* Header/Footer write required */
                     if (    (self->uint32IterAdr == ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite)   // Start of Circular Buffer Write
@@ -444,65 +4545,64 @@ void sfcb_worker (t_sfcb *self)
                         return;
                     /* circular buffer written */
                     } else {
-                        self->uint16SpiLen = 0;
-                        self->cmd = SFCB_CMD_IDLE;
-                        self->stage = SFCB_STG00;
-                        self->uint8Busy = 0;
+                        sfcb_worker_idle(self);
                         return;
                     }
                     break;
                 /* Page Write to Circular Buffer */
                 case SFCB_STG02:
-                    sfcb_printf("  INFO:%s:ADD:STG2: Write Header/Footer to Flash, adr=0x%x, payload,len=%d\n", __FUNCTION__, self->uint32IterAdr, (uint32_t) sizeof(writeHead));
+                    sfcb_log_info("  INFO:%s:ADD:STG2: Write Header/Footer to Flash, adr=0x%x, payload,len=%d\n", __FUNCTION__, self->uint32IterAdr, (uint32_t) sizeof(writeHead));
                     /* assemble Header/ Footer */
                     memset(&writeHead, 0, sizeof(writeHead)); // make empty
                     writeHead.uint32MagicNum = ((self->ptrCbs)[self->uint8IterCb]).uint32MagicNum;
                     writeHead.uint32IdNum = ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax + 1;
                     /* Page Write */
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_WR_PAGE;
+                    self->uint8PtrSpi[0] = self->uint8IstWr;
                     self->uint16SpiLen = 1;
+                    self->xfer = self->xferWr;
                     /* Footer? */
                     if ( ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs == (((self->ptrCbs)[self->uint8IterCb]).uint16PlSize + sizeof(spi_flash_cb_elem_head)) ) {
                         self->uint32IterAdr =   ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite
-                                              + ((self->ptrCbs)[self->uint8IterCb]).uint16NumPagesPerElem * (uint32_t) SFCB_FLASH_TOPO_PAGE_SIZE
+                                              + ((self->ptrCbs)[self->uint8IterCb]).uint32NumPagesPerElem * (uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self)
                                               - (uint32_t) sizeof(writeHead);
                         ++(((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs);   // footer write is only entered one time
+                        if ( 0 != ((self->ptrCbs)[self->uint8IterCb]).uint8Crc ) {
+                            writeHead.uint32MagicNum = ((self->ptrCbs)[self->uint8IterCb]).uint32CrcWr;
+                        }
                     } else {    // Header
                         ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs = (uint16_t) (((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs + sizeof(writeHead));
                     }
                     /* SPI Packet: Set address */
-                    sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+self->uint16SpiLen, SFCB_FLASH_TOPO_ADR_BYTE);
-                    (self->uint16SpiLen) = (uint16_t) ((self->uint16SpiLen) + SFCB_FLASH_TOPO_ADR_BYTE);
+                    sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+self->uint16SpiLen, SFCB_FL_TOPO_ADR_BYTE(self));
+                    (self->uint16SpiLen) = (uint16_t) ((self->uint16SpiLen) + SFCB_FL_TOPO_ADR_BYTE(self));
                     /* SPI Packet: Copy Payload*/
                     memcpy((self->uint8PtrSpi+self->uint16SpiLen), &writeHead, sizeof(writeHead));
                     (self->uint16SpiLen) = (uint16_t) ((self->uint16SpiLen) + sizeof(writeHead));
                     /* Update Flash Address Counter */
                     (self->uint32IterAdr) += (uint32_t) sizeof(writeHead);
+                    /* Header: payload and footer of same page in one program */
+                    if ( ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs == sizeof(writeHead) ) {
+                        sfcb_add_page(self, &writeHead);
+                    }
+                    sfcb_wip_set(self, SFCB_FL_TIME_PAGE_PROG(self));
                     /* Go to wait for WIP */
                     self->stage = SFCB_STG04;
                     return;
                 /* Page Write to Circular Buffer */
                 case SFCB_STG03:
-                    sfcb_printf("  INFO:%s:ADD:STG3: Page Write to Circular Buffer, adr=0x%x, payload,len=%d\n", __FUNCTION__, self->uint32IterAdr, self->uint16CbElemPlSize);
+                    sfcb_log_info("  INFO:%s:ADD:STG3: Page Write to Circular Buffer, adr=0x%x, payload,len=%d\n", __FUNCTION__, self->uint32IterAdr, self->uint16CbElemPlSize);
                     /* assemble Flash Instruction packet */
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_WR_PAGE;  // write page
-                    sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+1, SFCB_FLASH_TOPO_ADR_BYTE);   // +1 first byte is instruction
-                    self->uint16SpiLen = SFCB_FLASH_TOPO_ADR_BYTE + 1;  // +1: IST
-                    /* get available bytes in page */
-                    uint16PagesBytesAvail = (uint16_t) (SFCB_FLASH_TOPO_PAGE_SIZE - (self->uint32IterAdr % SFCB_FLASH_TOPO_PAGE_SIZE));
-                    /* determine number of bytes to copy */
-                    if ( (self->uint16CbElemPlSize - self->uint16Iter) > uint16PagesBytesAvail ) {
-                        uint16CpyLen = uint16PagesBytesAvail;
-                    } else {
-                        uint16CpyLen = (uint16_t) (self->uint16CbElemPlSize - self->uint16Iter);
-                    }
+                    self->uint8PtrSpi[0] = self->uint8IstWr;    // write page
+                    self->xfer = self->xferWr;
+                    sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+1, SFCB_FL_TOPO_ADR_BYTE(self));   // +1 first byte is instruction
+                    self->uint16SpiLen = SFCB_FL_TOPO_ADR_BYTE(self) + 1;  // +1: IST
+                    /* footer for merge with last payload page */
+                    memset(&writeHead, 0, sizeof(writeHead));
+                    writeHead.uint32MagicNum = ((self->ptrCbs)[self->uint8IterCb]).uint32MagicNum;
+                    writeHead.uint32IdNum = ((self->ptrCbs)[self->uint8IterCb]).uint32IdNumMax + 1;
                     /* assemble packet */
-                    memcpy((self->uint8PtrSpi+self->uint16SpiLen), (self->ptrCbElemPl+self->uint16Iter), uint16CpyLen);
-                    self->uint16SpiLen = (uint16_t) (self->uint16SpiLen + uint16CpyLen);
-                    self->uint16Iter = (uint16_t) (self->uint16Iter + uint16CpyLen);
-                    /* increment iterators */
-                    ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs = (uint16_t) (((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs + self->uint16SpiLen - SFCB_FLASH_TOPO_ADR_BYTE - 1);   // payload internal flash offset
-                    self->uint32IterAdr = self->uint32IterAdr + self->uint16SpiLen - SFCB_FLASH_TOPO_ADR_BYTE - 1;  // inc flash address by written data, reduced by SPI Flash instruction
+                    sfcb_add_page(self, &writeHead);
+                    sfcb_wip_set(self, SFCB_FL_TIME_PAGE_PROG(self));
                     /* Go to wait WIP */
                     self->stage = SFCB_STG04;
                     return;
@@ -511,122 +4611,115 @@ void sfcb_worker (t_sfcb *self)
                     self->uint16SpiLen = 0; // needed for WIP poll packet generation in STG00
                     self->stage = SFCB_STG00;
                     return;
+                /* no free element: erase oldest elements */
+                case SFCB_STG05:
+                    sfcb_log_info("  INFO:%s:ADD:STG5: erase ahead, adr=0x%x, end=0x%x\n", __FUNCTION__, self->uint32EraseAdr, self->uint32EraseEnd);
+                    sfcb_erase_req(self, &((self->ptrCbs)[self->uint8IterCb]));
+                    self->stage = (0 != self->uint16BatchNum) ? SFCB_STG04 : SFCB_STG06;    // wait for erase, or done
+                    if ( self->uint32EraseAdr < self->uint32EraseEnd ) {
+                        self->stage = SFCB_STG07;   // next erase of span
+                    }
+                    return;
+                /* element committed, erase completes in background */
+                case SFCB_STG06:
+                    sfcb_worker_idle(self);
+                    return;
+                /* erase span incomplete, wait for erase, sfcb_wip_poll works only for spiLen=0 */
+                case SFCB_STG07:
+                    self->uint16SpiLen = 0;
+                    self->stage = SFCB_STG08;
+                    FALL_THROUGH;
+                /* erase span incomplete, enable write for next erase */
+                case SFCB_STG08:
+                    if ( 0 != sfcb_wip_poll(self) ) return;
+                    self->uint8PtrSpi[0] = SFCB_FL_IST_WR_ENA(self);
+                    self->uint16SpiLen = 1;
+                    self->stage = SFCB_STG05;
+                    return; // SPI transfer is required
                 /* something strange happend */
                 default:
-                    sfcb_printf("  ERROR:%s:ADD: default, something strange happend\n", __FUNCTION__);
+                    sfcb_log_ero("  ERROR:%s:ADD: default, something strange happend\n", __FUNCTION__);
                     self->error = SFCB_E_UNKBEH;
                     break;
             }
             return;
         /*
          *
-         * Get Element from circular buffer
+         * Get Element from circular buffer, Raw Flash Read
          *
          */
         case SFCB_CMD_GET:
+        case SFCB_CMD_RAW:
             switch (self->stage) {
                 /* check for WIP */
                 case SFCB_STG00:
-                    sfcb_printf("  INFO:%s:GET:STG0: check for WIP\n", __FUNCTION__);
-                    /* WIP Check */
-                    if ( 0 != sfcb_wip_poll(self) ) return;
+                    sfcb_log_info("  INFO:%s:READ:STG0: check for WIP\n", __FUNCTION__);
+                    /* WIP Check, suspends background erase */
+                    if ( 0 != sfcb_wip_poll_sus(self) ) return;
                     /* free for new request */
                     self->stage = SFCB_STG01;   // Go one with search for Free Segment
                     FALL_THROUGH;               // Go one with next
                 /* Copy SPI Packet to data buffer */
                 case SFCB_STG01:
-                    /* debug message */
-                    sfcb_printf("  INFO:%s:GET:STG1:\n", __FUNCTION__);
                     /* copy data available? */
                     if ( 0 != self->uint16SpiLen ) {
-                        sfcb_printf("  INFO:%s:GET:STG1: Copy bytes in payload buffer\n", __FUNCTION__);
-                        uint16CpyLen = (uint16_t) (self->uint16SpiLen - SFCB_FLASH_TOPO_ADR_BYTE - 1);  // -1: for instruction
-                        memcpy(self->ptrCbElemPl+self->uint16Iter, self->uint8PtrSpi + SFCB_FLASH_TOPO_ADR_BYTE + 1, uint16CpyLen);
-                        self->uint16Iter = (uint16_t) (self->uint16Iter + uint16CpyLen);        // payload byte counter
-                        self->uint32IterAdr = (uint32_t) (self->uint32IterAdr + uint16CpyLen);  // flash address byte counter
+                        sfcb_log_info("  INFO:%s:READ:STG1: Copy bytes in payload buffer\n", __FUNCTION__);
+                        uint16CpyLen = (uint16_t) (self->uint16SpiLen - sfcb_rd_hdr(self));  // skip instruction, address and dummy
+                        if ( self->uint32RdIter < self->uint32RdLen ) {
+                            uint32Temp = sfcb_min((uint32_t) uint16CpyLen, self->uint32RdLen - self->uint32RdIter);   // without footer CRC
+                            if ( 0 != self->uint8RdDec ) {
+                                (void) sfcb_codec_rd(self, self->uint8PtrSpi + sfcb_rd_hdr(self), uint32Temp);  // invalid record is checked at read end
+                            } else if ( NULL == self->ptrCbElemPl ) {
+                                self->ptrSink(self->ptrSinkArg, self->uint32RdIter, self->uint8PtrSpi + sfcb_rd_hdr(self), (uint16_t) uint32Temp);
+                            } else {
+                                memcpy(((uint8_t*) self->ptrCbElemPl)+self->uint32RdIter, self->uint8PtrSpi + sfcb_rd_hdr(self), uint32Temp);
+                            }
+                        }
+                        if ( 0 != self->uint8RdCrc ) {
+                            sfcb_rd_crc(self, self->uint8PtrSpi + sfcb_rd_hdr(self), uint16CpyLen);
+                        }
+                        self->uint32RdIter += uint16CpyLen;     // payload byte counter
+                        self->uint32IterAdr += uint16CpyLen;    // flash address byte counter
                     }
                     /* next chunk */
                     self->stage = SFCB_STG02;   // fetch next chunk from flash
                     FALL_THROUGH;               // Request next spi packet
-                /* Circular buffer element read-out complete, if not go on with next chunk */
+                /* Read complete, if not go on with next chunk, reads can not start a write, no WIP poll between chunks */
                 case SFCB_STG02:
                     /* Request next segment for read */
-                    if ( self->uint16Iter < self->uint16CbElemPlSize ) {
-                        /* Prepare Package for request */
-                        uint16CpyLen = (uint16_t) sfcb_min(SFCB_FLASH_TOPO_PAGE_SIZE, self->uint16CbElemPlSize - self->uint16Iter); // pending bytes, or max page size
-                        self->uint16SpiLen = (uint16_t) (uint16CpyLen + SFCB_FLASH_TOPO_ADR_BYTE + 1);  // +1: for instruction
-                        memset(self->uint8PtrSpi, 0, self->uint16SpiLen);   // written data is zero
-                        /* Flash instruction */
-                        self->uint8PtrSpi[0] = SFCB_FLASH_IST_RD_DATA;  // read data
-                        sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+1, SFCB_FLASH_TOPO_ADR_BYTE);   // +1 first byte is instruction
+                    if ( 0 != sfcb_rd_next(self) ) {
                         /* User Message */
-                        sfcb_printf("  INFO:%s:GET:STG2: Request next segment from Flash, adr=0x%x, len=%d\n", __FUNCTION__, self->uint32IterAdr, self->uint16SpiLen);
+                        sfcb_log_info("  INFO:%s:READ:STG2: Request next segment from Flash, adr=0x%x, len=%d\n", __FUNCTION__, self->uint32IterAdr, self->uint16SpiLen);
                         /* wait for HW */
                         self->stage = SFCB_STG01;   // Copy read data back
-                    /* CB Element Read complete */
+                    /* Read complete */
                     } else {
                         /* User Message */
-                        sfcb_printf("  INFO:%s:GET:STG1: Transfer done\n", __FUNCTION__);
+                        sfcb_log_info("  INFO:%s:READ:STG2: Transfer done\n", __FUNCTION__);
+                        /* payload CRC */
+                        if ( (0 != self->uint8RdCrc) && (self->uint32CrcRd != self->uint32CrcFoot) ) {
+                            sfcb_log_ero("  ERROR:%s:READ:STG2: payload CRC mismatch, exp=0x%x, is=0x%x\n", __FUNCTION__, self->uint32CrcFoot, self->uint32CrcRd);
+                            self->error = SFCB_E_CRC;
+                        }
+                        /* record codec, last decoded record */
+                        if ( (0 != self->uint8RdDec) && (SFCB_E_NOERO == self->error) ) {
+                            uint32Temp = ((self->ptrCbs)[self->uint8IterCb]).uint16CodecRec;
+                            if ( (SFCB_DEC_ERO == self->uint8DecSt) || (0 == self->uint16DecNum) ) {
+                                sfcb_log_ero("  ERROR:%s:READ:STG2: no valid record\n", __FUNCTION__);
+                                self->error = SFCB_E_CODEC;
+                            } else if ( NULL == self->ptrCbElemPl ) {
+                                self->ptrSink(self->ptrSinkArg, 0, ((self->ptrCbs)[self->uint8IterCb]).ptrCodecBuf + uint32Temp, self->uint16CbElemPlSize);
+                            } else {
+                                memcpy(self->ptrCbElemPl, ((self->ptrCbs)[self->uint8IterCb]).ptrCodecBuf + uint32Temp, self->uint16CbElemPlSize);
+                            }
+                        }
                         /* finish */
-                        self->uint16SpiLen = 0;
-                        self->cmd = SFCB_CMD_IDLE;
-                        self->stage = SFCB_STG00;
-                        self->uint8Busy = 0;
+                        sfcb_worker_idle(self);
                     }
                     return; // Wait for SPI
                 /* something strange happend */
                 default:
-                    sfcb_printf("  ERROR:%s:RAW: unexpected use of default path\n", __FUNCTION__);
-                    self->error = SFCB_E_UNKBEH;
-                    break;
-            }
-            return;
-        /*
-         *
-         * Raw Flash Read
-         *
-         */
-        case SFCB_CMD_RAW:
-            switch (self->stage) {
-                /* check for WIP */
-                case SFCB_STG00:
-                    sfcb_printf("  INFO:%s:RAW:STG0: check for WIP\n", __FUNCTION__);
-                    /* WIP Check */
-                    if ( 0 != sfcb_wip_poll(self) ) return;
-                    /* free for new request */
-                    self->stage = SFCB_STG01;   // Go one with search for Free Segment
-                    FALL_THROUGH;               // Go one with stage
-                /* Prepare raw read */
-                case SFCB_STG01:
-                    sfcb_printf("  INFO:%s:RAW:STG1: Prepare RAW read\n", __FUNCTION__);
-                    /* check for enough spi buf */
-                    if ( self->uint16SpiMax < (self->uint16CbElemPlSize + SFCB_FLASH_TOPO_ADR_BYTE + 1) ) { // IST (+1) + ADR_BYTE: caused by read instruction
-                        self->uint8Busy = 0;
-                        self->cmd = SFCB_CMD_IDLE;  // go in idle
-                        self->stage = SFCB_STG00;
-                        self->error = SFCB_E_BUFSIZE;   // requested operation ends with an error
-                    }
-                    /* SPI package is zero */
-                    self->uint16SpiLen = (uint16_t) (self->uint16CbElemPlSize + SFCB_FLASH_TOPO_ADR_BYTE + 1);  // +1: for instruction
-                    memset(self->uint8PtrSpi, 0, self->uint16SpiLen);   // written data is zero
-                    /* Flash instruction */
-                    self->uint8PtrSpi[0] = SFCB_FLASH_IST_RD_DATA;  // read data
-                    sfcb_adr32_uint8(self->uint32IterAdr, self->uint8PtrSpi+1, SFCB_FLASH_TOPO_ADR_BYTE);   // +1 first byte is instruction
-                    /* go on with next stage */
-                    self->stage = SFCB_STG02;   // now wait for transfer
-                    return;
-                /* copy data from SPI back */
-                case SFCB_STG02:
-                    sfcb_printf("  INFO:%s:RAW:STG2: copy data from SPI back\n", __FUNCTION__);
-                    memcpy(self->ptrCbElemPl, self->uint8PtrSpi+SFCB_FLASH_TOPO_ADR_BYTE+1, self->uint16CbElemPlSize);  // skip header from answer of read instruction
-                    self->uint16SpiLen = 0;
-                    self->cmd = SFCB_CMD_IDLE;
-                    self->stage = SFCB_STG00;
-                    self->uint8Busy = 0;
-                    return;
-                /* something strange happend */
-                default:
-                    sfcb_printf("  ERROR:%s:RAW: unexpected use of default path\n", __FUNCTION__);
+                    sfcb_log_ero("  ERROR:%s:READ: unexpected use of default path\n", __FUNCTION__);
                     self->error = SFCB_E_UNKBEH;
                     break;
             }
@@ -641,76 +4734,551 @@ void sfcb_worker (t_sfcb *self)
 
 
 /**
- *  sfcb_flash_size
- *    total flashsize
+ *  spi_flash_cb_worker
+ *    executes request from ...
+ */
+void sfcb_worker (t_sfcb *self)
+{
+    /** Variables **/
+    uint8_t     uint8Oth;   // other ping-pong buffer
+
+    sfcb_stats_call(self);
+    /* single buffer */
+    if ( NULL == self->ptrSpiPp[1] ) {
+        sfcb_worker_fsm(self);
+        sfcb_trace_rec(self);
+        sfcb_stats_rec(self);
+        return;
+    }
+    self->uint16SpiOut = 0; // no new packet
+    /* response in transfer, queue read ahead behind */
+    if ( 0 != self->uint8PpBsy[self->uint8PpCur] ) {
+        (void) sfcb_pp_ahead(self);
+        sfcb_trace_rec(self);
+        sfcb_stats_rec(self);
+        return;
+    }
+    sfcb_worker_fsm(self);
+    uint8Oth = (uint8_t) (self->uint8PpCur ^ 1);
+    /* queued read ahead is the next read, continue with it */
+    if ( 0 != self->uint8PpAhead ) {
+        self->uint8PpAhead = 0;
+        if ( (self->uint16SpiLen == self->uint16PpLen) && (self->uint32IterAdr == self->uint32PpAdr) ) {
+            self->uint8PpCur = uint8Oth;
+            self->uint8PtrSpi = self->ptrSpiPp[uint8Oth];
+            if ( 0 != self->uint8PpBsy[uint8Oth] ) {
+                (void) sfcb_pp_ahead(self);
+            }
+            sfcb_trace_rec(self);
+            sfcb_stats_rec(self);
+            return;
+        }
+        /* stale read ahead, response is not evaluated, busy is released with its sfcb_spi_done */
+        sfcb_log_info("  INFO:%s: read ahead adr=0x%x discarded\n", __FUNCTION__, self->uint32PpAdr);
+    }
+    /* next packet */
+    if ( 0 != self->uint16SpiLen ) {
+        self->ptrSpiOut = self->uint8PtrSpi;
+        self->uint16SpiOut = self->uint16SpiLen;
+        self->uint8PpBsy[self->uint8PpCur] = 1;
+    }
+    sfcb_trace_rec(self);
+    sfcb_stats_rec(self);
+}
+
+
+
+/**
+ *  sfcb_flash_size
+ *    total flashsize
+ */
+uint32_t sfcb_flash_size (t_sfcb *self)
+{
+    return self->ptrFlash->uint32FlashSize;
+}
+
+
+
+/**
+ *  sfcb_new_cb
+ *    creates new circular buffer entry
+ */
+int sfcb_new_cb (t_sfcb *self, uint32_t magicNum, uint16_t elemSizeByte, uint32_t numElems, uint8_t *cbID)
+{
+    /** help variables **/
+    const uint32_t  elemTotalSize = (uint32_t) (elemSizeByte + 2*sizeof(spi_flash_cb_elem_head));   // payload size + header/footer size
+    uint32_t        uint32PagesPerSector;
+    uint8_t         cbNew;              // queue of circular buffer new entry number
+    uint32_t        uint32StartSector;
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    sfcb_log_info("  INFO:%s:sfcb_p = %p\n", __FUNCTION__, self);
+    /* flash descriptor assigned */
+    if ( 0 == SFCB_FL_TOPO_PAGE_SIZE(self) ) {
+        sfcb_log_ero("  ERROR:%s: no flash type selected\n", __FUNCTION__);
+        return SFCB_E_NO_FLASH;
+    }
+    uint32PagesPerSector = SFCB_FL_TOPO_SECTOR_SIZE(self) / SFCB_FL_TOPO_PAGE_SIZE(self);
+    /* check for free Slot number */
+    uint32StartSector = 0;
+    for ( cbNew = 0; cbNew < (self->uint8NumCbs); cbNew++ ) {
+        if ( 0 != (self->ptrCbs[cbNew]).uint8Used ) {   // queue is used
+            uint32StartSector = (self->ptrCbs[cbNew]).uint32StopSector + 1; // calculate start address of next queue
+        } else {
+            break;  // empty queue found
+        }
+    }
+    if ( cbNew == (self->uint8NumCbs) ) {
+        sfcb_log_ero("  ERROR:%s:sfcb_cb exceeded total available number of %i cbs\n", __FUNCTION__, (self->uint8NumCbs));
+        return SFCB_E_MEM;  // no free circular buffer slots, allocate more memory in #t_sfcb_cb table
+    }
+    /* prepare slot */
+    (self->ptrCbs[cbNew]).uint8Used = 1;        // occupied
+    (self->ptrCbs[cbNew]).uint32IdNumMax = 0;   // in case of uninitialized memory
+    (self->ptrCbs[cbNew]).uint32IdNumMin = __UINT32_MAX__;  // assign highest number
+    (self->ptrCbs[cbNew]).uint32MagicNum = magicNum;        // used magic number for the circular buffer
+    (self->ptrCbs[cbNew]).uint32NumPagesPerElem = sfcb_ceildivide_uint32(elemTotalSize, SFCB_FL_TOPO_PAGE_SIZE(self));  // calculate in multiple of pages
+    /* element divides sector or spans complete sectors, erase never hits neighbour element */
+    if ( (self->ptrCbs[cbNew]).uint32NumPagesPerElem < uint32PagesPerSector ) {
+        while ( 0 != (uint32PagesPerSector % (self->ptrCbs[cbNew]).uint32NumPagesPerElem) ) {
+            ++((self->ptrCbs[cbNew]).uint32NumPagesPerElem);
+        }
+    } else {
+        (self->ptrCbs[cbNew]).uint32NumPagesPerElem = sfcb_ceildivide_uint32((self->ptrCbs[cbNew]).uint32NumPagesPerElem, uint32PagesPerSector) * uint32PagesPerSector;
+    }
+    /* behind previous queue, block aligned if erase group covers an erase block */
+    if ( 0 != sfcb_cb_span(self, &(self->ptrCbs[cbNew]), uint32StartSector, numElems) ) {
+        sfcb_log_ero("  ERROR:%s flash size exceeded\n", __FUNCTION__);
+        return SFCB_E_FLASH_FULL;   // Flash capacity exceeded
+    }
+    (self->ptrCbs[cbNew]).uint32NumEntries = 0;
+    (self->ptrCbs[cbNew]).uint16NumFreeMin = 0; // no pre-erase
+    (self->ptrCbs[cbNew]).uint16PlSize = elemSizeByte;  // element size, needed to determine footer write
+    (self->ptrCbs[cbNew]).uint16PlFlashOfs = 0;    // no element open
+    (self->ptrCbs[cbNew]).uint16RecSize = 0;    // element queue
+    (self->ptrCbs[cbNew]).ptrStage = NULL;      // no staging buffer
+    (self->ptrCbs[cbNew]).uint16StageMax = 0;
+    (self->ptrCbs[cbNew]).uint16StageLen = 0;
+    (self->ptrCbs[cbNew]).uint32StageUs = 0;
+    (self->ptrCbs[cbNew]).uint8Crc = 0;         // footer with magic number
+    (self->ptrCbs[cbNew]).uint32CrcWr = 0;
+    (self->ptrCbs[cbNew]).uint8Fmt = 0;         // placed by sfcb_new_cb
+    (self->ptrCbs[cbNew]).ptrCodec = NULL;      // payload stored as written
+    (self->ptrCbs[cbNew]).ptrCodecBuf = NULL;
+    (self->ptrCbs[cbNew]).uint16CodecRec = 0;
+    (self->ptrCbs[cbNew]).uint16CodecMax = 0;
+    *cbID = cbNew;
+    /* check if stop sector is in total size */
+    if ( ((self->ptrCbs[cbNew]).uint32StopSector+1) * SFCB_FL_TOPO_SECTOR_SIZE(self) > SFCB_FL_TOPO_FLASH_SIZE(self) ) {
+        sfcb_log_ero("  ERROR:%s flash size exceeded\n", __FUNCTION__);
+        return SFCB_E_FLASH_FULL;   // Flash capacity exceeded
+    }
+    /* print slot config */
+    sfcb_log_info("  INFO:%s:ptrCbs[%i]_p                     = %p\n",   __FUNCTION__, cbNew, (&self->ptrCbs[cbNew]));
+    sfcb_log_info("  INFO:%s:ptrCbs[%i].uint8Used             = %d\n",   __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint8Used);
+    sfcb_log_info("  INFO:%s:ptrCbs[%i].uint32NumPagesPerElem = %u\n",   __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint32NumPagesPerElem);
+    sfcb_log_info("  INFO:%s:ptrCbs[%i].uint32StartSector     = 0x%x\n", __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint32StartSector);
+    sfcb_log_info("  INFO:%s:ptrCbs[%i].uint32StopSector      = 0x%x\n", __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint32StopSector);
+    sfcb_log_info("  INFO:%s:ptrCbs[%i].uint32NumEntriesMax   = %u\n",   __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint32NumEntriesMax);
+    /* succesfull */
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_new_pack
+ *    creates queue with records packed into single page elements
+ */
+int sfcb_new_pack (t_sfcb *self, uint32_t magicNum, uint16_t recSize, uint32_t numRecs, uint8_t *cbID)
+{
+    /** help variables **/
+    uint32_t    uint32RecPerElem;   // record slots per element
+    int         intRet;             // return value
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* flash descriptor assigned */
+    if ( 0 == SFCB_FL_TOPO_PAGE_SIZE(self) ) {
+        sfcb_log_ero("  ERROR:%s: no flash type selected\n", __FUNCTION__);
+        return SFCB_E_NO_FLASH;
+    }
+    /* records per page, header and footer of element in same page */
+    uint32RecPerElem = ((uint32_t) SFCB_FL_TOPO_PAGE_SIZE(self) - 2 * (uint32_t) sizeof(spi_flash_cb_elem_head)) / ((uint32_t) recSize + SFCB_REC_HEAD_SIZE);
+    if ( (0 == recSize) || (uint32RecPerElem < 2) ) {
+        sfcb_log_ero("  ERROR:%s: recSize=%d, less than two records per page\n", __FUNCTION__, recSize);
+        return SFCB_E_MEM;
+    }
+    intRet = sfcb_new_cb(self, magicNum, (uint16_t) (uint32RecPerElem * ((uint32_t) recSize + SFCB_REC_HEAD_SIZE)), sfcb_ceildivide_uint32(numRecs, uint32RecPerElem), cbID);
+    if ( SFCB_OK != intRet ) {
+        return intRet;
+    }
+    (self->ptrCbs[*cbID]).uint16RecSize = recSize;
+    sfcb_log_info("  INFO:%s:ptrCbs[%i].uint16RecSize         = %u, records per element = %u\n", __FUNCTION__, *cbID, recSize, uint32RecPerElem);
+    /* succesfull */
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_new_ckpt
+ *    creates checkpoint queue
+ */
+int sfcb_new_ckpt (t_sfcb *self, uint32_t magicNum, uint16_t numElems, void *buf, uint16_t bufLen, uint8_t *cbID)
+{
+    /** help variables **/
+    const uint32_t  uint32CkptSize = sfcb_ckpt_len(self) + (uint32_t) sizeof(uint32_t);    // snapshot of all queues, erase cycles and CRC
+    int             intRet;
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* checkpoint already present */
+    if ( NULL != self->ptrCkpt ) {
+        sfcb_log_ero("  ERROR:%s: only one checkpoint queue allowed\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    /* check for enough memory */
+    if ( bufLen < uint32CkptSize ) {
+        sfcb_log_ero("  ERROR:%s: checkpoint buffer to small, is=%d byte, req=%d byte\n", __FUNCTION__, bufLen, uint32CkptSize);
+        return SFCB_E_MEM;
+    }
+    /* allocate queue */
+    intRet = sfcb_new_cb(self, magicNum, (uint16_t) uint32CkptSize, numElems, cbID);
+    if ( SFCB_OK != intRet ) {
+        return intRet;
+    }
+    /* register checkpoint */
+    self->ptrCkpt = buf;
+    self->uint8CkptCb = *cbID;
+    /* succesfull */
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_ckpt
+ *    writes snapshot of queue management data into checkpoint queue
+ */
+int sfcb_ckpt (t_sfcb *self)
+{
+    /** Variables **/
+    t_sfcb_ckpt_elem    ckpt;       // snapshot of one queue
+    t_sfcb_cb*          cb;         // queue
+    uint32_t            uint32Crc;  // snapshot CRC
+    uint32_t            uint32Len;  // snapshot size without CRC
+    uint32_t            uint32Base; // erase cycles base
+    uint16_t            uint16Ofs;  // erase cycles offset
+    int                 intRet;     // state of add
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* no jobs pending */
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_CKPT, 0, 0, NULL, 0);  // queue request
+    }
+    /* checkpoint available */
+    if ( NULL == self->ptrCkpt ) {
+        sfcb_log_ero("  ERROR:%s: no checkpoint queue\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;
+    }
+    /* assemble snapshot, only valid queues */
+    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
+        cb = &((self->ptrCbs)[i]);
+        memset(&ckpt, 0, sizeof(ckpt));
+        if ( (0 != cb->uint8Used) && (0 != cb->uint8MgmtValid) && (0 == cb->uint16PlFlashOfs) && (i != self->uint8CkptCb) ) {
+            ckpt.uint32MagicNum = cb->uint32MagicNum;
+            ckpt.uint32IdNumMax = cb->uint32IdNumMax;
+            ckpt.uint32IdNumMin = cb->uint32IdNumMin;
+            ckpt.uint32StartPageWrite = cb->uint32StartPageWrite;
+            ckpt.uint32StartPageIdMin = cb->uint32StartPageIdMin;
+            ckpt.uint32StartPageIdMax = cb->uint32StartPageIdMax;
+            ckpt.uint32NumEntries = cb->uint32NumEntries;
+            ckpt.uint32StartSector = cb->uint32StartSector;
+            ckpt.uint32StopSector = cb->uint32StopSector;
+        }
+        memcpy(((uint8_t*) self->ptrCkpt) + i*sizeof(t_sfcb_ckpt_elem), &ckpt, sizeof(ckpt));
+    }
+    uint32Len = (uint32_t) (self->uint8NumCbs * sizeof(t_sfcb_ckpt_elem));
+    /* erase cycles, 32bit base and saturated 16bit offset per sector */
+    if ( NULL != self->ptrWear ) {
+        uint32Base = __UINT32_MAX__;
+        for ( uint32_t i = 0; i < self->uint32WearNum; i++ ) {
+            uint32Base = sfcb_min(uint32Base, self->ptrWear[i]);
+        }
+        memcpy(((uint8_t*) self->ptrCkpt) + uint32Len, &uint32Base, sizeof(uint32Base));
+        uint32Len += (uint32_t) sizeof(uint32Base);
+        for ( uint32_t i = 0; i < self->uint32WearNum; i++ ) {
+            uint16Ofs = (uint16_t) sfcb_min(self->ptrWear[i] - uint32Base, (uint32_t) __UINT16_MAX__);
+            memcpy(((uint8_t*) self->ptrCkpt) + uint32Len, &uint16Ofs, sizeof(uint16Ofs));
+            uint32Len += (uint32_t) sizeof(uint16Ofs);
+        }
+    }
+    uint32Crc = sfcb_crc32(0, self->ptrCkpt, uint32Len);
+    memcpy(((uint8_t*) self->ptrCkpt) + uint32Len, &uint32Crc, sizeof(uint32Crc));
+    /* append to checkpoint queue */
+    intRet = sfcb_add(self, self->uint8CkptCb, self->ptrCkpt, ((self->ptrCbs)[self->uint8CkptCb]).uint16PlSize);
+    if ( SFCB_OK == intRet ) {
+        sfcb_job_set(&(self->jobAct), SFCB_API_CKPT, 0, 0, NULL, 0);
+    }
+    return intRet;
+}
+
+
+
+/**
+ *  sfcb_init_wear
+ *    registers erase cycle table
+ */
+int sfcb_init_wear (t_sfcb *self, uint32_t *wear, uint32_t num)
+{
+    /* table is part of checkpoint size */
+    if ( NULL != self->ptrCkpt ) {
+        sfcb_log_ero("  ERROR:%s: checkpoint queue already created\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* at least one sector */
+    if ( (NULL != wear) && (0 == num) ) {
+        sfcb_log_ero("  ERROR:%s: empty erase cycle table\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    self->ptrWear = wear;
+    self->uint32WearNum = (NULL == wear) ? 0 : num;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_place_cb
+ *    resizes or relocates queue
+ */
+int sfcb_place_cb (t_sfcb *self, uint8_t cbID, uint32_t startSector, uint32_t numElems)
+{
+    /** Variables **/
+    t_sfcb_cb   place;  // new placement
+
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* check for idle worker */
+    if ( (0 != self->uint8Busy) || (0 != self->uint8JobCnt) ) {
+        sfcb_log_ero("  ERROR:%s: worker busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* check if requested circular buffer queue exist, checkpoint queue keeps sfcb_new_cb placement */
+    if ( !(cbID < self->uint8NumCbs) || (0 == ((self->ptrCbs)[cbID]).uint8Used) || ((NULL != self->ptrCkpt) && (cbID == self->uint8CkptCb)) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;
+    }
+    /* element open */
+    if ( (0 != ((self->ptrCbs)[cbID]).uint16PlFlashOfs) || (0 != ((self->ptrCbs)[cbID]).uint16StageLen) ) {
+        sfcb_log_ero("  ERROR:%s: element open, run sfcb_add_done\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* new sector range */
+    place = (self->ptrCbs)[cbID];
+    numElems = (0 == numElems) ? place.uint32NumEntriesMax : numElems;
+    if ( SFCB_PLACE_AUTO == startSector ) {
+        if ( 0 != sfcb_place_auto(self, cbID, &place, numElems) ) {
+            sfcb_log_ero("  ERROR:%s: no free flash range\n", __FUNCTION__);
+            return SFCB_E_FLASH_FULL;
+        }
+    } else if (    (0 != sfcb_cb_span(self, &place, startSector, numElems))
+                || !(place.uint32StopSector < (SFCB_FL_TOPO_FLASH_SIZE(self) / SFCB_FL_TOPO_SECTOR_SIZE(self)))
+                || (0 != sfcb_cb_overlap(self, cbID, place.uint32StartSector, place.uint32StopSector))
+    ) {
+        sfcb_log_ero("  ERROR:%s: flash size exceeded or used by other queue\n", __FUNCTION__);
+        return SFCB_E_FLASH_FULL;
+    }
+    sfcb_log_info("  INFO:%s: cb=%d, sectors=0x%x..0x%x, entries=%d\n", __FUNCTION__, cbID, place.uint32StartSector, place.uint32StopSector, place.uint32NumEntriesMax);
+    /* drop elements, rebuild with sfcb_mkcb */
+    ((self->ptrCbs)[cbID]).uint32StartSector = place.uint32StartSector;
+    ((self->ptrCbs)[cbID]).uint32StopSector = place.uint32StopSector;
+    ((self->ptrCbs)[cbID]).uint32NumEntriesMax = place.uint32NumEntriesMax;
+    sfcb_mkcb_qrst(&((self->ptrCbs)[cbID]));
+    ((self->ptrCbs)[cbID]).uint8Fmt = 1;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_pre_erase
+ *    sets pre-erase watermark
+ */
+int sfcb_pre_erase (t_sfcb *self, uint8_t cbID, uint16_t numFree)
+{
+    /* check if requested circular buffer queue exist */
+    if ( !(cbID < self->uint8NumCbs) || (0 == ((self->ptrCbs)[cbID]).uint8Used) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;
+    }
+    ((self->ptrCbs)[cbID]).uint16NumFreeMin = numFree;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_stage_cfg
+ *    assigns RAM staging buffer to queue, combines small appends to page programs
+ */
+int sfcb_stage_cfg (t_sfcb *self, uint8_t cbID, void *buf, uint16_t bufLen, uint32_t timeoutUs)
+{
+    /* check if requested circular buffer queue exist */
+    if ( !(cbID < self->uint8NumCbs) || (0 == ((self->ptrCbs)[cbID]).uint8Used) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;
+    }
+    /* staged bytes pending */
+    if ( 0 != ((self->ptrCbs)[cbID]).uint16StageLen ) {
+        sfcb_log_ero("  ERROR:%s: staged bytes pending, run sfcb_add_done\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* buffer holds at least one page, no record codec */
+    if ( (NULL != buf) && ((bufLen < SFCB_FL_TOPO_PAGE_SIZE(self)) || (NULL != ((self->ptrCbs)[cbID]).ptrCodec)) ) {
+        sfcb_log_ero("  ERROR:%s: staging buffer=%d smaller then page or record codec\n", __FUNCTION__, bufLen);
+        return SFCB_E_MEM;
+    }
+    ((self->ptrCbs)[cbID]).ptrStage = (uint8_t*) buf;
+    ((self->ptrCbs)[cbID]).uint16StageMax = (NULL == buf) ? 0 : bufLen;
+    ((self->ptrCbs)[cbID]).uint32StageUs = timeoutUs;
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_crc_cfg
+ *    enables payload CRC32 in element footer
  */
-uint32_t sfcb_flash_size (void)
+int sfcb_crc_cfg (t_sfcb *self, uint8_t cbID, uint8_t en)
 {
-    return (uint32_t) SFCB_FLASH_TOPO_FLASH_SIZE;
+    /* check if requested circular buffer queue exist, packed queues are not supported */
+    if ( !(cbID < self->uint8NumCbs) || (0 == ((self->ptrCbs)[cbID]).uint8Used) || (0 != ((self->ptrCbs)[cbID]).uint16RecSize) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active, present or packed\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;
+    }
+    /* element open */
+    if ( (0 != ((self->ptrCbs)[cbID]).uint16PlFlashOfs) || (0 != ((self->ptrCbs)[cbID]).uint16StageLen) ) {
+        sfcb_log_ero("  ERROR:%s: element open, run sfcb_add_done\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    ((self->ptrCbs)[cbID]).uint8Crc = (uint8_t) (0 != en);
+    ((self->ptrCbs)[cbID]).uint32CrcWr = 0;
+    return SFCB_OK;
 }
 
 
 
 /**
- *  sfcb_new_cb
- *    creates new circular buffer entry
+ *  sfcb_codec_cfg
+ *    stores records of queue encoded
  */
-int sfcb_new_cb (t_sfcb *self, uint32_t magicNum, uint16_t elemSizeByte, uint16_t numElems, uint8_t *cbID)
+int sfcb_codec_cfg (t_sfcb *self, uint8_t cbID, uint16_t recSize, void *buf, uint16_t bufLen, const t_sfcb_codec *codec)
 {
-    /** help variables **/
-    const uint8_t   uint8PagesPerSector = (uint8_t) (SFCB_FLASH_TOPO_SECTOR_SIZE / SFCB_FLASH_TOPO_PAGE_SIZE);
-    const uint16_t  elemTotalSize = (uint16_t) (elemSizeByte + 2*sizeof(spi_flash_cb_elem_head));   // payload size + header/footer size
-    uint8_t         cbNew;              // queue of circular buffer new entry number
-    uint32_t        uint32StartSector;
-    uint16_t        uint16NumSectors;
+    /** Variables **/
+    t_sfcb_cb*  cb; // configured queue
 
-    /* Function call message */
-    sfcb_printf("__FUNCTION__ = %s\n", __FUNCTION__);
-    sfcb_printf("  INFO:%s:sfcb_p = %p\n", __FUNCTION__, self);
-    /* check for free Slot number */
-    uint32StartSector = 0;
-    for ( cbNew = 0; cbNew < (self->uint8NumCbs); cbNew++ ) {
-        if ( 0 != (self->ptrCbs[cbNew]).uint8Used ) {   // queue is used
-            uint32StartSector = (self->ptrCbs[cbNew]).uint32StopSector + 1; // calculate start address of next queue
-        } else {
-            break;  // empty queue found
-        }
+    /* check if requested circular buffer queue exist, packed queues are not supported */
+    if ( !(cbID < self->uint8NumCbs) || (0 == ((self->ptrCbs)[cbID]).uint8Used) || (0 != ((self->ptrCbs)[cbID]).uint16RecSize) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active, present or packed\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;
     }
-    if ( cbNew == (self->uint8NumCbs) ) {
-        sfcb_printf("  ERROR:%s:sfcb_cb exceeded total available number of %i cbs\n", __FUNCTION__, (self->uint8NumCbs));
-        return SFCB_E_MEM;  // no free circular buffer slots, allocate more memory in #t_sfcb_cb table
+    cb = &((self->ptrCbs)[cbID]);
+    /* element open */
+    if ( (0 != cb->uint16PlFlashOfs) || (0 != cb->uint16StageLen) ) {
+        sfcb_log_ero("  ERROR:%s: element open, run sfcb_add_done\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
     }
-    /* prepare slot */
-    (self->ptrCbs[cbNew]).uint8Used = 1;        // occupied
-    (self->ptrCbs[cbNew]).uint32IdNumMax = 0;   // in case of uninitialized memory
-    (self->ptrCbs[cbNew]).uint32IdNumMin = __UINT32_MAX__;  // assign highest number
-    (self->ptrCbs[cbNew]).uint32MagicNum = magicNum;        // used magic number for the circular buffer
-    (self->ptrCbs[cbNew]).uint16NumPagesPerElem = (uint16_t) sfcb_ceildivide_uint32(elemTotalSize, SFCB_FLASH_TOPO_PAGE_SIZE);  // calculate in multiple of pages
-    (self->ptrCbs[cbNew]).uint32StartSector = uint32StartSector;
-    uint16NumSectors = (uint16_t) sfcb_max(2, (uint16_t) sfcb_ceildivide_uint32((uint32_t) (numElems*((self->ptrCbs[cbNew]).uint16NumPagesPerElem)), uint8PagesPerSector));
-    (self->ptrCbs[cbNew]).uint32StopSector = (self->ptrCbs[cbNew]).uint32StartSector+uint16NumSectors-1;
-    (self->ptrCbs[cbNew]).uint16NumEntriesMax = (uint16_t) (uint16NumSectors*uint8PagesPerSector) / (self->ptrCbs[cbNew]).uint16NumPagesPerElem;
-    (self->ptrCbs[cbNew]).uint16NumEntries = 0;
-    (self->ptrCbs[cbNew]).uint16PlSize = elemSizeByte;  // element size, needed to determine footer write
-    *cbID = cbNew;
-    /* check if stop sector is in total size */
-    if ( ((self->ptrCbs[cbNew]).uint32StopSector+1) * SFCB_FLASH_TOPO_SECTOR_SIZE > SFCB_FLASH_TOPO_FLASH_SIZE ) {
-        sfcb_printf("  ERROR:%s flash size exceeded\n", __FUNCTION__);
-        return SFCB_E_FLASH_FULL;   // Flash capacity exceeded
+    /* disable */
+    if ( (0 == recSize) || (NULL == buf) ) {
+        cb->ptrCodec = NULL;
+        cb->ptrCodecBuf = NULL;
+        cb->uint16CodecRec = 0;
+        cb->uint16CodecMax = 0;
+        return SFCB_OK;
     }
-    /* print slot config */
-    sfcb_printf("  INFO:%s:ptrCbs[%i]_p                     = %p\n",   __FUNCTION__, cbNew, (&self->ptrCbs[cbNew]));
-    sfcb_printf("  INFO:%s:ptrCbs[%i].uint8Used             = %d\n",   __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint8Used);
-    sfcb_printf("  INFO:%s:ptrCbs[%i].uint16NumPagesPerElem = %d\n",   __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint16NumPagesPerElem);
-    sfcb_printf("  INFO:%s:ptrCbs[%i].uint32StartSector     = 0x%x\n", __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint32StartSector);
-    sfcb_printf("  INFO:%s:ptrCbs[%i].uint32StopSector      = 0x%x\n", __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint32StopSector);
-    sfcb_printf("  INFO:%s:ptrCbs[%i].uint16NumEntriesMax   = %d\n",   __FUNCTION__, cbNew, (self->ptrCbs[cbNew]).uint16NumEntriesMax);
-    /* succesfull */
+    /* reference, decoded record and worst case encoded record fit, no staging */
+    if (    (NULL != cb->ptrStage)
+         || (bufLen < (2 * (uint32_t) recSize + SFCB_CODEC_HEAD + ((NULL == codec) ? SFCB_CODEC_HEAD + (uint32_t) recSize : 1)))
+         || ((bufLen - 2 * (uint32_t) recSize) > cb->uint16PlSize)
+    ) {
+        sfcb_log_ero("  ERROR:%s: recSize=%d, bufLen=%d, payload=%d not supported\n", __FUNCTION__, recSize, bufLen, cb->uint16PlSize);
+        return SFCB_E_MEM;
+    }
+    cb->ptrCodec = (NULL == codec) ? &g_sfcbCodecDelta : codec;
+    cb->ptrCodecBuf = (uint8_t*) buf;
+    cb->uint16CodecRec = recSize;
+    cb->uint16CodecMax = (uint16_t) (bufLen - 2 * (uint32_t) recSize);
+    sfcb_log_info("  INFO:%s: cb=%d, record=%d, code max=%d\n", __FUNCTION__, cbID, recSize, cb->uint16CodecMax);
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_wip_cfg
+ *    configures WIP polling
+ */
+int sfcb_wip_cfg (t_sfcb *self, uint16_t stsLen, t_sfcb_tick tick, uint32_t tickUs, uint32_t pollUs)
+{
+    /* check for idle worker */
+    if ( 0 != self->uint8Busy ) {
+        sfcb_log_ero("  ERROR:%s: worker busy\n", __FUNCTION__);
+        return SFCB_E_WKR_BSY;
+    }
+    /* continuous status register read supported, fits into spi buffer? */
+    if ( (0 == stsLen) || ((1 < stsLen) && (0 == SFCB_FL_MNG_RDSR_CONT(self))) || !(stsLen < self->uint16SpiMax) ) {
+        sfcb_log_ero("  ERROR:%s: status length=%d not supported\n", __FUNCTION__, stsLen);
+        return SFCB_E_MEM;
+    }
+    /* tick source requires period */
+    if ( (NULL != tick) && (0 == tickUs) ) {
+        sfcb_log_ero("  ERROR:%s: tick period is zero\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    self->uint16WipLen = stsLen;
+    self->ptrTick = tick;
+    self->uint32TickUs = tickUs;
+    self->uint32WipPollUs = pollUs;
+    self->uint32WipUs = 0;  // no completion time of pending operation
     return SFCB_OK;
 }
 
 
 
+/**
+ *  sfcb_wip_hint
+ *    remaining time of pending program/erase
+ */
+uint32_t sfcb_wip_hint (t_sfcb *self, uint32_t *tick)
+{
+    /** Variables **/
+    int32_t int32Left;  // remaining ticks
+
+    /* no operation pending */
+    if ( 0 == self->uint32WipUs ) {
+        return 0;
+    }
+    /* without tick source only typical duration */
+    if ( NULL == self->ptrTick ) {
+        return self->uint32WipUs;
+    }
+    if ( NULL != tick ) {
+        *tick = self->uint32WipTick;
+    }
+    int32Left = (int32_t) (self->uint32WipTick - self->ptrTick());
+    if ( !(0 < int32Left) ) {
+        return 0;
+    }
+    return (uint32_t) int32Left * self->uint32TickUs;
+}
+
+
+
 /**
  *  sfcb_busy
  *    checks if #sfcb_worker is free for new requests
@@ -720,6 +5288,10 @@ int sfcb_busy (t_sfcb *self)
     if ( 0 != self->uint8Busy ) {
         return -1;  // busy
     }
+    /* record ring not empty, needs worker */
+    if ( 0 != sfcb_ring_rdy(self) ) {
+        return -1;
+    }
     return 0;
 }
 
@@ -731,11 +5303,94 @@ int sfcb_busy (t_sfcb *self)
  */
 uint16_t sfcb_spi_len (t_sfcb *self)
 {
+    if ( NULL != self->ptrSpiPp[1] ) {
+        return self->uint16SpiOut;  // ping-pong, new packet only
+    }
     return self->uint16SpiLen;
 }
 
 
 
+/**
+ *  sfcb_spi_buf
+ *    gets buffer of next spi packet
+ */
+uint8_t* sfcb_spi_buf (t_sfcb *self)
+{
+    if ( NULL != self->ptrSpiPp[1] ) {
+        return self->ptrSpiOut;
+    }
+    return self->uint8PtrSpi;
+}
+
+
+
+/**
+ *  sfcb_spi_done
+ *    marks ping-pong buffer transfer complete
+ */
+void sfcb_spi_done (t_sfcb *self, const void *spi)
+{
+    for ( uint8_t i = 0; i < 2; i++ ) {
+        if ( (NULL != spi) && (spi == self->ptrSpiPp[i]) ) {
+            self->uint8PpBsy[i] = 0;    // single byte store, no read-modify-write with worker
+        }
+    }
+}
+
+
+
+/**
+ *  sfcb_next_packet
+ *    runs worker until next spi packet
+ */
+int sfcb_next_packet (t_sfcb *self, uint8_t **spi, uint16_t *len)
+{
+    *len = 0;
+    /* packet in transfer */
+    if ( (NULL == self->ptrSpiPp[1]) && (0 != self->uint8PpBsy[0]) ) {
+        return SFCB_E_WKR_WAIT;
+    }
+    while ( 1 ) {
+        sfcb_worker(self);
+        /* next packet */
+        if ( 0 != sfcb_spi_len(self) ) {
+            *spi = sfcb_spi_buf(self);
+            *len = sfcb_spi_len(self);
+            if ( NULL == self->ptrSpiPp[1] ) {
+                self->uint8PpBsy[0] = 1;    // released by sfcb_spi_done
+            }
+            return SFCB_OK;
+        }
+        /* idle worker, nothing created */
+        if ( 0 == self->uint8Busy ) {
+            if ( 0 != sfcb_stage_wait(self) ) {
+                return SFCB_E_WKR_WAIT;
+            }
+            return SFCB_E_WKR_IDLE;
+        }
+        /* ping-pong response in transfer, or tick gated WIP poll */
+        if (    (0 != self->uint8PpBsy[0]) || (0 != self->uint8PpBsy[1])
+             || ((NULL != self->ptrTick) && (0 != sfcb_wip_hint(self, NULL)))
+        ) {
+            return SFCB_E_WKR_WAIT;
+        }
+    }
+}
+
+
+
+/**
+ *  sfcb_spi_xfer
+ *    gets transfer mode of next spi packet
+ */
+const t_sfcb_xfer* sfcb_spi_xfer (t_sfcb *self)
+{
+    return &(self->xfer);
+}
+
+
+
 /**
  *  sfcb_mkcb
  *    build up queues with circular buffer
@@ -743,45 +5398,41 @@ uint16_t sfcb_spi_len (t_sfcb *self)
 int sfcb_mkcb (t_sfcb *self)
 {
     /* Function call message */
-    sfcb_printf("__FUNCTION__ = %s\n", __FUNCTION__);
-    sfcb_printf("  INFO:%s:sfcb_p = %p\n", __FUNCTION__, self);
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    sfcb_log_info("  INFO:%s:sfcb_p = %p\n", __FUNCTION__, self);
     /* no jobs pending */
-    if ( 0 != self->uint8Busy ) {
-        sfcb_printf("  ERROR:%s: Worker is busy\n", __FUNCTION__);
-        return SFCB_E_WKR_BSY;  // busy
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_MKCB, 0, 0, NULL, 0);  // queue request
     }
     /* check for at least one active queue */
     if ( 0 == ((self->ptrCbs)[0]).uint8Used ) {
-        sfcb_printf("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
         return SFCB_E_NO_CB_Q;  // circular buffer queue not active
     }
-    /* Find first queue which needs an build */
-    self->uint8IterCb = 0;
-    for ( uint8_t i = 0; i < self->uint8NumCbs; i++ ) {
-        if ( (0 == ((self->ptrCbs)[i]).uint8Used) || (0 == ((self->ptrCbs)[i]).uint8MgmtValid) ) {
-            break;
-        }
-        self->uint8IterCb = i;  // search for queue with uninitialized or invalid managment data, in case of only on circular buffer needes to rebuild
-    }
     /* reset idmin/idmax counter to enable select of correct page to erase */
-    for ( uint8_t i = self->uint8IterCb; i < (self->uint8NumCbs); i++ ) {
+    for ( uint8_t i = 0; i < (self->uint8NumCbs); i++ ) {
         /* not used, leave */
         if ( 0 == ((self->ptrCbs)[i]).uint8Used ) {
             break;
         }
         /* dirty buffer, needs to rebuild absoulte idmin/idmax for next write, otherwise will the last written element deleted */
         if ( 0 == ((self->ptrCbs)[i]).uint8MgmtValid ) {
-            (self->ptrCbs[i]).uint32IdNumMax = 0;               // in case of uninitialized memory
-            (self->ptrCbs[i]).uint32IdNumMin = __UINT32_MAX__;  // assign highest number
-            (self->ptrCbs[i]).uint16PlFlashOfs = 0;             // reset payload offset counter
+            sfcb_mkcb_qrst(&((self->ptrCbs)[i]));
         }
     }
+    /* Find first queue which needs an build */
+    if ( 0 != sfcb_mkcb_nxtq(self, 0) ) {
+        self->uint8IterCb = self->uint8NumCbs;  // all queues valid, nothing to build
+    } else if ( NULL != self->ptrCkpt ) {
+        self->uint8IterCb = self->uint8CkptCb;  // checkpoint queue first, restores the other queues
+    }
     /* Setup new Job */
     self->cmd = SFCB_CMD_MKCB;
     self->uint16Iter = 0;
     self->stage = SFCB_STG00;
     self->error = SFCB_E_NOERO;
     self->uint8Busy = 1;
+    sfcb_job_set(&(self->jobAct), SFCB_API_MKCB, 0, 0, NULL, 0);
     /* fine */
     return SFCB_OK;
 }
@@ -795,42 +5446,60 @@ int sfcb_mkcb (t_sfcb *self)
  */
 int sfcb_add (t_sfcb *self, uint8_t cbID, void *data, uint16_t len)
 {
+    /** Variables **/
+    int     intRet; // staged append state
+
     /* Function call message */
-    sfcb_printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
     /* no jobs pending */
-    if ( 0 != self->uint8Busy ) {
-        sfcb_printf("  ERROR:%s: Worker is busy\n", __FUNCTION__);
-        return SFCB_E_WKR_BSY;  // Worker is busy, wait for processing last job
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_ADD, cbID, 0, data, len);  // queue request
     }
     /* check if requested circular buffer queue exist */
     if ( !(cbID < self->uint8NumCbs) ) {
-        sfcb_printf("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
         return SFCB_E_NO_CB_Q;  // circular buffer queue not present
     }
     /* check if CB is init for request */
     if (    (0 == ((self->ptrCbs)[cbID]).uint8Used)
+         || (0 == ((self->ptrCbs)[cbID]).uint8MgmtValid)
          || ( ((self->ptrCbs)[cbID]).uint16PlFlashOfs >= (((self->ptrCbs)[cbID]).uint16PlSize + sizeof(spi_flash_cb_elem_head)) )
     ) {
-        sfcb_printf("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
+        sfcb_log_ero("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
         return SFCB_E_WKR_REQ;  // Circular Buffer is not prepared for adding new element, run #sfcb_worker
     }
-    /* check for match into circular buffer size */
-    if ( (len + ((self->ptrCbs)[cbID]).uint16PlFlashOfs) > (((self->ptrCbs)[cbID]).uint16NumPagesPerElem * SFCB_FLASH_TOPO_PAGE_SIZE) ) {
-        sfcb_printf("  ERROR:%s: data segement is larger then reserved circular buffer space\n", __FUNCTION__);
+    /* record codec, encoded record */
+    if ( NULL != ((self->ptrCbs)[cbID]).ptrCodec ) {
+        return sfcb_codec_add(self, cbID, data, len);
+    }
+    /* check for match into circular buffer size, packed queue needs record header */
+    if (    (((uint32_t) len + ((self->ptrCbs)[cbID]).uint16PlFlashOfs + ((self->ptrCbs)[cbID]).uint16StageLen) > (((self->ptrCbs)[cbID]).uint32NumPagesPerElem * SFCB_FL_TOPO_PAGE_SIZE(self)))
+         || (0 != ((self->ptrCbs)[cbID]).uint16RecSize)
+    ) {
+        sfcb_log_ero("  ERROR:%s: data segement is larger then reserved circular buffer space\n", __FUNCTION__);
         return SFCB_E_MEM;  // data segement is larger then reserved circular buffer space
     }
+    /* staging buffer, collect appends */
+    if ( NULL != ((self->ptrCbs)[cbID]).ptrStage ) {
+        if ( 0 == sfcb_stage_add(self, cbID, data, len, &intRet) ) {
+            return intRet;
+        }
+    }
     /* store information for insertion */
     self->uint8IterCb = cbID;   // used as pointer to queue
-    ((self->ptrCbs)[self->uint8IterCb]).uint8MgmtValid = 0; // mark queue as dirty, for next write run #sfcb_mkcb
     self->uint32IterAdr = ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite + ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs;  // select page for write
     self->ptrCbElemPl = data;
     self->uint16CbElemPlSize = len;
     self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
+    self->uint16BatchNum = 0;   // single element
+    self->uint8AddFoot = 0;
+    self->ptrCbElemPlNext = NULL;
     /* Setup new Job */
     self->uint8Busy = 1;
     self->cmd = SFCB_CMD_ADD;
     self->stage = SFCB_STG00;
     self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_ADD, cbID, 0, data, len);
     /* fine */
     return 0;
 }
@@ -845,24 +5514,29 @@ int sfcb_add (t_sfcb *self, uint8_t cbID, void *data, uint16_t len)
 int sfcb_add_done (t_sfcb *self, uint8_t cbID)
 {
     /* Function call message */
-    sfcb_printf("__FUNCTION__ = %s\n", __FUNCTION__);
-    /* Footer still written? */
-    if ( ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs > (((self->ptrCbs)[self->uint8IterCb]).uint16PlSize + sizeof(spi_flash_cb_elem_head)) ) {
-        return SFCB_OK; // footer is still written, nothing to do
-    }
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
     /* no jobs pending */
-    if ( 0 != self->uint8Busy ) {
-        sfcb_printf("  ERROR:%s: Worker is busy\n", __FUNCTION__);
-        return SFCB_E_WKR_BSY;  // Worker is busy, wait for processing last job
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_ADD_DONE, cbID, 0, NULL, 0);  // queue request
     }
     if ( !(cbID < self->uint8NumCbs) ) {
-        sfcb_printf("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
         return SFCB_E_NO_CB_Q;  // circular buffer queue not present
     }
     /* check if CB is init for request */
-    if ( (0 != ((self->ptrCbs)[cbID]).uint8Used) && (0 != ((self->ptrCbs)[cbID]).uint8MgmtValid) ) {
-        sfcb_printf("  ERROR:%s: Circular buffer queue existent, but no payload bytes are present\n", __FUNCTION__);
-        return SFCB_E_CB_Q_MTY;  // Circular Buffer is not prepared for adding new element, run #sfcb_worker
+    if ( (0 == ((self->ptrCbs)[cbID]).uint8Used) || (0 == ((self->ptrCbs)[cbID]).uint8MgmtValid) ) {
+        sfcb_log_ero("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;  // Circular Buffer is not prepared for request, run #sfcb_mkcb
+    }
+    /* staged bytes, program with footer */
+    if ( 0 != ((self->ptrCbs)[cbID]).uint16StageLen ) {
+        sfcb_stage_flush(self, cbID, 1);
+        sfcb_job_set(&(self->jobAct), SFCB_API_ADD_DONE, cbID, 0, NULL, 0);
+        return SFCB_OK;
+    }
+    /* no open element, footer is already written */
+    if ( 0 == ((self->ptrCbs)[cbID]).uint16PlFlashOfs ) {
+        return SFCB_OK; // nothing to do
     }
     /* store information for insertion */
     self->uint8IterCb = cbID;   // used as pointer to queue
@@ -870,18 +5544,124 @@ int sfcb_add_done (t_sfcb *self, uint8_t cbID)
     self->ptrCbElemPl = NULL;
     self->uint16CbElemPlSize = 0;
     self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
-    ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs = (uint16_t) (((self->ptrCbs)[self->uint8IterCb]).uint16PlSize + sizeof(spi_flash_cb_elem_head));   // force condition for footer writer, #sfcb_worker
+    self->uint16BatchNum = 0;   // single element
+    self->uint8AddFoot = 0;
+    self->ptrCbElemPlNext = NULL;
+    sfcb_add_close(&((self->ptrCbs)[self->uint8IterCb]));   // force condition for footer writer, #sfcb_worker
     /* Setup new Job */
     self->uint8Busy = 1;
     self->cmd = SFCB_CMD_ADD;
     self->stage = SFCB_STG00;
     self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_ADD_DONE, cbID, 0, NULL, 0);
     /* fine */
     return 0;
 }
 
 
 
+/**
+ *  sfcb_add_batch
+ *    appends multiple records in one job
+ */
+int sfcb_add_batch (t_sfcb *self, uint8_t cbID, void *data, uint16_t len, uint16_t num)
+{
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* no jobs pending */
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_ADD_BATCH, cbID, num, data, len);  // queue request
+    }
+    /* check if requested circular buffer queue exist */
+    if ( !(cbID < self->uint8NumCbs) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;  // circular buffer queue not present
+    }
+    /* valid management data, no pending append */
+    if (    (0 == ((self->ptrCbs)[cbID]).uint8Used)
+         || (0 == ((self->ptrCbs)[cbID]).uint8MgmtValid)
+         || (0 != ((self->ptrCbs)[cbID]).uint16PlFlashOfs)
+         || (0 != ((self->ptrCbs)[cbID]).uint16StageLen)
+    ) {
+        sfcb_log_ero("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* record fits into element, no packed queue, no record codec */
+    if (    (0 == len) || (0 == num) || (len > ((self->ptrCbs)[cbID]).uint16PlSize)
+         || (0 != ((self->ptrCbs)[cbID]).uint16RecSize) || (NULL != ((self->ptrCbs)[cbID]).ptrCodec)
+    ) {
+        sfcb_log_ero("  ERROR:%s: len=%d, num=%d not supported\n", __FUNCTION__, len, num);
+        return SFCB_E_MEM;
+    }
+    /* store information for insertion */
+    self->uint8IterCb = cbID;   // used as pointer to queue
+    self->uint32IterAdr = ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite;  // select page for write
+    self->ptrCbElemPl = data;
+    self->uint16CbElemPlSize = len;
+    self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
+    self->uint16BatchNum = num;
+    self->uint8AddFoot = 0;
+    self->ptrCbElemPlNext = NULL;
+    /* Setup new Job */
+    self->uint8Busy = 1;
+    self->cmd = SFCB_CMD_ADD;
+    self->stage = SFCB_STG00;
+    self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_ADD_BATCH, cbID, num, data, len);
+    /* fine */
+    return SFCB_OK;
+}
+
+
+
+/**
+ *  sfcb_add_rec
+ *    appends one record to packed queue
+ */
+int sfcb_add_rec (t_sfcb *self, uint8_t cbID, void *data)
+{
+    /* Function call message */
+    sfcb_log_call("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* no jobs pending */
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_ADD_REC, cbID, 0, data, 0);  // queue request
+    }
+    /* check if requested circular buffer queue exist */
+    if ( !(cbID < self->uint8NumCbs) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;  // circular buffer queue not present
+    }
+    /* check if CB is init for request */
+    if ( (0 == ((self->ptrCbs)[cbID]).uint8Used) || (0 == ((self->ptrCbs)[cbID]).uint8MgmtValid) ) {
+        sfcb_log_ero("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* packed queue */
+    if ( 0 == ((self->ptrCbs)[cbID]).uint16RecSize ) {
+        sfcb_log_ero("  ERROR:%s: no packed queue\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    /* store information for insertion, open element has always free record slot */
+    self->uint8IterCb = cbID;   // used as pointer to queue
+    self->uint32IterAdr = ((self->ptrCbs)[self->uint8IterCb]).uint32StartPageWrite + ((self->ptrCbs)[self->uint8IterCb]).uint16PlFlashOfs;  // select page for write
+    self->ptrCbElemPl = data;
+    self->uint16CbElemPlSize = ((self->ptrCbs)[cbID]).uint16RecSize;
+    self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
+    self->uint16BatchNum = 0;   // single record
+    self->uint8AddFoot = 0;
+    self->ptrCbElemPlNext = NULL;
+    /* Setup new Job */
+    self->uint8Busy = 1;
+    self->cmd = SFCB_CMD_ADD;
+    self->stage = SFCB_STG00;
+    self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_ADD_REC, cbID, 0, data, self->uint16CbElemPlSize);
+    /* fine */
+    return SFCB_OK;
+}
+
+
+
 /**
  *  sfcb_get_pl_wrcnt
  *    returns number of payload bytes written out to flash
@@ -896,6 +5676,17 @@ uint16_t sfcb_get_pl_wrcnt (t_sfcb *self, uint8_t cbID)
 
 
 
+/**
+ *  sfcb_get_pl_stcnt
+ *    get number of staged payload bytes in RAM
+ */
+uint16_t sfcb_get_pl_stcnt (t_sfcb *self, uint8_t cbID)
+{
+    return ((self->ptrCbs)[cbID]).uint16StageLen;
+}
+
+
+
 /**
  *  sfcb_get_last
  *    get last written element from circular buffer
@@ -903,39 +5694,56 @@ uint16_t sfcb_get_pl_wrcnt (t_sfcb *self, uint8_t cbID)
 int sfcb_get_last (t_sfcb *self, uint8_t cbID, void *data, uint16_t len)
 {
     /* no jobs pending */
-    if ( 0 != self->uint8Busy ) {
-        sfcb_printf("  ERROR:%s: Worker is busy\n", __FUNCTION__);
-        return SFCB_E_WKR_BSY;  // Worker is busy, wait for processing last job
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_GET_LAST, cbID, 0, data, len);  // queue request
+    }
+    /* data buffer or read sink */
+    if ( (NULL == data) && (NULL == self->ptrSink) ) {
+        sfcb_log_ero("  ERROR:%s: no data buffer and no read sink\n", __FUNCTION__);
+        return SFCB_E_MEM;
     }
     /* check if CB queue is available */
     if ( !(cbID < self->uint8NumCbs) ) {
-        sfcb_printf("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
         return SFCB_E_NO_CB_Q;  // circular buffer queue not present
     }
     /* check if CB is init for request */
     if ( (0 == ((self->ptrCbs)[cbID]).uint8Used) || (0 == ((self->ptrCbs)[cbID]).uint8MgmtValid) ) {
-        sfcb_printf("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
+        sfcb_log_ero("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
         return SFCB_E_WKR_REQ;  // Circular Buffer is not prepared for reading element, run #sfcb_worker
     }
     /* check if at least one entry is present for getting last element */
-    if ( 0 == ((self->ptrCbs)[cbID]).uint16NumEntries ) {
-        sfcb_printf("  ERROR:%s: Cirular buffer queue has no valid entries\n", __FUNCTION__);
+    if ( 0 == ((self->ptrCbs)[cbID]).uint32NumEntries ) {
+        sfcb_log_ero("  ERROR:%s: Cirular buffer queue has no valid entries\n", __FUNCTION__);
         return SFCB_E_CB_Q_MTY;
     }
     /* limit to size of last circular buffer element */
-    if ( (len + sizeof(spi_flash_cb_elem_head)) > ((self->ptrCbs[cbID]).uint16NumPagesPerElem * SFCB_FLASH_TOPO_PAGE_SIZE) ) {
-        len = (uint16_t) (((self->ptrCbs[cbID]).uint16NumPagesPerElem * (uint16_t) SFCB_FLASH_TOPO_PAGE_SIZE) - (uint16_t) sizeof(spi_flash_cb_elem_head));
+    if ( (len + sizeof(spi_flash_cb_elem_head)) > ((self->ptrCbs[cbID]).uint32NumPagesPerElem * SFCB_FL_TOPO_PAGE_SIZE(self)) ) {
+        len = (uint16_t) (((self->ptrCbs[cbID]).uint32NumPagesPerElem * (uint16_t) SFCB_FL_TOPO_PAGE_SIZE(self)) - (uint16_t) sizeof(spi_flash_cb_elem_head));
     }
     /* prepare job */
     self->ptrCbElemPl = data;
-    self->uint16CbElemPlSize = len; // read number of requested bytes, but limited to last  element size
+    self->uint32RdLen = len;    // read number of requested bytes, but limited to last  element size
     self->uint32IterAdr = (uint32_t) (((self->ptrCbs)[cbID]).uint32StartPageIdMax + sizeof(spi_flash_cb_elem_head));    // Start address of last written element, newest circular buffer entry, header is not part of payload
-    self->uint16Iter = 0;   // used as ptrCbElemPl written pointer
+    self->uint32RdIter = 0; // used as ptrCbElemPl written pointer
+    self->uint8IterCb = cbID;
+    /* record codec: decode complete payload, last record is returned */
+    self->uint8RdDec = (uint8_t) (NULL != ((self->ptrCbs)[cbID]).ptrCodec);
+    if ( 0 != self->uint8RdDec ) {
+        self->uint32RdLen = ((self->ptrCbs)[cbID]).uint16PlSize;
+        self->uint16CbElemPlSize = (uint16_t) sfcb_min(len, ((self->ptrCbs)[cbID]).uint16CodecRec);
+        sfcb_codec_rst(self);
+    }
+    /* complete payload verified with CRC in footer */
+    self->uint8RdCrc = (uint8_t) ((0 != ((self->ptrCbs)[cbID]).uint8Crc) && (0 == ((self->ptrCbs)[cbID]).uint16RecSize) && (self->uint32RdLen >= ((self->ptrCbs)[cbID]).uint16PlSize));
+    self->uint32CrcRd = 0;
+    self->uint32CrcFoot = 0;
     /* Setup new Job */
     self->uint8Busy = 1;
     self->cmd = SFCB_CMD_GET;   // read last element in queue from flash
     self->stage = SFCB_STG00;
     self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_GET_LAST, cbID, 0, data, len);
     /* fine */
     return SFCB_OK;
 }
@@ -946,21 +5754,30 @@ int sfcb_get_last (t_sfcb *self, uint8_t cbID, void *data, uint16_t len)
  *  sfcb_flash_read
  *    reads raw binary data from flash
  */
-int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint16_t len)
+int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint32_t len)
 {
     /* no jobs pending */
-    if ( 0 != self->uint8Busy ) {
-        return SFCB_E_WKR_BSY;  // Worker is busy, wait for processing last job
+    if ( 0 != sfcb_job_wait(self) ) {
+        return sfcb_job_post(self, SFCB_API_FLASH_READ, 0, adr, data, len);  // queue request
+    }
+    /* data buffer or read sink */
+    if ( (NULL == data) && (NULL == self->ptrSink) ) {
+        sfcb_log_ero("  ERROR:%s: no data buffer and no read sink\n", __FUNCTION__);
+        return SFCB_E_MEM;
     }
     /* prepare job */
     self->ptrCbElemPl = data;
-    self->uint16CbElemPlSize = len;
+    self->uint32RdLen = len;
+    self->uint32RdIter = 0;     // used as ptrCbElemPl written pointer
     self->uint32IterAdr = adr;  // Flash RAW address
+    self->uint8RdCrc = 0;       // no element
+    self->uint8RdDec = 0;
     /* Setup new Job */
     self->uint8Busy = 1;
     self->cmd = SFCB_CMD_RAW;   // RAW read from Flash
     self->stage = SFCB_STG00;
     self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_FLASH_READ, 0, adr, data, len);
     /* fine */
     return 0;
 }
@@ -982,6 +5799,80 @@ uint32_t sfcb_idmax (t_sfcb *self, uint8_t cbID)
 
 
 
+/**
+ *  sfcb_idmin
+ *    get lowest id in queue
+ */
+uint32_t sfcb_idmin (t_sfcb *self, uint8_t cbID)
+{
+    /* check if selected queue is used */
+    if ( 0 == ((self->ptrCbs)[cbID]).uint8Used ) {
+        return 0;
+    }
+    return ((self->ptrCbs)[cbID]).uint32IdNumMin;
+}
+
+
+
+/**
+ *  sfcb_iter
+ *    iterates over queue elements
+ */
+int sfcb_iter (t_sfcb *self, uint8_t cbID, uint32_t idNum, uint32_t num, t_sfcb_iter iter, void *arg)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb;     // iterated queue
+    int         intRet; // job post state
+
+    /* no jobs pending */
+    if ( 0 != sfcb_job_wait(self) ) {
+        intRet = sfcb_job_post(self, SFCB_API_ITER, cbID, idNum, arg, num);  // queue request
+        if ( SFCB_OK == intRet ) {
+            self->ptrJobs[(self->uint8JobRd + self->uint8JobCnt - 1) % self->uint8JobMax].ptrIter = iter;
+        }
+        return intRet;
+    }
+    /* check if CB queue is available */
+    if ( !(cbID < self->uint8NumCbs) ) {
+        sfcb_log_ero("  ERROR:%s: Circular buffer queue not active or present\n", __FUNCTION__);
+        return SFCB_E_NO_CB_Q;  // circular buffer queue not present
+    }
+    cb = &((self->ptrCbs)[cbID]);
+    /* check if CB is init for request */
+    if ( (0 == cb->uint8Used) || (0 == cb->uint8MgmtValid) ) {
+        sfcb_log_ero("  ERROR:%s: Circular Buffer is not prepared for request\n", __FUNCTION__);
+        return SFCB_E_WKR_REQ;
+    }
+    /* requested element present */
+    if ( (0 == cb->uint32NumEntries) || (idNum < cb->uint32IdNumMin) || (idNum > cb->uint32IdNumMax) ) {
+        sfcb_log_ero("  ERROR:%s: Element id=0x%x not in queue\n", __FUNCTION__, idNum);
+        return SFCB_E_CB_Q_MTY;
+    }
+    if ( NULL == iter ) {
+        sfcb_log_ero("  ERROR:%s: no iterator callback\n", __FUNCTION__);
+        return SFCB_E_MEM;
+    }
+    /* prepare job */
+    self->uint8IterCb = cbID;
+    self->ptrIter = iter;
+    self->ptrIterArg = arg;
+    self->uint32ItId = idNum;
+    self->uint32ItNum = sfcb_min(num, cb->uint32IdNumMax - idNum + 1);  // limit to newest element
+    self->uint32ItSlot = (sfcb_slot_num(self, cb, cb->uint32StartPageIdMin) + (idNum - cb->uint32IdNumMin)) % cb->uint32NumEntriesMax;
+    self->uint32ItOfs = 0;
+    /* Setup new Job */
+    self->uint8Busy = 1;
+    self->cmd = SFCB_CMD_ITER;
+    self->stage = SFCB_STG00;
+    self->error = SFCB_E_NOERO;
+    sfcb_job_set(&(self->jobAct), SFCB_API_ITER, cbID, idNum, arg, num);
+    self->jobAct.ptrIter = iter;
+    /* fine */
+    return SFCB_OK;
+}
+
+
+
 /**
  *  sfcb_isero
  *    error happend in last interaction
@@ -994,3 +5885,25 @@ int sfcb_isero (t_sfcb *self)
     }
     return -1;  // error
 }
+
+
+
+/**
+ *  sfcb_error
+ *    error code of last job
+ */
+t_sfcb_error sfcb_error (t_sfcb *self)
+{
+    return self->error;
+}
+
+
+
+/**
+ *  sfcb_iter_id
+ *    element id of iterator
+ */
+uint32_t sfcb_iter_id (t_sfcb *self)
+{
+    return self->uint32ItId;
+}
@@ -35,10 +35,56 @@
 #define SFCB_E_NO_CB_Q      (1<<4)  /**< circular buffer queue not active or present */
 #define SFCB_E_WKR_REQ      (1<<5)  /**< Circular Buffer is not prepared for request, run #sfcb_worker */
 #define SFCB_E_CB_Q_MTY     (1<<6)  /**< Cirular buffer queue has no valid entries */
+#define SFCB_E_WKR_ERO      (1<<7)  /**< Worker finished job with error, see #sfcb_isero */
+#define SFCB_E_WKR_IDLE     (1<<8)  /**< Worker has no work pending, wait for next request, see #sfcb_next_packet */
+#define SFCB_E_WKR_WAIT     (1<<9)  /**< Worker waits for #sfcb_spi_done, WIP completion or staging timeout, see #sfcb_next_packet */
 /** @} */   // SFCB_E
 
 
 
+/**
+ *  @defgroup SFCB_REC
+ *  record header of packed queues, see #sfcb_new_pack
+ *  @{
+ */
+#define SFCB_REC_HEAD_SIZE  (1)     /**< Record header size in bytes, placed in front of every record */
+#define SFCB_REC_VALID      (0x5a)  /**< Record header of written record, erased 0xff marks free record slot */
+/** @} */   // SFCB_REC
+
+
+
+/**
+ *  @defgroup SFCB_PLACE
+ *  queue placement, see #sfcb_place_cb
+ *  @{
+ */
+#define SFCB_PLACE_AUTO     (0xFFFFFFFF)    /**< Start sector selected from free flash with least erase cycles, see #sfcb_init_wear */
+/** @} */   // SFCB_PLACE
+
+
+
+/**
+ *  @defgroup SFCB_CODEC
+ *  encoded records, see #sfcb_codec_cfg
+ *  @{
+ */
+#define SFCB_CODEC_HEAD             (4)     /**< Maximum bytes in front of encoded record: #SFCB_REC_VALID and code length as varint */
+#define SFCB_CODEC_BUF(recSize)     (3 * (recSize) + 2 * SFCB_CODEC_HEAD)   /**< Codec buffer size in bytes for the built-in codec */
+/** @} */   // SFCB_CODEC
+
+
+
+/**
+ *  @defgroup SFCB_RING
+ *  record ring, see #sfcb_init_ring
+ *  @{
+ */
+#define SFCB_RING_HEAD              (8)     /**< Slot header in bytes, #t_sfcb_ring_slot */
+#define SFCB_RING_SLOT(recMax)      ((SFCB_RING_HEAD + (recMax) + 3) / 4 * 4)  /**< Slot size in bytes for records up to recMax bytes, 4 byte aligned */
+/** @} */   // SFCB_RING
+
+
+
 /* C++ compatibility */
 #ifdef __cplusplus
 extern "C"
@@ -63,7 +109,9 @@ typedef enum
     SFCB_CMD_MKCB,  /**<  Make Circular Buffers */
     SFCB_CMD_ADD,   /**<  Add Element into Circular Buffer */
     SFCB_CMD_GET,   /**<  Get Data from Element of Circular buffer, there is no pop from the stack after get */
-    SFCB_CMD_RAW    /**<  Read Raw Data from flash */
+    SFCB_CMD_RAW,   /**<  Read Raw Data from flash */
+    SFCB_CMD_ERASE, /**<  Background erase of oldest sector, see #sfcb_pre_erase */
+    SFCB_CMD_ITER   /**<  Iterate over queue elements, see #sfcb_iter */
 } t_sfcb_cmd;
 
 
@@ -88,7 +136,15 @@ typedef enum
     SFCB_STG01, /**<  Stage 1, different meanings based on executed command */
     SFCB_STG02, /**<  Stage 2, different meanings based on executed command */
     SFCB_STG03, /**<  Stage 3, different meanings based on executed command */
-    SFCB_STG04  /**<  Stage 4, different meanings based on executed command */
+    SFCB_STG04, /**<  Stage 4, different meanings based on executed command */
+    SFCB_STG05, /**<  Stage 5, different meanings based on executed command */
+    SFCB_STG06, /**<  Stage 6, different meanings based on executed command */
+    SFCB_STG07, /**<  Stage 7, different meanings based on executed command */
+    SFCB_STG08, /**<  Stage 8, different meanings based on executed command */
+    SFCB_STG09, /**<  Stage 9, different meanings based on executed command */
+    SFCB_STG10, /**<  Stage 10, different meanings based on executed command */
+    SFCB_STG11, /**<  Stage 11, different meanings based on executed command */
+    SFCB_STG12  /**<  Stage 12, different meanings based on executed command */
 } t_sfcb_stage;
 
 
@@ -107,11 +163,279 @@ typedef enum
 {
     SFCB_E_NOERO,   /**<  No Error occured */
     SFCB_E_BUFSIZE, /**<  Buffer too small for operation */
-    SFCB_E_UNKBEH   /**<  Unknown behaviour observed */
+    SFCB_E_UNKBEH,  /**<  Unknown behaviour observed */
+    SFCB_E_ELEM,    /**<  Element header or footer invalid */
+    SFCB_E_CRC,     /**<  Payload CRC mismatch, see #sfcb_crc_cfg */
+    SFCB_E_CODEC    /**<  Encoded record invalid, see #sfcb_codec_cfg */
 } t_sfcb_error;
 
 
 
+/**
+ *  @typedef t_sfcb_api
+ *
+ *  @brief  API request
+ *
+ *  Public function which requested the job, see #t_sfcb_job
+ *
+ *  @since  2026-10-14
+ */
+typedef enum
+{
+    SFCB_API_NONE,          /**<  No request */
+    SFCB_API_MKCB,          /**<  #sfcb_mkcb */
+    SFCB_API_ADD,           /**<  #sfcb_add */
+    SFCB_API_ADD_DONE,      /**<  #sfcb_add_done */
+    SFCB_API_GET_LAST,      /**<  #sfcb_get_last */
+    SFCB_API_FLASH_READ,    /**<  #sfcb_flash_read */
+    SFCB_API_CKPT,          /**<  #sfcb_ckpt */
+    SFCB_API_ITER,          /**<  #sfcb_iter */
+    SFCB_API_ADD_BATCH,     /**<  #sfcb_add_batch */
+    SFCB_API_ADD_REC        /**<  #sfcb_add_rec */
+} t_sfcb_api;
+
+
+
+/**
+ *  @typedef t_sfcb_iter
+ *
+ *  @brief  Element iterator callback
+ *
+ *  Called by #sfcb_worker for every payload chunk of the iterated elements. Data
+ *  points into the SPI exchange buffer and is only valid during the call. After
+ *  the footer of an element is checked, the callback is called with data NULL.
+ *  Packed queues call it per record with record id, record offset and data NULL
+ *  after the record, free record slots are skipped. Queues with record codec call
+ *  it per decoded record with the record number in the element as offset and
+ *  with data NULL and the number of records after the element.
+ *
+ *  @param[in,out]  arg                 user argument, see #sfcb_iter
+ *  @param[in]      idNum               element id, record id for packed queues
+ *  @param[in]      ofs                 byte offset of chunk in payload, record number for codec queues
+ *  @param[in]      data                chunk data, NULL if element is complete
+ *  @param[in]      len                 number of bytes in chunk
+ *  @since          2026-10-14
+ */
+typedef void (*t_sfcb_iter)(void *arg, uint32_t idNum, uint16_t ofs, const uint8_t *data, uint16_t len);
+
+
+
+/**
+ *  @typedef t_sfcb_enc
+ *
+ *  @brief  Record encoder
+ *
+ *  encodes record against the previous record of the element,
+ *  the first record of an element against zeros, see #sfcb_codec_cfg
+ *
+ *  @param[in]      ref                 reference record
+ *  @param[in]      rec                 record
+ *  @param[in]      recSize             record size in bytes
+ *  @param[out]     code                encoded record
+ *  @param[in]      codeMax             size of code in bytes
+ *  @return         int                 number of code bytes, negative if codeMax exceeded
+ *  @since          2026-10-14
+ */
+typedef int (*t_sfcb_enc)(const uint8_t *ref, const uint8_t *rec, uint16_t recSize, uint8_t *code, uint16_t codeMax);
+
+
+
+/**
+ *  @typedef t_sfcb_dec
+ *
+ *  @brief  Record decoder
+ *
+ *  decodes record in place, rec holds the reference record of #t_sfcb_enc on entry
+ *
+ *  @param[in,out]  rec                 reference record, decoded record
+ *  @param[in]      recSize             record size in bytes
+ *  @param[in]      code                encoded record
+ *  @param[in]      codeLen             number of code bytes
+ *  @return         int                 zero if code is valid
+ *  @since          2026-10-14
+ */
+typedef int (*t_sfcb_dec)(uint8_t *rec, uint16_t recSize, const uint8_t *code, uint16_t codeLen);
+
+
+
+/**
+ *  @typedef t_sfcb_codec
+ *
+ *  @brief  Record codec
+ *
+ *  encoder and decoder of a queue with record codec, see #sfcb_codec_cfg
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_codec
+{
+    t_sfcb_enc  enc;    /**< Record encoder, #t_sfcb_enc */
+    t_sfcb_dec  dec;    /**< Record decoder, #t_sfcb_dec */
+} t_sfcb_codec;
+
+
+
+/**
+ *  @typedef t_sfcb_job
+ *
+ *  @brief  Job
+ *
+ *  Request with arguments of a public function. Requests while the
+ *  worker is busy are stored in the job queue, see #sfcb_init_jobq
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_job
+{
+    t_sfcb_api  api;        /**< requested function, #t_sfcb_api */
+    uint8_t     uint8Cb;    /**< Circular buffer queue number */
+    uint32_t    uint32Adr;  /**< Flash address, #sfcb_flash_read, start id #sfcb_iter, number of records #sfcb_add_batch */
+    void*       ptrData;    /**< Data buffer, needs to be valid until job is done, user argument #sfcb_iter */
+    uint32_t    uint32Len;  /**< Number of bytes in ptrData, number of elements #sfcb_iter */
+    t_sfcb_iter ptrIter;    /**< Element iterator callback, #sfcb_iter */
+} t_sfcb_job;
+
+
+
+/**
+ *  @typedef t_sfcb_done
+ *
+ *  @brief  Job done callback
+ *
+ *  Called by #sfcb_worker after every finished job
+ *
+ *  @param[in,out]  arg                 user argument, see #sfcb_init_jobq
+ *  @param[in]      job                 finished job, #t_sfcb_job
+ *  @param[in]      ret                 #SFCB_OK, #SFCB_E_WKR_ERO or return code of a rejected queued request
+ *  @since          2026-10-14
+ */
+typedef void (*t_sfcb_done)(void *arg, const t_sfcb_job *job, int ret);
+
+
+
+/**
+ *  @typedef t_sfcb_tick
+ *
+ *  @brief  Tick source
+ *
+ *  Free running system tick, used to skip status register polls
+ *  until the expected completion of a program or erase, see #sfcb_wip_cfg
+ *
+ *  @return         uint32_t            current tick, wraps around
+ *  @since          2026-10-14
+ */
+typedef uint32_t (*t_sfcb_tick)(void);
+
+
+
+/**
+ *  @typedef t_sfcb_sink
+ *
+ *  @brief  Read sink
+ *
+ *  Called by #sfcb_worker for every read chunk of #sfcb_get_last or #sfcb_flash_read
+ *  requested without data buffer. Data points into the SPI exchange buffer and
+ *  is only valid during the call.
+ *
+ *  @param[in,out]  arg                 user argument, see #sfcb_init_sink
+ *  @param[in]      ofs                 byte offset of chunk in requested data
+ *  @param[in]      data                chunk data
+ *  @param[in]      len                 number of bytes in chunk
+ *  @since          2026-10-14
+ */
+typedef void (*t_sfcb_sink)(void *arg, uint32_t ofs, const uint8_t *data, uint16_t len);
+
+
+
+/**
+ *  @typedef t_sfcb_trace
+ *
+ *  @brief  Trace record
+ *
+ *  Binary record of one #sfcb_worker call with SPI packet or stage transition,
+ *  stored in the trace ring, see #sfcb_init_trace
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_trace
+{
+    uint32_t    uint32Tick;     /**< Tick of the worker call, zero without tick source, see #sfcb_wip_cfg */
+    uint32_t    uint32Adr;      /**< Flash address of SPI packet, zero for instructions without address */
+    uint16_t    uint16Len;      /**< Length of SPI packet, zero if no transfer */
+    uint8_t     uint8Ist;       /**< Instruction of SPI packet */
+    uint8_t     uint8Cmd;       /**< Worker command after call, #t_sfcb_cmd */
+    uint8_t     uint8Stage;     /**< Worker stage after call, #t_sfcb_stage */
+    uint8_t     uint8Error;     /**< Worker error, #t_sfcb_error */
+    uint8_t     uint8Cb;        /**< Processed circular buffer queue */
+    uint8_t     uint8Busy;      /**< Worker busy */
+} t_sfcb_trace;
+
+
+
+/**
+ *  @typedef t_sfcb_ring_slot
+ *
+ *  @brief  Record ring slot header
+ *
+ *  Header of one slot in the record ring, followed by the record bytes,
+ *  see #sfcb_init_ring
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_ring_slot
+{
+    uint32_t    uint32Seq;      /**< Sequence: slot free for position seq, record of position seq - 1 ready */
+    uint8_t     uint8Cb;        /**< Circular buffer queue of record */
+    uint8_t     uint8Res;       /**< Reserved */
+    uint16_t    uint16Len;      /**< Number of record bytes */
+} t_sfcb_ring_slot;
+
+
+
+/**
+ *  @defgroup SFCB_STATS
+ *  dimensions of performance counters, see #t_sfcb_stats
+ *  @{
+ */
+#define SFCB_STATS_CMD      (SFCB_CMD_ITER + 1) /**< Number of command classes, #t_sfcb_cmd */
+#define SFCB_STATS_CB       (8)                 /**< Queues with erase counter, higher queue numbers are not counted */
+#define SFCB_STATS_HIST     (12)                /**< Latency histogram bins, bin 0: zero ticks, bin n: [2^(n-1), 2^n) ticks, last bin open */
+/** @} */   // SFCB_STATS
+
+
+
+/**
+ *  @typedef t_sfcb_stats
+ *
+ *  @brief  Performance counters
+ *
+ *  Sidecar of #t_sfcb, filled by #sfcb_worker in builds with SFCB_STATS_EN,
+ *  see #sfcb_init_stats. A job lasts from first worker call of the busy
+ *  worker until the worker is idle, transfers are accounted to the command
+ *  of the running job.
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_stats
+{
+    uint32_t    uint32WorkerCalls;                          /**< Number of #sfcb_worker calls */
+    uint32_t    uint32WipPolls;                             /**< Number of status register reads */
+    uint32_t    uint32SpiNum[SFCB_STATS_CMD];               /**< SPI transfers per command, #t_sfcb_cmd */
+    uint32_t    uint32SpiBytes[SFCB_STATS_CMD];             /**< SPI bytes per command */
+    uint32_t    uint32EraseSectors[SFCB_STATS_CB];          /**< Erased sectors per queue, block erase counts all covered sectors */
+    uint32_t    uint32JobNum[SFCB_STATS_CMD];               /**< Finished jobs per command */
+    uint32_t    uint32JobCalls[SFCB_STATS_CMD];             /**< Worker calls of all finished jobs per command */
+    uint32_t    uint32JobCallsMax[SFCB_STATS_CMD];          /**< Maximum worker calls of one job per command */
+    uint32_t    uint32LatMin[SFCB_STATS_CMD];               /**< Minimum job latency in ticks, requires tick source, see #sfcb_wip_cfg */
+    uint32_t    uint32LatMax[SFCB_STATS_CMD];               /**< Maximum job latency in ticks */
+    uint32_t    uint32LatHist[SFCB_STATS_CMD][SFCB_STATS_HIST]; /**< Job latency histogram per command */
+    uint32_t    uint32JobTick;                              /**< Running job: tick of first worker call */
+    uint32_t    uint32JobCall;                              /**< Running job: number of worker calls */
+    uint8_t     uint8JobCmd;                                /**< Running job: command, #SFCB_CMD_IDLE if none */
+} t_sfcb_stats;
+
+
+
 /**
  *  @typedef spi_flash_cb_elem_head
  *
@@ -147,6 +471,7 @@ typedef struct t_sfcb_cb
 {
     uint8_t     uint8Used;                  /**< Managment slot in #t_sfcb_cb table is used, try next index */
     uint8_t     uint8MgmtValid;             /**< Entry in management table like #uint32MagicNum, #uint32IdNumMax and ... is valid/invalid. In case of invalid run #sfcb_worker to update the management info in this entry */
+    uint8_t     uint8MgmtCkpt;              /**< Management data restored from checkpoint, #sfcb_worker verifies it against the flash */
     uint32_t    uint32MagicNum;             /**< Magic Number for marking valid block */
     uint32_t    uint32IdNumMax;             /**< Contents highest elment number in logical circular buffer. Circular buffer elements are ascending numbered starting at zero */
     uint32_t    uint32IdNumMin;             /**< lowest element number in circular buffer */
@@ -155,15 +480,143 @@ typedef struct t_sfcb_cb
     uint32_t    uint32StartPageWrite;       /**< Start Page number of next entry */
     uint32_t    uint32StartPageIdMin;       /**< Start page of Circular buffer entry with lowest number, used for sector erase */
     uint32_t    uint32StartPageIdMax;       /**< Start page of Circular buffer entry with highest number, used for #sfcb_get_last */
-    uint16_t    uint16NumPagesPerElem;      /**< Number of pages per element */
-    uint16_t    uint16NumEntriesMax;        /**< Maximal Number of entries in circular buffer caused by partition table */
-    uint16_t    uint16NumEntries;           /**< Number of entries in circular buffer */
+    uint32_t    uint32NumPagesPerElem;      /**< Number of pages per element */
+    uint32_t    uint32NumEntriesMax;        /**< Maximal Number of entries in circular buffer caused by partition table */
+    uint32_t    uint32NumEntries;           /**< Number of entries in circular buffer */
+    uint16_t    uint16NumFreeMin;           /**< Pre-erase watermark, minimal number of free elements, zero disables, see #sfcb_pre_erase */
     uint16_t    uint16PlFlashOfs;           /**< Stores offset in flash payload, enables splitted append operations */
     uint16_t    uint16PlSize;               /**< Size of Payload stored in the circular bufer, needed for footer write */
+    uint16_t    uint16RecSize;              /**< Record size of packed queue, zero for element queue, see #sfcb_new_pack */
+    uint8_t*    ptrStage;                   /**< Staging buffer of appends, NULL programs every #sfcb_add, see #sfcb_stage_cfg */
+    uint16_t    uint16StageMax;             /**< Size of staging buffer in bytes */
+    uint16_t    uint16StageLen;             /**< Staged payload bytes, not programmed yet */
+    uint32_t    uint32StageUs;              /**< Staging timeout in us, zero disables */
+    uint32_t    uint32StageTick;            /**< Tick of first staged byte, see #t_sfcb::ptrTick */
+    uint8_t     uint8Crc;                   /**< Footer carries payload CRC32 instead of magic number, see #sfcb_crc_cfg */
+    uint32_t    uint32CrcWr;                /**< CRC32 of programmed payload bytes of open element */
+    uint8_t     uint8Fmt;                   /**< Queue placement changed, #sfcb_mkcb erases all sectors of the queue before scan, see #sfcb_place_cb */
+    const t_sfcb_codec* ptrCodec;           /**< Record codec, NULL stores payload as written, see #sfcb_codec_cfg */
+    uint8_t*    ptrCodecBuf;                /**< Codec buffer: encoder reference, decoded record and encoded record */
+    uint16_t    uint16CodecRec;             /**< Record size of codec queue in bytes */
+    uint16_t    uint16CodecMax;             /**< Maximum size of encoded record in bytes, #SFCB_CODEC_HEAD included */
 } t_sfcb_cb;
 
 
 
+/**
+ *  @typedef t_sfcb_ckpt_elem
+ *
+ *  @brief  checkpoint entry
+ *
+ *  Snapshot of management data of one circular buffer queue.
+ *  A checkpoint consists of one entry per #t_sfcb_cb slot, the erase
+ *  cycles of the flash sectors if registered with #sfcb_init_wear, and
+ *  a CRC32. It is stored as payload in the checkpoint queue.
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_ckpt_elem
+{
+    uint32_t    uint32MagicNum;         /**< Magic Number of queue, zero marks unused entry */
+    uint32_t    uint32IdNumMax;         /**< #t_sfcb_cb::uint32IdNumMax */
+    uint32_t    uint32IdNumMin;         /**< #t_sfcb_cb::uint32IdNumMin */
+    uint32_t    uint32StartPageWrite;   /**< #t_sfcb_cb::uint32StartPageWrite */
+    uint32_t    uint32StartPageIdMin;   /**< #t_sfcb_cb::uint32StartPageIdMin */
+    uint32_t    uint32StartPageIdMax;   /**< #t_sfcb_cb::uint32StartPageIdMax */
+    uint32_t    uint32NumEntries;       /**< #t_sfcb_cb::uint32NumEntries */
+    uint32_t    uint32StartSector;      /**< #t_sfcb_cb::uint32StartSector, placement of queue, see #sfcb_place_cb */
+    uint32_t    uint32StopSector;       /**< #t_sfcb_cb::uint32StopSector */
+} __attribute__((packed)) t_sfcb_ckpt_elem;
+
+
+
+/**
+ *  @typedef t_sfcb_flash
+ *
+ *  @brief  flash descriptor
+ *
+ *  Instructions, topology and timing of one SPI flash part. The compile-time
+ *  selected part is provided by #SFCB_FLASH_DESC, further parts are described
+ *  by the user, see #sfcb_init_flash.
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_flash
+{
+    const char* charName;               /**< Flash name */
+    uint8_t     uint8IstWrEna;          /**< Instruction Write enable */
+    uint8_t     uint8IstEraseSector;    /**< Instruction Sector Erase */
+    uint8_t     uint8IstEraseBlk32;     /**< Instruction 32KB Block Erase, zero if not supported */
+    uint8_t     uint8IstEraseBlk64;     /**< Instruction 64KB Block Erase, zero if not supported */
+    uint8_t     uint8IstEraseSuspend;   /**< Instruction Erase Suspend, zero if not supported */
+    uint8_t     uint8IstEraseResume;    /**< Instruction Erase Resume */
+    uint8_t     uint8IstRdStateReg;     /**< Instruction Read Status Register */
+    uint8_t     uint8IstRdData;         /**< Instruction Read Data */
+    uint8_t     uint8IstWrPage;         /**< Instruction Write Page */
+    uint8_t     uint8IstWrPageQuad;     /**< Instruction Quad Write Page, zero if not supported */
+    uint8_t     uint8IstRdFast;         /**< Instruction Fast Read, zero if not supported */
+    uint8_t     uint8IstRdDual;         /**< Instruction Dual Output Read, zero if not supported */
+    uint8_t     uint8IstRdQuad;         /**< Instruction Quad Output Read, zero if not supported */
+    uint8_t     uint8IstRdQuadIo;       /**< Instruction Quad I/O Read, zero if not supported */
+    uint8_t     uint8RdFastDummy;       /**< Dummy bytes of fast, dual and quad output read, single lane */
+    uint8_t     uint8RdQioDummy;        /**< Mode and dummy bytes of quad I/O read, four lanes */
+    uint8_t     uint8AdrByte;           /**< Number of address bytes */
+    uint8_t     uint8WipMsk;            /**< Status register write-in-progress mask */
+    uint8_t     uint8RdsrCont;          /**< Status register continuous read, zero if not supported */
+    uint16_t    uint16PageSize;         /**< Page Size in bytes */
+    uint32_t    uint32SectorSize;       /**< Sector Size in bytes */
+    uint32_t    uint32Blk32Size;        /**< 32KB Block Size in bytes, multiple of sector size */
+    uint32_t    uint32Blk64Size;        /**< 64KB Block Size in bytes, multiple of sector size */
+    uint32_t    uint32FlashSize;        /**< Total flash size in bytes */
+    uint32_t    uint32TimePageProg;     /**< typ. page program in us, zero if unknown */
+    uint32_t    uint32TimeEraseSector;  /**< typ. sector erase in us, zero if unknown */
+    uint32_t    uint32TimeEraseBlk32;   /**< typ. 32KB block erase in us, zero if unknown */
+    uint32_t    uint32TimeEraseBlk64;   /**< typ. 64KB block erase in us, zero if unknown */
+} t_sfcb_flash;
+
+
+
+/**
+ *  @typedef t_sfcb_rdmode
+ *
+ *  @brief  read mode
+ *
+ *  Flash read instruction used for all reads, see #sfcb_xfer_cfg
+ *
+ *  @since  2026-10-14
+ */
+typedef enum
+{
+    SFCB_RD_SINGLE,     /**<  Read Data, single lane */
+    SFCB_RD_FAST,       /**<  Fast Read, single lane with dummy bytes */
+    SFCB_RD_DUAL,       /**<  Dual Output Read, data on two lanes */
+    SFCB_RD_QUAD,       /**<  Quad Output Read, data on four lanes */
+    SFCB_RD_QUAD_IO     /**<  Quad I/O Read, address, mode and data on four lanes */
+} t_sfcb_rdmode;
+
+
+
+/**
+ *  @typedef t_sfcb_xfer
+ *
+ *  @brief  transfer mode
+ *
+ *  Lane usage of the current SPI packet, see #sfcb_spi_xfer. The instruction
+ *  byte is always single lane, followed by the address and uint8Dummy dummy
+ *  bytes on uint8AdrLanes lanes, the remaining bytes on uint8DataLanes lanes.
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sfcb_xfer
+{
+    uint8_t     uint8AdrLanes;      /**< Lanes of address and dummy bytes: 1, 2, 4 */
+    uint8_t     uint8DataLanes;     /**< Lanes of data bytes: 1, 2, 4 */
+    uint8_t     uint8Dummy;         /**< Number of dummy bytes behind address, mode bits included */
+    uint8_t     uint8DummyClk;      /**< Dummy clock cycles, uint8Dummy * 8 / uint8AdrLanes */
+} t_sfcb_xfer;
+
+
+
 /**
  *  @typedef t_sfcb
  *
@@ -185,11 +638,91 @@ typedef struct t_sfcb
     t_sfcb_cmd      cmd;                    /**< Command to be executed, #t_sfcb_cmd */
     uint8_t         uint8IterCb;            /**< Iterator for splitted interaction, iterator over Circular buffers */
     uint16_t        uint16Iter;             /**< General Iterator for splitted interaction, used to iterate over bytes in circular buffer element, or to iterate over circular buffer elements itself */
+    uint32_t        uint32IterSlot;         /**< Element slot of queue scan in #sfcb_mkcb */
     uint32_t        uint32IterAdr;          /**< Flash address iterator. Contents full byte address in flash. F. e. captures last header page, next page write */
+    uint32_t        uint32IterLo;           /**< Logarithmic queue scan, lower element slot bound */
+    uint32_t        uint32IterHi;           /**< Logarithmic queue scan, upper element slot bound */
+    uint32_t        uint32IterIdFirst;      /**< Logarithmic queue scan, element ID in first slot */
+    uint32_t        uint32IterIdLast;       /**< Logarithmic queue scan, element ID in last slot */
+    uint8_t         uint8IterFlg;           /**< Logarithmic queue scan, state flags */
     t_sfcb_stage    stage;                  /**< Execution stage, from last interaction, #t_sfcb_stage */
     t_sfcb_error    error;                  /**< Error code if somehting strange happend, #t_sfcb_error */
     void*           ptrCbElemPl;            /**< Pointer to Payload data of CB Element */
     uint16_t        uint16CbElemPlSize;     /**< Size of payload data in bytes */
+    void*           ptrCkpt;                /**< Checkpoint buffer, NULL if no checkpoint queue is used, see #sfcb_new_ckpt */
+    uint8_t         uint8CkptCb;            /**< Circular buffer queue number of checkpoint queue */
+    uint8_t         uint8EraseAct;          /**< Background sector erase in progress, see #sfcb_pre_erase */
+    uint8_t         uint8EraseSus;          /**< Background sector erase suspended for read */
+    uint32_t        uint32EraseAdr;         /**< Next erase address of reclaimed flash span */
+    uint32_t        uint32EraseEnd;         /**< End of reclaimed flash span, first address behind */
+    t_sfcb_job*     ptrJobs;                /**< Job queue ring, NULL if not used, see #sfcb_init_jobq */
+    uint8_t         uint8JobMax;            /**< Job queue size */
+    uint8_t         uint8JobRd;             /**< Job queue read pointer */
+    uint8_t         uint8JobCnt;            /**< Number of queued jobs */
+    uint8_t         uint8JobPop;            /**< Queued job is started */
+    t_sfcb_job      jobAct;                 /**< Currently processed job */
+    t_sfcb_done     ptrJobDone;             /**< Job done callback, NULL if not used */
+    void*           ptrJobDoneArg;          /**< User argument of job done callback */
+    uint16_t        uint16WipLen;           /**< Number of status register bytes read by one WIP poll, see #sfcb_wip_cfg */
+    t_sfcb_tick     ptrTick;                /**< Tick source, NULL polls on every worker call */
+    uint32_t        uint32TickUs;           /**< Tick period in us */
+    uint32_t        uint32WipPollUs;        /**< Interval between status register polls after expected completion in us */
+    uint32_t        uint32WipUs;            /**< Typical duration of pending program/erase in us, zero if none */
+    uint32_t        uint32WipTick;          /**< Tick of expected completion of pending program/erase */
+    t_sfcb_sink     ptrSink;                /**< Read sink, NULL if not used, see #sfcb_init_sink */
+    void*           ptrSinkArg;             /**< User argument of read sink */
+    uint32_t        uint32RdLen;            /**< Number of requested read bytes, #sfcb_get_last, #sfcb_flash_read */
+    uint32_t        uint32RdIter;           /**< Number of read bytes */
+    uint16_t        uint16RdChunk;          /**< Maximum number of bytes per read transfer, see #sfcb_read_chunk */
+    t_sfcb_iter     ptrIter;                /**< Element iterator callback, see #sfcb_iter */
+    void*           ptrIterArg;             /**< User argument of element iterator */
+    uint32_t        uint32ItId;             /**< Element iterator, id of current element */
+    uint32_t        uint32ItNum;            /**< Element iterator, number of pending elements */
+    uint32_t        uint32ItSlot;           /**< Element iterator, slot of current element */
+    uint32_t        uint32ItOfs;            /**< Element iterator, read offset in current element */
+    spi_flash_cb_elem_head  itHead;         /**< Element iterator, header/footer of current element */
+    uint8_t         uint8ItRec;             /**< Element iterator, header of current record in packed queue */
+    uint8_t         uint8RdCrc;             /**< Read verifies payload CRC32, see #sfcb_crc_cfg */
+    uint8_t         uint8RdDec;             /**< Read decodes records, #sfcb_get_last returns last record, see #sfcb_codec_cfg */
+    uint8_t         uint8DecSt;             /**< Record decoder, state: record header, code length, code, element end or invalid */
+    uint8_t         uint8DecShift;          /**< Record decoder, bit position of next code length byte */
+    uint16_t        uint16DecLen;           /**< Record decoder, code length of current record */
+    uint16_t        uint16DecPos;           /**< Record decoder, collected code bytes of current record */
+    uint16_t        uint16DecNum;           /**< Record decoder, decoded records of current element */
+    uint32_t        uint32CrcRd;            /**< CRC32 of read payload bytes */
+    uint32_t        uint32CrcFoot;          /**< CRC32 read from footer */
+    uint16_t        uint16BatchNum;         /**< Number of pending records of #sfcb_add_batch, zero for #sfcb_add */
+    uint8_t         uint8AddFoot;           /**< Forces footer write after the last payload byte of the add job */
+    void*           ptrCbElemPlNext;        /**< Append programmed behind the staged bytes, NULL if none, see #sfcb_stage_cfg */
+    uint16_t        uint16CbElemPlNextSize; /**< Number of bytes in ptrCbElemPlNext */
+    const t_sfcb_flash* ptrFlash;           /**< Flash descriptor, see #sfcb_init_flash */
+    t_sfcb_xfer     xfer;                   /**< Transfer mode of current SPI packet, see #sfcb_spi_xfer */
+    t_sfcb_xfer     xferRd;                 /**< Transfer mode of reads, see #sfcb_xfer_cfg */
+    t_sfcb_xfer     xferWr;                 /**< Transfer mode of page programs */
+    uint8_t         uint8IstRd;             /**< Selected read instruction */
+    uint8_t         uint8IstWr;             /**< Selected page program instruction */
+    uint8_t*        ptrSpiPp[2];            /**< Ping-pong SPI buffers, second NULL in single buffer mode, see #sfcb_init_pingpong */
+    uint8_t*        ptrSpiOut;              /**< Ping-pong: buffer of next SPI packet, see #sfcb_spi_buf */
+    uint16_t        uint16SpiOut;           /**< Ping-pong: length of next SPI packet, zero if nothing to transfer */
+    uint16_t        uint16PpLen;            /**< Ping-pong: length of queued read ahead */
+    uint32_t        uint32PpAdr;            /**< Ping-pong: flash address of queued read ahead */
+    uint8_t         uint8PpCur;             /**< Ping-pong: buffer with response for the worker */
+    uint8_t         uint8PpBsy[2];          /**< Ping-pong: buffer in transfer, cleared by #sfcb_spi_done */
+    uint8_t         uint8PpAhead;           /**< Ping-pong: read ahead queued in other buffer */
+    t_sfcb_trace*   ptrTrace;               /**< Trace ring, NULL if not used, see #sfcb_init_trace */
+    uint16_t        uint16TraceMax;         /**< Number of records in trace ring */
+    uint32_t        uint32TraceCnt;         /**< Number of written trace records, next record at uint32TraceCnt % uint16TraceMax */
+    t_sfcb_stats*   ptrStats;               /**< Performance counters, NULL if not used, see #sfcb_init_stats */
+    uint32_t*       ptrWear;                /**< Erase cycles per flash sector, NULL if not used, see #sfcb_init_wear */
+    uint32_t        uint32WearNum;          /**< Number of sectors in erase cycle table */
+    uint8_t*        ptrRing;                /**< Record ring, NULL if not used, see #sfcb_init_ring */
+    uint32_t        uint32RingNum;          /**< Number of slots in record ring, power of two */
+    uint32_t        uint32RingStride;       /**< Slot size in bytes, #SFCB_RING_SLOT */
+    uint16_t        uint16RingRec;          /**< Maximum record size in bytes */
+    uint8_t         uint8RingAct;           /**< Record of tail slot is processed */
+    uint32_t        uint32RingHead;         /**< Next reserved position, written by producers */
+    uint32_t        uint32RingTail;         /**< Next consumed position, written by #sfcb_worker */
+    uint32_t        uint32RingDrop;         /**< Number of rejected records */
 } t_sfcb;
 
 
@@ -215,189 +748,904 @@ int sfcb_init (t_sfcb *self, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen
 
 
 /**
- *  @brief worker
+ *  @brief init flash
  *
- *  Services Circular buffer layer, request/processes SPI packets.
- *  Executes request from #sfcb_mkcb,
+ *  assigns the flash descriptor, replaces the compile-time selected flash.
+ *  Needs to be called after #sfcb_init and before #sfcb_new_cb. Every handle
+ *  can drive an own flash, f. e. one handle per chip select. Different flash
+ *  types require the build with SFCB_FLASH_RT_EN, otherwise only a descriptor
+ *  equal to the compile-time selected flash is accepted.
  *
  *  @param[in,out]  self                handle, #t_sfcb
- *  @return         void                state
- *  @since          2022-07-27
- *  @author         Andreas Kaeberlein
+ *  @param[in]      *flash              flash descriptor, needs to be valid for handle lifetime, see #t_sfcb_flash
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_NO_FLASH    invalid descriptor, or differs from compile-time flash
+ *  @retval         #SFCB_E_MEM         spi buffer to small for flash page
+ *  @retval         #SFCB_E_WKR_REQ     queues already created
+ *  @since          2026-10-14
  */
-void sfcb_worker (t_sfcb *self);
+int sfcb_init_flash (t_sfcb *self, const t_sfcb_flash *flash);
 
 
 
 /**
- *  @brief flash size
+ *  @brief flash descriptor
  *
- *  Total Flash Size in bytes
+ *  descriptor of the flash driven by the handle, the compile-time selected
+ *  flash or the descriptor of #sfcb_init_flash
  *
- *  @return         uint32_t            flash size in byte
- *  @since          2023-01-04
- *  @author         Andreas Kaeberlein
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         const t_sfcb_flash* flash descriptor, #t_sfcb_flash
+ *  @since          2026-10-14
  */
-uint32_t sfcb_flash_size (void);
+const t_sfcb_flash* sfcb_flash_desc (t_sfcb *self);
 
 
 
 /**
- *  @brief new_cb
+ *  @brief init copy
  *
- *  creates new circular buffer entry in flash parition table
+ *  copies the mounted queues of an idle handle for reads, f. e. parallel
+ *  export of the queues of one flash image. The copy gets an own queue list,
+ *  SPI buffer and codec buffer. Job queue, record ring, read sink, ping-pong
+ *  buffer, checkpoint, erase counts, trace and counters are not taken over,
+ *  staged bytes stay in the source. Appends to one handle are not seen by the other.
  *
- *  @param[in,out]  self                handle, #t_sfcb
- *  @param[in]      magicNum            Magic Number for marking enties valid, should differ between different Circular buffer entries
- *  @param[in]      elemSizeByte        Size of one element in the circular buffer in byte
- *  @param[in]      numElems            minimal number of elements in the circular buffer, through need of sector erase and not deleting all data can be this number higher then requested
- *  @param[in,out]  *cbID               Circular buffer number
+ *  @param[out]     self                copy, #t_sfcb
+ *  @param[in]      *src                mounted and idle handle, see #sfcb_mkcb
+ *  @param[in,out]  *cb                 queue list of the copy, valid for handle lifetime
+ *  @param[in]      cbLen               number of queues in *cb, at least the number of the source
+ *  @param[in,out]  *spi                SPI buffer of the copy, valid for handle lifetime
+ *  @param[in]      spiLen              size of *spi in bytes, at least the size of the source
+ *  @param[in,out]  *codec              codec buffer used by all record codec queues of the copy, NULL without codec
+ *  @param[in]      codecLen            size of *codec in bytes, at least the largest codec buffer of the source
  *  @return         int                 state
- *  @retval         0                   OKAY
- *  @retval         1                   No free circular buffer slots, allocate more static memory
- *  @since          2022-07-25
- *  @author         Andreas Kaeberlein
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Source worker is busy or jobs are queued
+ *  @retval         #SFCB_E_MEM         queue list, SPI or codec buffer to small
+ *  @since          2026-10-14
  */
-int sfcb_new_cb (t_sfcb *self, uint32_t magicNum, uint16_t elemSizeByte, uint16_t numElems, uint8_t *cbID);
+int sfcb_init_copy (t_sfcb *self, const t_sfcb *src, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen, void *codec, uint16_t codecLen);
 
 
 
 /**
- *  @brief busy
+ *  @brief transfer mode
  *
- *  checks if #sfcb_worker is free for new requests
+ *  selects read and page program instructions of the flash. Fast, dual and
+ *  quad modes reduce the read time, the lane usage of every packet is
+ *  provided by #sfcb_spi_xfer. Quad modes require an enabled QE bit in the flash.
  *
  *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      rd                  read mode, #t_sfcb_rdmode
+ *  @param[in]      quadProg            non zero selects Quad Page Program
  *  @return         int                 state
- *  @retval         0                   idle
- *  @retval         1                   busy
- *  @since          2022-07-29
- *  @author         Andreas Kaeberlein
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_NO_FLASH    mode not supported by flash
+ *  @retval         #SFCB_E_MEM         spi buffer to small
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @since          2026-10-14
  */
-int sfcb_busy (t_sfcb *self);
+int sfcb_xfer_cfg (t_sfcb *self, t_sfcb_rdmode rd, uint8_t quadProg);
 
 
 
 /**
- *  @brief Spi Length
+ *  @brief init job queue
  *
- *  gets length of next spi packet, created by #sfcb_worker
+ *  assigns memory for the job queue. Requests while the worker is
+ *  busy are queued instead of rejected with #SFCB_E_WKR_BSY and processed
+ *  by #sfcb_worker in order. All data buffers passed to the requests needs to be
+ *  valid until the job is done. The request arguments are checked when the job starts,
+ *  rejected jobs are reported via the done callback with the return code.
  *
  *  @param[in,out]  self                handle, #t_sfcb
- *  @return         uint16_t            current length of SPI packet, created by #sfcb_worker
- *  @since          2022-08-19
- *  @author         Andreas Kaeberlein
+ *  @param[in,out]  *jobs               pointer to allocated memory for job queue, see #t_sfcb_job
+ *  @param[in]      jobsLen             number of maximum queued jobs
+ *  @param[in]      done                called after every finished job, NULL disables
+ *  @param[in,out]  *arg                user argument of done callback
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @since          2026-10-14
  */
-uint16_t sfcb_spi_len (t_sfcb *self);
+int sfcb_init_jobq (t_sfcb *self, void *jobs, uint8_t jobsLen, t_sfcb_done done, void *arg);
 
 
 
 /**
- *  @brief build-up
+ *  @brief init record ring
  *
- *  Reads from Flash and builds-up queues with circular buffer structure
+ *  assigns memory for the lock-free record ring. Interrupts and tasks append records
+ *  with #sfcb_ring_add without lock, #sfcb_worker stores them in order with
+ *  #sfcb_add or #sfcb_add_rec for packed queues, if no other job is pending.
+ *  Records are not split, the open element is closed if the record does not fit.
+ *  Staging buffer, packed queue or record codec collect several records per
+ *  flash write. Stored records are reported like queued jobs via the done
+ *  callback, see #sfcb_init_jobq, rejected records are counted in uint32RingDrop.
+ *  The number of slots is the largest power of two fitting into *ring.
+ *  Records are only stored in builds of the library with SFCB_RING_EN,
+ *  otherwise a ring is rejected with #SFCB_E_MEM.
  *
  *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in,out]  *ring               4 byte aligned memory for record ring, NULL disables
+ *  @param[in]      ringLen             size of *ring in bytes, at least 2 * #SFCB_RING_SLOT
+ *  @param[in]      recMax              maximum record size in bytes
  *  @return         int                 state
- *  @retval         0                   Request accepted
- *  @retval         1                   Not Free for new Requests, wait
- *  @retval         2                   no active queue, add via #spi_flash_cb_add
- *  @since          2022-07-27
- *  @author         Andreas Kaeberlein
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_MEM         Ring unaligned, smaller than two slots or ring disabled
+ *  @since          2026-10-14
  */
-int sfcb_mkcb (t_sfcb *self);
+int sfcb_init_ring (t_sfcb *self, void *ring, uint32_t ringLen, uint16_t recMax);
 
 
 
 /**
- *  @brief add element append
+ *  @brief ring add
  *
- *  adds element to circular buffer structure with multiple writes into same circular buffer queue element
- *    1) append(1) -> write one byte to payload segment OFS=0
- *    2) append(1) -> write one byte to payload segment OFS=1
- *    and so on...
- *  in case of prematurely finish circular buffer element run #sfcb_add_done
+ *  appends record to the record ring, see #sfcb_init_ring. Safe from interrupt
+ *  and concurrent tasks, the slot is reserved with one atomic compare and swap.
+ *  The record is copied, *data can be reused after return.
  *
  *  @param[in,out]  self                handle, #t_sfcb
- *  @param[in]      cbID                Logical Number of Cicular Buffer queue
- *  @param[in]      *data               Pointer to data array which should add
- *  @param[in]      len                 size of *data in bytes
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      *data               record
+ *  @param[in]      len                 number of bytes in data, up to recMax
  *  @return         int                 state
- *  @retval         #SFCB_OK            Request accepted.
- *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job.
- *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not active or present.
- *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for request, run #sfcb_worker.
- *  @retval         #SFCB_E_MEM         Not enough memory to perform the desired interaction.
- *  @since          2023-09-13
- *  @author         Andreas Kaeberlein
+ *  @retval         #SFCB_OK            record queued
+ *  @retval         #SFCB_E_WKR_BSY     Ring full, run #sfcb_worker
+ *  @retval         #SFCB_E_MEM         No ring or record larger than recMax
+ *  @since          2026-10-14
  */
-int sfcb_add (t_sfcb *self, uint8_t cbID, void *data, uint16_t len);
+int sfcb_ring_add (t_sfcb *self, uint8_t cbID, const void *data, uint16_t len);
 
 
 
 /**
- *  @brief add append done
+ *  @brief init read sink
  *
- *  force footer write into flash if at least one payload byte is written
- *  and the nominal payload size isn't reached
+ *  assigns a read sink. #sfcb_get_last and #sfcb_flash_read requested with
+ *  NULL as data buffer hand every read chunk as slice of the SPI exchange buffer
+ *  to the sink instead of copying into a data buffer.
  *
  *  @param[in,out]  self                handle, #t_sfcb
- *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @param[in]      sink                read sink, NULL disables
+ *  @param[in,out]  *arg                user argument of read sink
  *  @return         int                 state
- *  @retval         #SFCB_OK            Request accepted.
- *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job.
- *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not active or present.
- *  @retval         #SFCB_E_CB_Q_MTY    Cirular buffer queue has no valid entries.    
- *  @since          2023-12-26
- *  @author         Andreas Kaeberlein
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @since          2026-10-14
  */
-int sfcb_add_done (t_sfcb *self, uint8_t cbID);
+int sfcb_init_sink (t_sfcb *self, t_sfcb_sink sink, void *arg);
 
 
 
 /**
- *  @brief written bytes
+ *  @brief init ping-pong
  *
- *  number of written bytes to flash in case of usage of #sfcb_add_append
- *  these bytes are fixed up to an erase
+ *  assigns second SPI exchange buffer. #sfcb_worker creates packets alternating
+ *  in both buffers, #sfcb_spi_buf and #sfcb_spi_len select the next transfer.
+ *  Every transfer is completed with #sfcb_spi_done. While the response of a
+ *  GET/RAW read or a linear #sfcb_mkcb header burst is in transfer, the next
+ *  read is created in the other buffer and can be queued behind, f. e. DMA.
  *
  *  @param[in,out]  self                handle, #t_sfcb
- *  @param[in]      cbID                Logical Number of Cicular Buffer queue
- *  @return         uint16_t            number of bytes written to flash from start of payload
- *  @since          2023-10-03
- *  @author         Andreas Kaeberlein
+ *  @param[in,out]  *spi                second SPI buffer, NULL disables
+ *  @param[in]      spiLen              size of *spi in bytes, at least size of #sfcb_init buffer
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_MEM         Buffer smaller than #sfcb_init buffer
+ *  @since          2026-10-14
  */
-uint16_t sfcb_get_pl_wrcnt (t_sfcb *self, uint8_t cbID);
+int sfcb_init_pingpong (t_sfcb *self, void *spi, uint16_t spiLen);
 
 
 
 /**
- *  @brief RAW Read
+ *  @brief init trace
  *
- *  read raw data from flash
+ *  assigns trace ring. Every #sfcb_worker call which creates a SPI packet or
+ *  changes command or stage appends a #t_sfcb_trace record, the oldest record
+ *  is overwritten. Records are only written in builds with SFCB_TRACE_EN.
  *
  *  @param[in,out]  self                handle, #t_sfcb
- *  @param[in]      adr                 start address for read
- *  @param[in,out]  *data               pointer to data array with read data
- *  @param[in]      len                 size of *data in bytes
+ *  @param[in,out]  *ring               trace ring, NULL disables
+ *  @param[in]      ringLen             number of #t_sfcb_trace records in *ring
  *  @return         int                 state
- *  @retval         0                   Request accepted.
- *  @retval         1                   Worker is busy, wait for processing last job.
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_MEM         Ring without record
+ *  @since          2026-10-14
+ */
+int sfcb_init_trace (t_sfcb *self, void *ring, uint16_t ringLen);
+
+
+
+/**
+ *  @brief trace count
+ *
+ *  number of trace records written since #sfcb_init_trace, the newest
+ *  record is at index (count - 1) % ringLen
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         uint32_t            number of written records
+ *  @since          2026-10-14
+ */
+uint32_t sfcb_trace_cnt (t_sfcb *self);
+
+
+
+/**
+ *  @brief init stats
+ *
+ *  assigns and clears performance counters. Counters are only updated
+ *  in builds with SFCB_STATS_EN, otherwise the sidecar stays zero.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in,out]  *stats              performance counters, NULL disables
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @since          2026-10-14
+ */
+int sfcb_init_stats (t_sfcb *self, t_sfcb_stats *stats);
+
+
+
+/**
+ *  @brief get stats
+ *
+ *  copies snapshot of performance counters, f. e. for telemetry export
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @param[out]     *stats              snapshot of counters
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_MEM         No counters assigned, see #sfcb_init_stats
+ *  @since          2026-10-14
+ */
+int sfcb_stats_get (t_sfcb *self, t_sfcb_stats *stats);
+
+
+
+/**
+ *  @brief reset stats
+ *
+ *  clears performance counters, the measurement of a running job continues
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void
+ *  @since          2026-10-14
+ */
+void sfcb_stats_reset (t_sfcb *self);
+
+
+
+/**
+ *  @brief read chunk size
+ *
+ *  sets the maximum number of data bytes per read transfer of
+ *  #sfcb_get_last and #sfcb_flash_read. Larger reads are split.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      chunkLen            data bytes per transfer, zero selects the SPI buffer size
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_MEM         Chunk does not fit into SPI buffer
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @since          2026-10-14
+ */
+int sfcb_read_chunk (t_sfcb *self, uint16_t chunkLen);
+
+
+
+/**
+ *  @brief worker
+ *
+ *  Services Circular buffer layer, request/processes SPI packets.
+ *  Executes request from #sfcb_mkcb,
+ *  in ping-pong mode, see #sfcb_init_pingpong, the next packet is created
+ *  if the response of the last one is completed by #sfcb_spi_done
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         void                state
+ *  @since          2022-07-27
+ *  @author         Andreas Kaeberlein
+ */
+void sfcb_worker (t_sfcb *self);
+
+
+
+/**
+ *  @brief flash size
+ *
+ *  Total Flash Size in bytes of the flash driven by the handle,
+ *  the compile-time selected flash or the descriptor of #sfcb_init_flash
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         uint32_t            flash size in byte
+ *  @since          2023-01-04
+ *  @author         Andreas Kaeberlein
+ */
+uint32_t sfcb_flash_size (t_sfcb *self);
+
+
+
+/**
+ *  @brief new_cb
+ *
+ *  creates new circular buffer entry in flash parition table. Elements are
+ *  padded to divide a sector or to span complete sectors, queues with
+ *  elements of an erase block size start block aligned.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      magicNum            Magic Number for marking enties valid, should differ between different Circular buffer entries
+ *  @param[in]      elemSizeByte        Size of one element in the circular buffer in byte
+ *  @param[in]      numElems            minimal number of elements in the circular buffer, through need of sector erase and not deleting all data can be this number higher then requested
+ *  @param[in,out]  *cbID               Circular buffer number
+ *  @return         int                 state
+ *  @retval         0                   OKAY
+ *  @retval         1                   No free circular buffer slots, allocate more static memory
+ *  @since          2022-07-25
+ *  @author         Andreas Kaeberlein
+ */
+int sfcb_new_cb (t_sfcb *self, uint32_t magicNum, uint16_t elemSizeByte, uint32_t numElems, uint8_t *cbID);
+
+
+
+/**
+ *  @brief new packed queue
+ *
+ *  creates circular buffer queue for small fixed-size records. One page is one
+ *  element, the element header holds magic and id base for all records in the page.
+ *  Every record is stored with a #SFCB_REC_HEAD_SIZE byte record header, the
+ *  footer closes the element after the last record slot is written. Record ids
+ *  are counted from the element ids, (idNum - 1) * records per element + slot + 1.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      magicNum            Magic Number for marking enties valid
+ *  @param[in]      recSize             record size in bytes
+ *  @param[in]      numRecs             minimal number of records in the queue
+ *  @param[in,out]  *cbID               Circular buffer number
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_MEM         Less than two records per page, or no free circular buffer slot
+ *  @retval         #SFCB_E_FLASH_FULL  Flash capacity exceeded
+ *  @since          2026-10-14
+ */
+int sfcb_new_pack (t_sfcb *self, uint32_t magicNum, uint16_t recSize, uint32_t numRecs, uint8_t *cbID);
+
+
+
+/**
+ *  @brief new checkpoint
+ *
+ *  creates checkpoint queue. A checkpoint is a snapshot of the management data of all
+ *  circular buffer queues. #sfcb_mkcb restores the queues from the newest checkpoint and
+ *  verifies only the elements written after it, instead of scanning the element headers.
+ *  The checkpoint queue is created like a circular buffer queue with #sfcb_new_cb,
+ *  append with every #sfcb_new_cb call the same order.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      magicNum            Magic Number for marking checkpoint entries valid
+ *  @param[in]      numElems            minimal number of checkpoints in the queue
+ *  @param[in,out]  *buf                checkpoint buffer, at least cbLen * sizeof(#t_sfcb_ckpt_elem) + 4 bytes, with #sfcb_init_wear 4 + 2 * num bytes more
+ *  @param[in]      bufLen              size of *buf in bytes
+ *  @param[in,out]  *cbID               Circular buffer number of checkpoint queue
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_MEM         checkpoint buffer to small, or no free circular buffer slot
+ *  @retval         #SFCB_E_FLASH_FULL  Flash capacity exceeded
+ *  @since          2026-10-14
+ */
+int sfcb_new_ckpt (t_sfcb *self, uint32_t magicNum, uint16_t numElems, void *buf, uint16_t bufLen, uint8_t *cbID);
+
+
+
+/**
+ *  @brief checkpoint
+ *
+ *  appends snapshot of the management data of all valid circular buffer queues to the checkpoint queue.
+ *  Queues with invalid management data or a pending #sfcb_add are not part of the snapshot.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_NO_CB_Q     No checkpoint queue, see #sfcb_new_ckpt
+ *  @retval         #SFCB_E_WKR_REQ     Checkpoint queue is not prepared for request, run #sfcb_mkcb
+ *  @since          2026-10-14
+ */
+int sfcb_ckpt (t_sfcb *self);
+
+
+
+/**
+ *  @brief erase cycle table
+ *
+ *  registers table with the number of erase cycles of every flash sector. Each sector or
+ *  block erase increments the counters of the erased sectors, the checkpoint stores the
+ *  table with a 32bit base and a 16bit offset per sector, #sfcb_mkcb restores it. Erases
+ *  after the newest checkpoint are not counted after power loss. The table is not cleared,
+ *  the application initialises it. Register before #sfcb_new_ckpt, the table is part
+ *  of the checkpoint size.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in,out]  *wear               erase cycles, one counter per sector, NULL disables
+ *  @param[in]      num                 number of sectors in *wear, sectors behind are not counted
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_MEM         empty table
+ *  @retval         #SFCB_E_WKR_REQ     checkpoint queue already created
+ *  @since          2026-10-14
+ */
+int sfcb_init_wear (t_sfcb *self, uint32_t *wear, uint32_t num);
+
+
+
+/**
+ *  @brief place queue
+ *
+ *  resizes or relocates circular buffer queue online. The elements of the queue are
+ *  dropped, the next #sfcb_mkcb erases the new flash range and rebuilds the queue.
+ *  With #SFCB_PLACE_AUTO the free flash range with the least erase cycles is selected,
+ *  without erase cycle table the first free range. A following #sfcb_ckpt stores
+ *  the placement, #sfcb_mkcb restores it over the #sfcb_new_cb placement.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      startSector         first sector of queue, aligned like #sfcb_new_cb, or #SFCB_PLACE_AUTO
+ *  @param[in]      numElems            minimal number of elements, zero keeps number of element slots
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present, or checkpoint queue
+ *  @retval         #SFCB_E_WKR_REQ     Element partly written, run #sfcb_add_done
+ *  @retval         #SFCB_E_FLASH_FULL  Flash capacity exceeded or range used by other queue
+ *  @since          2026-10-14
+ */
+int sfcb_place_cb (t_sfcb *self, uint8_t cbID, uint32_t startSector, uint32_t numElems);
+
+
+
+/**
+ *  @brief pre-erase
+ *
+ *  sets free element watermark of circular buffer queue. If the number of free elements
+ *  drops below the watermark, #sfcb_worker erases in idle the sector with the oldest
+ *  element. The sectors with the newest element and next write element are not erased.
+ *  The next #sfcb_add finds an erased element and avoids the sector erase time.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      numFree             minimal number of free elements, zero disables
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present
+ *  @since          2026-10-14
+ */
+int sfcb_pre_erase (t_sfcb *self, uint8_t cbID, uint16_t numFree);
+
+
+
+/**
+ *  @brief staging buffer
+ *
+ *  assigns write-combining buffer to circular buffer queue. #sfcb_add copies the
+ *  appended bytes into the buffer and programs them first if the end of a flash page
+ *  or the end of the payload is reached. An append exceeding the buffer is programmed
+ *  behind the staged bytes in the same job. #sfcb_add_done programs the staged bytes
+ *  together with the footer. With tick source, see #sfcb_wip_cfg, #sfcb_worker programs
+ *  in idle staged bytes older than timeoutUs. Staged bytes are lost with #sfcb_mkcb.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in,out]  *buf                staging buffer, valid for handle lifetime, NULL disables
+ *  @param[in]      bufLen              size of *buf in bytes, at least one page
+ *  @param[in]      timeoutUs           program staged bytes after timeout, zero disables
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present
+ *  @retval         #SFCB_E_WKR_REQ     Staged bytes pending, run #sfcb_add_done
+ *  @retval         #SFCB_E_MEM         Buffer smaller than page, or record codec
+ *  @since          2026-10-14
+ */
+int sfcb_stage_cfg (t_sfcb *self, uint8_t cbID, void *buf, uint16_t bufLen, uint32_t timeoutUs);
+
+
+
+/**
+ *  @brief payload CRC
+ *
+ *  enables CRC32 of the element payload. The CRC is calculated while the payload
+ *  pages are programmed and stored in the footer instead of the magic number,
+ *  erased bytes of a payload closed by #sfcb_add_done are part of the CRC.
+ *  #sfcb_get_last with at least the payload size and #sfcb_iter verify the CRC
+ *  while reading, a mismatch finishes the job with #SFCB_E_CRC, see #sfcb_isero.
+ *  All elements of the queue have to be written with the same setting.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      en                  non zero enables CRC
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present or packed queue
+ *  @retval         #SFCB_E_WKR_REQ     Element partly written, run #sfcb_add_done
+ *  @since          2026-10-14
+ */
+int sfcb_crc_cfg (t_sfcb *self, uint8_t cbID, uint8_t en);
+
+
+
+/**
+ *  @brief record codec
+ *
+ *  stores fixed size records encoded, several records share one element. Every
+ *  record is encoded against the previous written record of the element, the first record
+ *  of an element against zeros, an element decodes without its predecessors.
+ *  #sfcb_add appends one record to the open element, the element is closed if the
+ *  remaining payload can not take a worst case encoded record. Records of the open
+ *  element are readable after #sfcb_add_done. #sfcb_get_last returns the last record
+ *  of the newest element, #sfcb_iter calls the iterator per decoded record.
+ *  The built-in codec stores the changed bytes with varint coded run lengths.
+ *  Not supported together with staging buffer, see #sfcb_stage_cfg.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                circular buffer queue number
+ *  @param[in]      recSize             record size in bytes, zero disables
+ *  @param[in,out]  *buf                codec buffer, valid for handle lifetime, see #SFCB_CODEC_BUF
+ *  @param[in]      bufLen              size of *buf in bytes
+ *  @param[in]      *codec              record codec, NULL selects built-in codec
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present or packed queue
+ *  @retval         #SFCB_E_WKR_REQ     Element partly written, run #sfcb_add_done
+ *  @retval         #SFCB_E_MEM         Buffer too small, payload smaller than encoded record or staging buffer assigned
+ *  @since          2026-10-14
+ */
+int sfcb_codec_cfg (t_sfcb *self, uint8_t cbID, uint16_t recSize, void *buf, uint16_t bufLen, const t_sfcb_codec *codec);
+
+
+
+/**
+ *  @brief external CRC32
+ *
+ *  CRC-32 (IEEE 802.3, reflected, polynom 0xEDB88320) provided by the application,
+ *  f. e. with the CRC unit of the controller. Only used in builds with SFCB_CRC_EXT.
+ *  Start is crc=0, the last result is used for continuation.
+ *
+ *  @param[in]      crc                 CRC of previous data segment, zero for start
+ *  @param[in]      *data               pointer to data segment
+ *  @param[in]      len                 number of bytes in *data
+ *  @return         uint32_t            CRC of data segment
+ *  @since          2026-10-14
+ */
+uint32_t sfcb_crc32_ext (uint32_t crc, const void *data, uint32_t len);
+
+
+
+/**
+ *  @brief WIP poll configuration
+ *
+ *  configures the status register polling while a page program or sector erase
+ *  is in progress. With a tick source, #sfcb_worker requests no SPI transfer
+ *  (#sfcb_spi_len is zero) until the typical completion time of the pending
+ *  operation is reached. Flashes with continuous status register output
+ *  read several status bytes in a single transfer, the last byte is evaluated.
+ *  If the flash is still busy after the expected completion, the next poll is
+ *  requested after the poll interval.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      stsLen              number of status register bytes per poll, one if continuous read is not supported
+ *  @param[in]      tick                tick source, NULL polls on every worker call
+ *  @param[in]      tickUs              tick period in us
+ *  @param[in]      pollUs              poll interval in us after expected completion, zero polls on every worker call
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            OKAY
+ *  @retval         #SFCB_E_MEM         Invalid status length or tick period
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @since          2026-10-14
+ */
+int sfcb_wip_cfg (t_sfcb *self, uint16_t stsLen, t_sfcb_tick tick, uint32_t tickUs, uint32_t pollUs);
+
+
+
+/**
+ *  @brief WIP hint
+ *
+ *  expected remaining time of the pending page program or sector erase. Allows
+ *  the scheduler to sleep instead of calling #sfcb_worker. Without tick source
+ *  the typical duration of the pending operation is returned.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[out]     tick                tick of expected completion, only written with tick source, NULL allowed
+ *  @return         uint32_t            remaining time in us, zero if no operation is pending or expected to be done
+ *  @since          2026-10-14
+ */
+uint32_t sfcb_wip_hint (t_sfcb *self, uint32_t *tick);
+
+
+
+/**
+ *  @brief busy
+ *
+ *  checks if #sfcb_worker is free for new requests, busy also
+ *  if records in the record ring are waiting, see #sfcb_init_ring (SFCB_RING_EN)
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   idle
+ *  @retval         1                   busy
+ *  @since          2022-07-29
+ *  @author         Andreas Kaeberlein
+ */
+int sfcb_busy (t_sfcb *self);
+
+
+
+/**
+ *  @brief Spi Length
+ *
+ *  gets length of next spi packet, created by #sfcb_worker.
+ *  In ping-pong mode zero if #sfcb_worker has no new packet created.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         uint16_t            current length of SPI packet, created by #sfcb_worker
+ *  @since          2022-08-19
+ *  @author         Andreas Kaeberlein
+ */
+uint16_t sfcb_spi_len (t_sfcb *self);
+
+
+
+/**
+ *  @brief spi transfer mode
+ *
+ *  lane usage and dummy cycles of next spi packet
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         const t_sfcb_xfer*  transfer mode, #t_sfcb_xfer
+ *  @since          2026-10-14
+ */
+const t_sfcb_xfer* sfcb_spi_xfer (t_sfcb *self);
+
+
+
+/**
+ *  @brief spi buffer
+ *
+ *  buffer of next spi packet, in ping-pong mode alternating, see #sfcb_init_pingpong
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         uint8_t*            SPI buffer with #sfcb_spi_len bytes to transfer
+ *  @since          2026-10-14
+ */
+uint8_t* sfcb_spi_buf (t_sfcb *self);
+
+
+
+/**
+ *  @brief spi transfer done
+ *
+ *  marks transfer of a packet from #sfcb_next_packet or of a ping-pong buffer
+ *  complete, the response is evaluated by the next #sfcb_worker call.
+ *  Can be called from ISR.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      *spi                transferred buffer, #sfcb_spi_buf
+ *  @return         void
+ *  @since          2026-10-14
+ */
+void sfcb_spi_done (t_sfcb *self, const void *spi);
+
+
+
+/**
+ *  @brief next spi packet
+ *
+ *  event driven alternative to periodic #sfcb_worker calls. Runs the worker
+ *  until the next SPI packet is created. The packet is in transfer until
+ *  #sfcb_spi_done is called. Without pending work the caller can block, f. e.
+ *  on a semaphore given by #sfcb_spi_done and by new requests. While waiting
+ *  for WIP completion #sfcb_wip_hint gives the remaining time.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[out]     **spi               buffer of next SPI packet
+ *  @param[out]     *len                length of next SPI packet, zero if none
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            SPI packet created, transfer and call #sfcb_spi_done
+ *  @retval         #SFCB_E_WKR_IDLE    No work pending, call after next request
+ *  @retval         #SFCB_E_WKR_WAIT    Transfer in progress, WIP completion or staging timeout pending
+ *  @since          2026-10-14
+ */
+int sfcb_next_packet (t_sfcb *self, uint8_t **spi, uint16_t *len);
+
+
+
+/**
+ *  @brief build-up
+ *
+ *  Reads from Flash and builds-up queues with circular buffer structure
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   Request accepted
+ *  @retval         1                   Not Free for new Requests, wait
+ *  @retval         2                   no active queue, add via #spi_flash_cb_add
+ *  @since          2022-07-27
+ *  @author         Andreas Kaeberlein
+ */
+int sfcb_mkcb (t_sfcb *self);
+
+
+
+/**
+ *  @brief add element append
+ *
+ *  adds element to circular buffer structure with multiple writes into same circular buffer queue element
+ *    1) append(1) -> write one byte to payload segment OFS=0
+ *    2) append(1) -> write one byte to payload segment OFS=1
+ *    and so on...
+ *  in case of prematurely finish circular buffer element run #sfcb_add_done
+ *  after the footer is written the management data is updated in RAM, no
+ *  #sfcb_mkcb is required for the next element.
+ *  With staging buffer, see #sfcb_stage_cfg, *data is copied and programmed
+ *  at page end; if it doesn't fit, the staged bytes are programmed first and the
+ *  append is queued, without job queue #SFCB_E_WKR_BSY is returned.
+ *  With record codec, see #sfcb_codec_cfg, *data is one record, it is encoded
+ *  and appended to the open element.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @param[in]      *data               Pointer to data array which should add
+ *  @param[in]      len                 size of *data in bytes
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted.
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job.
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not active or present.
+ *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for request, run #sfcb_worker.
+ *  @retval         #SFCB_E_MEM         Not enough memory to perform the desired interaction, or packed queue, see #sfcb_add_rec, or len unequal codec record size.
+ *  @since          2023-09-13
+ *  @author         Andreas Kaeberlein
+ */
+int sfcb_add (t_sfcb *self, uint8_t cbID, void *data, uint16_t len);
+
+
+
+/**
+ *  @brief add append done
+ *
+ *  force footer write into flash if at least one payload byte is written
+ *  and the nominal payload size isn't reached, without open element nothing to do.
+ *  Staged bytes, see #sfcb_stage_cfg, are programmed together with the footer.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted, or footer already written.
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job.
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not active or present.
+ *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for request, run #sfcb_mkcb.
+ *  @since          2023-12-26
+ *  @author         Andreas Kaeberlein
+ */
+int sfcb_add_done (t_sfcb *self, uint8_t cbID);
+
+
+
+/**
+ *  @brief add batch
+ *
+ *  appends num records with len bytes each from data as consecutive elements
+ *  to the queue in one job. Every element is finished with footer, the management
+ *  data is updated in RAM without #sfcb_mkcb. If no free element is left,
+ *  the sector with the oldest elements is erased ahead.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @param[in]      data                records, num * len bytes
+ *  @param[in]      len                 bytes per record, limited by queue payload size
+ *  @param[in]      num                 number of records
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not active or present
+ *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for request, run #sfcb_worker
+ *  @retval         #SFCB_E_MEM         Record larger than payload, no record, packed queue or record codec
+ *  @since          2026-10-14
+ */
+int sfcb_add_batch (t_sfcb *self, uint8_t cbID, void *data, uint16_t len, uint16_t num);
+
+
+
+/**
+ *  @brief add record
+ *
+ *  appends one record with record header to the open element of a packed queue,
+ *  see #sfcb_new_pack. Header, record and footer of the same page are written
+ *  with one page program. The footer is written with the last record slot, the
+ *  element becomes visible for #sfcb_iter. #sfcb_add_done closes an element
+ *  prematurely, f.e. before power down.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @param[in]      data                record, #t_sfcb_cb::uint16RecSize bytes
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not active or present
+ *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for request, run #sfcb_worker
+ *  @retval         #SFCB_E_MEM         No packed queue
+ *  @since          2026-10-14
+ */
+int sfcb_add_rec (t_sfcb *self, uint8_t cbID, void *data);
+
+
+
+/**
+ *  @brief written bytes
+ *
+ *  number of written bytes to flash in case of usage of #sfcb_add_append
+ *  these bytes are fixed up to an erase
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @return         uint16_t            number of bytes written to flash from start of payload
+ *  @since          2023-10-03
+ *  @author         Andreas Kaeberlein
+ */
+uint16_t sfcb_get_pl_wrcnt (t_sfcb *self, uint8_t cbID);
+
+
+
+/**
+ *  @brief staged bytes
+ *
+ *  number of appended payload bytes in the staging buffer, not yet
+ *  programmed to flash, see #sfcb_stage_cfg
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @return         uint16_t            number of staged bytes behind #sfcb_get_pl_wrcnt
+ *  @since          2026-10-14
+ */
+uint16_t sfcb_get_pl_stcnt (t_sfcb *self, uint8_t cbID);
+
+
+
+/**
+ *  @brief RAW Read
+ *
+ *  read raw data from flash, reads larger than the SPI buffer
+ *  are split into chunks, see #sfcb_read_chunk
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      adr                 start address for read
+ *  @param[in,out]  *data               pointer to data array with read data, NULL hands data to read sink, see #sfcb_init_sink
+ *  @param[in]      len                 size of *data in bytes
+ *  @return         int                 state
+ *  @retval         0                   Request accepted.
+ *  @retval         1                   Worker is busy, wait for processing last job.
+ *  @retval         #SFCB_E_MEM         No data buffer and no read sink
  *  @since          2023-01-05
  *  @author         Andreas Kaeberlein
  */
-int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint16_t len);
+int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint32_t len);
 
 
 
 /**
  *  @brief Get Last
  *
- *  get last written element from circular buffer queue
+ *  get last written element from circular buffer queue. With record codec the
+ *  complete element is read and the last decoded record is returned, see #sfcb_codec_cfg
  *
  *  @param[in,out]  self                handle, #t_sfcb
  *  @param[in]      cbID                Logical Number of Cicular Buffer queue
- *  @param[in,out]  *data               pointer to data array with read data
+ *  @param[in,out]  *data               pointer to data array with read data, NULL hands data to read sink, see #sfcb_init_sink
  *  @param[in]      len                 size of *data in bytes, limited the queue element size
  *  @return         int                 state
  *  @retval         #SFCB_OK            Request accepted
@@ -405,6 +1653,7 @@ int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint16_t len);
  *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present
  *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for reading element, run #sfcb_worker
  *  @retval         #SFCB_E_CB_Q_MTY    Cirular buffer queue has no valid entries
+ *  @retval         #SFCB_E_MEM         No data buffer and no read sink
  *  @since          2023-08-15
  *  @author         Andreas Kaeberlein
  */
@@ -427,6 +1676,48 @@ uint32_t sfcb_idmax (t_sfcb *self, uint8_t cbID);
 
 
 
+/**
+ *  @brief idmin
+ *
+ *  get minimum id in selected circular buffer queue
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @return         uint32_t            lowest id number of selected circular buffer queue
+ *  @since          2026-10-14
+ */
+uint32_t sfcb_idmin (t_sfcb *self, uint8_t cbID);
+
+
+
+/**
+ *  @brief Iterate
+ *
+ *  reads num elements starting with element idNum and hands the payload to
+ *  the iterator callback. The queue is read as continuous stream, the footer of
+ *  an element and the header of the next element are fetched with the same transfer.
+ *  The erased gap between payload and footer is skipped. An element with invalid
+ *  header or footer magic/id ends the job with an error, see #sfcb_isero.
+ *
+ *  @param[in,out]  self                handle, #t_sfcb
+ *  @param[in]      cbID                Logical Number of Cicular Buffer queue
+ *  @param[in]      idNum               id of first element, f.e. #sfcb_idmin
+ *  @param[in]      num                 number of elements, limited to #sfcb_idmax
+ *  @param[in]      iter                element iterator callback, #t_sfcb_iter
+ *  @param[in,out]  *arg                user argument of iterator callback
+ *  @return         int                 state
+ *  @retval         #SFCB_OK            Request accepted
+ *  @retval         #SFCB_E_WKR_BSY     Worker is busy, wait for processing last job
+ *  @retval         #SFCB_E_NO_CB_Q     Circular buffer queue not present
+ *  @retval         #SFCB_E_WKR_REQ     Circular Buffer is not prepared for reading element, run #sfcb_worker
+ *  @retval         #SFCB_E_CB_Q_MTY    Element with idNum not in queue
+ *  @retval         #SFCB_E_MEM         No iterator callback
+ *  @since          2026-10-14
+ */
+int sfcb_iter (t_sfcb *self, uint8_t cbID, uint32_t idNum, uint32_t num, t_sfcb_iter iter, void *arg);
+
+
+
 /**
  *  @brief check error
  *
@@ -443,6 +1734,33 @@ int sfcb_isero (t_sfcb *self);
 
 
 
+/**
+ *  @brief error code
+ *
+ *  error of the last job, f. e. #SFCB_E_CRC of a corrupted payload
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         t_sfcb_error        error code, #SFCB_E_NOERO if the last job was successful
+ *  @since          2026-10-14
+ */
+t_sfcb_error sfcb_error (t_sfcb *self);
+
+
+
+/**
+ *  @brief iterator element
+ *
+ *  id of the element processed by the element iterator, after a failed
+ *  #sfcb_iter the id of the corrupted element. The export can go on with the next id.
+ *
+ *  @param[in]      self                handle, #t_sfcb
+ *  @return         uint32_t            element id
+ *  @since          2026-10-14
+ */
+uint32_t sfcb_iter_id (t_sfcb *self);
+
+
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -0,0 +1,524 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : BSDv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : sfcb_bench.c
+ @date          : 2026-10-14
+
+ @brief         : SPI flash driver benchmark
+                  drives the worker against the spi flash model with
+                  emulated SPI clock, page program and erase times.
+                  One CSV line per queue setup is written to stdout.
+
+***********************************************************************/
+
+
+
+/** Standard libs **/
+#include <stdio.h>          // f.e. printf
+#include <stdlib.h>         // strtoul, exit
+#include <stdint.h>         // defines fiexd data types, like int8_t...
+#include <string.h>         // string handling functions
+
+/** User Libs **/
+#include "spi_flash_model/spi_flash_model.h"    // spi flash model
+#include "spi_flash_cb.h"
+#include "sfcb_flash_types.h"                    // flash instructions and typical timings
+
+
+
+/** Globals **/
+const uint32_t  g_uint32CallOut = 100000000;    // abort worker loop
+uint8_t         g_uint8Spi[266];                // SPI packet buffer
+uint64_t        g_uint64Ns = 0;                 // emulated time in ns
+const uint32_t  g_uint32PollUs = 20;            // WIP poll interval after expected completion
+
+
+
+/**
+ *  @typedef t_bench_cfg
+ *
+ *  @brief  Emulated timing
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_bench_cfg {
+    uint32_t        uint32ClkHz;    /**< SPI clock */
+    uint32_t        uint32PpUs;     /**< tPP, page program */
+    uint32_t        uint32SeUs;     /**< tSE, sector erase */
+    uint32_t        uint32Be32Us;   /**< tBE1, 32KB block erase */
+    uint32_t        uint32Be64Us;   /**< tBE2, 64KB block erase */
+    uint32_t        uint32SusUs;    /**< tSUS, erase suspend */
+    t_sfcb_rdmode   rdMode;         /**< read mode, see #sfcb_xfer_cfg */
+} t_bench_cfg;
+
+
+
+/**
+ *  @typedef t_bench_bus
+ *
+ *  @brief  Emulated flash busy state and transfer counters
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_bench_bus {
+    uint64_t    uint64BusyNs;   /**< flash busy until */
+    uint64_t    uint64SusNs;    /**< remaining erase time of suspended erase */
+    uint32_t    uint32Pkt;      /**< SPI packets */
+    uint32_t    uint32Bytes;    /**< SPI bytes */
+    uint32_t    uint32Polls;    /**< status register reads */
+    uint32_t    uint32Erase;    /**< erase instructions */
+} t_bench_bus;
+
+
+
+/**
+ *  @brief bench_tick
+ *
+ *  tick source of the worker, emulated time in us
+ *
+ *  @return         uint32_t            current tick
+ *  @since          2026-10-14
+ */
+static uint32_t bench_tick (void)
+{
+    return (uint32_t) (g_uint64Ns / 1000);
+}
+
+
+
+/**
+ *  @brief bench_sfm
+ *
+ *  executes SPI packet with the flash model, which knows single lane
+ *  instructions only. Reads with dummy bytes are executed as normal read,
+ *  quad page program as page program and block erase as sector erases.
+ *  The model completes erases at once, therefore erase suspend and resume
+ *  are only emulated by the timing of #bench_xfer.
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int bench_sfm (t_sfm* flash, t_sfcb* sfcb)
+{
+    /** Variables **/
+    const uint16_t      uint16Len = sfcb_spi_len(sfcb);
+    uint8_t*            uint8PtrSpi = sfcb_spi_buf(sfcb);
+    const t_sfcb_xfer*  xfer = sfcb_spi_xfer(sfcb);
+    const uint32_t      uint32Hdr = 1 + SFCB_FLASH_TOPO_ADR_BYTE;   // instruction and address
+    uint8_t             uint8Pkt[sizeof(g_uint8Spi)];               // single lane packet
+    uint32_t            uint32Sec = 0;                              // erased sector
+    uint32_t            uint32End;                                  // end of erase
+
+    /* emulated by timing */
+    if ( (SFCB_FLASH_IST_ERASE_SUSPEND == uint8PtrSpi[0]) || (SFCB_FLASH_IST_ERASE_RESUME == uint8PtrSpi[0]) ) {
+        return 0;
+    }
+    /* erase, block erase split into sector erases, completed at once */
+    if ( (SFCB_FLASH_IST_ERASE_SECTOR == uint8PtrSpi[0]) || (SFCB_FLASH_IST_ERASE_BLK32 == uint8PtrSpi[0]) || (SFCB_FLASH_IST_ERASE_BLK64 == uint8PtrSpi[0]) ) {
+        for ( uint8_t i = 0; i < SFCB_FLASH_TOPO_ADR_BYTE; i++ ) {
+            uint32Sec = (uint32Sec << 8) | uint8PtrSpi[1+i];
+        }
+        uint32End = uint32Sec + SFCB_FLASH_TOPO_SECTOR_SIZE;
+        if ( SFCB_FLASH_IST_ERASE_BLK32 == uint8PtrSpi[0] ) {
+            uint32End = uint32Sec + SFCB_FLASH_TOPO_BLK32_SIZE;
+        } else if ( SFCB_FLASH_IST_ERASE_BLK64 == uint8PtrSpi[0] ) {
+            uint32End = uint32Sec + SFCB_FLASH_TOPO_BLK64_SIZE;
+        }
+        for ( uint32_t uint32Adr = uint32Sec; uint32Adr < uint32End; uint32Adr += SFCB_FLASH_TOPO_SECTOR_SIZE ) {
+            if ( uint32Adr != uint32Sec ) {     // write enable of first erase issued by worker
+                uint8Pkt[0] = SFCB_FLASH_IST_WR_ENA;
+                (void) sfm(flash, uint8Pkt, 1);
+            }
+            uint8Pkt[0] = SFCB_FLASH_IST_ERASE_SECTOR;
+            for ( uint8_t i = 0; i < SFCB_FLASH_TOPO_ADR_BYTE; i++ ) {
+                uint8Pkt[SFCB_FLASH_TOPO_ADR_BYTE - i] = (uint8_t) (uint32Adr >> (8*i));
+            }
+            if ( 0 != sfm(flash, uint8Pkt, (uint16_t) uint32Hdr) ) {
+                return -1;
+            }
+            do {
+                uint8Pkt[0] = SFCB_FLASH_IST_RD_STATE_REG;
+                uint8Pkt[1] = 0;
+                (void) sfm(flash, uint8Pkt, 2);
+            } while ( 0 != (uint8Pkt[1] & SFCB_FLASH_MNG_WIP_MSK) );
+        }
+        return 0;
+    }
+    /* quad page program */
+    if ( SFCB_FLASH_IST_WR_PAGE_QUAD == uint8PtrSpi[0] ) {
+        memcpy(uint8Pkt, uint8PtrSpi, uint16Len);
+        uint8Pkt[0] = SFCB_FLASH_IST_WR_PAGE;
+        return sfm(flash, uint8Pkt, uint16Len);
+    }
+    /* fast, dual and quad read, without dummy bytes */
+    if ( (0 != xfer->uint8Dummy) && (uint16Len > uint32Hdr + xfer->uint8Dummy) ) {
+        memcpy(uint8Pkt, uint8PtrSpi, uint32Hdr);
+        uint8Pkt[0] = SFCB_FLASH_IST_RD_DATA;
+        if ( 0 != sfm(flash, uint8Pkt, (uint16_t) (uint16Len - xfer->uint8Dummy)) ) {
+            return -1;
+        }
+        memcpy(uint8PtrSpi + uint32Hdr + xfer->uint8Dummy, uint8Pkt + uint32Hdr, (size_t) (uint16Len - uint32Hdr - xfer->uint8Dummy));
+        return 0;
+    }
+    return sfm(flash, uint8PtrSpi, uint16Len);
+}
+
+
+
+/**
+ *  @brief bench_xfer
+ *
+ *  transfers SPI packet to the flash model, advances time by the bus
+ *  duration and overlays the emulated busy state on status reads
+ *
+ *  @param[in]      cfg                 timing, #t_bench_cfg
+ *  @param[in,out]  bus                 busy state, #t_bench_bus
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int bench_xfer (const t_bench_cfg* cfg, t_bench_bus* bus, t_sfm* flash, t_sfcb* sfcb)
+{
+    /** Variables **/
+    const uint16_t      uint16Len = sfcb_spi_len(sfcb);
+    uint8_t*            uint8PtrSpi = sfcb_spi_buf(sfcb);
+    const t_sfcb_xfer*  xfer = sfcb_spi_xfer(sfcb);
+    uint64_t            uint64Clk;      // SPI clocks of packet
+    uint64_t            uint64Start;    // transfer start
+    uint32_t            uint32Hdr = 0;  // address and dummy bytes
+
+    if ( 0 == uint16Len ) {
+        return 0;
+    }
+    /* bus time */
+    uint64Start = g_uint64Ns;
+    uint64Clk = 8 * (uint64_t) uint16Len;
+    if ( (1 != xfer->uint8AdrLanes) || (1 != xfer->uint8DataLanes) ) {
+        uint32Hdr = (uint32_t) (SFCB_FLASH_TOPO_ADR_BYTE + xfer->uint8Dummy);
+        uint64Clk = 8 + (8 * (uint64_t) uint32Hdr) / xfer->uint8AdrLanes + (8 * (uint64_t) (uint16Len - 1 - uint32Hdr)) / xfer->uint8DataLanes;
+    }
+    g_uint64Ns += (uint64Clk * 1000000000u) / cfg->uint32ClkHz;
+    (bus->uint32Pkt)++;
+    bus->uint32Bytes += uint16Len;
+    /* flash model */
+    if ( 0 != bench_sfm(flash, sfcb) ) {
+        printf("ERROR:%s:spi_flash_model ist=0x%02x\n", __FUNCTION__, uint8PtrSpi[0]);
+        return -1;
+    }
+    switch ( uint8PtrSpi[0] ) {
+        /* every status byte is sampled after its transfer */
+        case SFCB_FLASH_IST_RD_STATE_REG:
+            (bus->uint32Polls)++;
+            for ( uint16_t i = 1; i < uint16Len; i++ ) {
+                if ( uint64Start + ((uint64_t) (8 + 8*i) * 1000000000u) / cfg->uint32ClkHz < bus->uint64BusyNs ) {
+                    uint8PtrSpi[i] |= SFCB_FLASH_MNG_WIP_MSK;
+                }
+            }
+            break;
+        case SFCB_FLASH_IST_WR_PAGE:
+        case SFCB_FLASH_IST_WR_PAGE_QUAD:
+            bus->uint64BusyNs = g_uint64Ns + 1000 * (uint64_t) cfg->uint32PpUs;
+            break;
+        case SFCB_FLASH_IST_ERASE_SECTOR:
+            (bus->uint32Erase)++;
+            bus->uint64BusyNs = g_uint64Ns + 1000 * (uint64_t) cfg->uint32SeUs;
+            break;
+        case SFCB_FLASH_IST_ERASE_BLK32:
+            (bus->uint32Erase)++;
+            bus->uint64BusyNs = g_uint64Ns + 1000 * (uint64_t) cfg->uint32Be32Us;
+            break;
+        case SFCB_FLASH_IST_ERASE_BLK64:
+            (bus->uint32Erase)++;
+            bus->uint64BusyNs = g_uint64Ns + 1000 * (uint64_t) cfg->uint32Be64Us;
+            break;
+        case SFCB_FLASH_IST_ERASE_SUSPEND:
+            bus->uint64SusNs = (bus->uint64BusyNs > g_uint64Ns) ? (bus->uint64BusyNs - g_uint64Ns) : 0;
+            bus->uint64BusyNs = g_uint64Ns + 1000 * (uint64_t) cfg->uint32SusUs;
+            break;
+        case SFCB_FLASH_IST_ERASE_RESUME:
+            bus->uint64BusyNs = g_uint64Ns + bus->uint64SusNs;
+            bus->uint64SusNs = 0;
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief bench_run
+ *
+ *  runs worker until job is done, waits of the tick gated WIP poll
+ *  advance the emulated time
+ *
+ *  @param[in]      cfg                 timing, #t_bench_cfg
+ *  @param[in,out]  bus                 busy state, #t_bench_bus
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int bench_run (const t_bench_cfg* cfg, t_bench_bus* bus, t_sfm* flash, t_sfcb* sfcb)
+{
+    /** Variables **/
+    uint32_t    uint32Counter = 0;  // counter for time out
+    uint32_t    uint32Wait;         // remaining WIP time in us
+
+    while ( 0 != sfcb_busy(sfcb) ) {
+        if ( !((uint32Counter++) < g_uint32CallOut) ) {
+            printf("ERROR:%s: worker timeout\n", __FUNCTION__);
+            return -1;
+        }
+        sfcb_worker(sfcb);
+        if ( 0 != sfcb_spi_len(sfcb) ) {
+            if ( 0 != bench_xfer(cfg, bus, flash, sfcb) ) {
+                return -1;
+            }
+        } else {
+            uint32Wait = sfcb_wip_hint(sfcb, NULL);
+            g_uint64Ns += 1000 * (uint64_t) uint32Wait;
+        }
+    }
+    if ( 0 != sfcb_isero(sfcb) ) {
+        printf("ERROR:%s: worker error\n", __FUNCTION__);
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief bench_mount
+ *
+ *  creates queue and measures its mount
+ *
+ *  @param[in]      cfg                 timing, #t_bench_cfg
+ *  @param[in,out]  bus                 busy state, #t_bench_bus
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in,out]  cb                  queue storage, #t_sfcb_cb
+ *  @param[in]      elemSize            payload size of element
+ *  @param[in]      numElems            number of elements in queue
+ *  @param[out]     *ns                 mount time in ns
+ *  @return         int                 state
+ *  @since          2026-10-14
+ */
+static int bench_mount (const t_bench_cfg* cfg, t_bench_bus* bus, t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint16_t elemSize, uint32_t numElems, uint64_t* ns)
+{
+    /** Variables **/
+    uint64_t    uint64Start;    // mount start
+    uint8_t     uint8Cb;        // queue number
+
+    if (    (0 != sfcb_init(sfcb, cb, 1, g_uint8Spi, sizeof(g_uint8Spi)))
+         || (0 != sfcb_wip_cfg(sfcb, 1, bench_tick, 1, g_uint32PollUs))
+         || (0 != sfcb_xfer_cfg(sfcb, cfg->rdMode, 0))
+         || (0 != sfcb_new_cb(sfcb, 0xbe4c0000 + elemSize, elemSize, numElems, &uint8Cb))
+    ) {
+        printf("ERROR:%s: init, elem=%d, num=%d\n", __FUNCTION__, elemSize, numElems);
+        return -1;
+    }
+    uint64Start = g_uint64Ns;
+    if ( (0 != sfcb_mkcb(sfcb)) || (0 != bench_run(cfg, bus, flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_mkcb\n", __FUNCTION__);
+        return -1;
+    }
+    *ns = g_uint64Ns - uint64Start;
+    return 0;
+}
+
+
+
+/**
+ *  @brief bench_queue
+ *
+ *  benchmarks one queue setup on erased flash: mount, wrapping appends,
+ *  remount of the filled queue, get and raw read bandwidth. The flash model
+ *  is erased before the run.
+ *
+ *  @param[in]      cfg                 timing, #t_bench_cfg
+ *  @param[in,out]  flash               spi flash model, #t_sfm
+ *  @param[in]      elemSize            payload size of element
+ *  @param[in]      numElems            number of elements in queue
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int bench_queue (const t_bench_cfg* cfg, t_sfm* flash, uint16_t elemSize, uint32_t numElems)
+{
+    /** Variables **/
+    t_sfcb          sfcb;               // handle
+    t_sfcb_cb       cb[1];              // one queue
+    t_bench_bus     bus;                // emulated busy state
+    t_bench_bus     busAdd;             // counters of append
+    uint8_t*        uint8PtrData;       // element and read buffer
+    uint64_t        uint64MntMty;       // mount of erased queue
+    uint64_t        uint64MntFull;      // mount of filled queue
+    uint64_t        uint64Start;        // measurement start
+    uint64_t        uint64Add;          // appends overall
+    uint64_t        uint64AddMax = 0;   // worst add latency
+    uint64_t        uint64Get;          // get last
+    uint64_t        uint64Raw;          // raw read
+    uint32_t        uint32NumAdd;       // number of appends
+    uint32_t        uint32Raw;          // raw read length
+    const uint32_t  uint32NumGet = 16;  // number of reads
+
+    memset(&bus, 0, sizeof(bus));
+    uint8PtrData = malloc(65536);
+    if ( NULL == uint8PtrData ) {
+        printf("ERROR:%s: init\n", __FUNCTION__);
+        return -1;
+    }
+    memset(flash->uint8PtrMem, 0xff, flash->uint32FlashSize);  // erased flash, model reused by all setups
+    for ( uint32_t i = 0; i < 65536; i++ ) {
+        uint8PtrData[i] = (uint8_t) i;
+    }
+    /* mount of erased flash */
+    if ( 0 != bench_mount(cfg, &bus, flash, &sfcb, cb, elemSize, numElems, &uint64MntMty) ) {
+        free(uint8PtrData);
+        return -1;
+    }
+    /* wrap queue twice, includes erases */
+    memset(&bus, 0, sizeof(bus));
+    uint32NumAdd = 2 * cb[0].uint32NumEntriesMax;
+    uint64Add = g_uint64Ns;
+    for ( uint32_t i = 0; i < uint32NumAdd; i++ ) {
+        uint64Start = g_uint64Ns;
+        if ( (0 != sfcb_add(&sfcb, 0, uint8PtrData, elemSize)) || (0 != bench_run(cfg, &bus, flash, &sfcb)) ) {
+            printf("ERROR:%s:sfcb_add: i=%d\n", __FUNCTION__, i);
+            free(uint8PtrData);
+            return -1;
+        }
+        if ( g_uint64Ns - uint64Start > uint64AddMax ) {
+            uint64AddMax = g_uint64Ns - uint64Start;
+        }
+    }
+    uint64Add = g_uint64Ns - uint64Add;
+    busAdd = bus;
+    /* mount of filled queue with fresh handle */
+    if ( 0 != bench_mount(cfg, &bus, flash, &sfcb, cb, elemSize, numElems, &uint64MntFull) ) {
+        free(uint8PtrData);
+        return -1;
+    }
+    /* get last */
+    uint64Get = g_uint64Ns;
+    for ( uint32_t i = 0; i < uint32NumGet; i++ ) {
+        if ( (0 != sfcb_get_last(&sfcb, 0, uint8PtrData, elemSize)) || (0 != bench_run(cfg, &bus, flash, &sfcb)) ) {
+            printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+            free(uint8PtrData);
+            return -1;
+        }
+    }
+    uint64Get = g_uint64Ns - uint64Get;
+    /* raw read of queue */
+    uint32Raw = cb[0].uint32NumEntriesMax * cb[0].uint32NumPagesPerElem * SFCB_FLASH_TOPO_PAGE_SIZE;
+    if ( uint32Raw > 65536 ) {
+        uint32Raw = 65536;
+    }
+    uint64Raw = g_uint64Ns;
+    if ( (0 != sfcb_flash_read(&sfcb, cb[0].uint32StartSector * SFCB_FLASH_TOPO_SECTOR_SIZE, uint8PtrData, uint32Raw)) || (0 != bench_run(cfg, &bus, flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_flash_read\n", __FUNCTION__);
+        free(uint8PtrData);
+        return -1;
+    }
+    uint64Raw = g_uint64Ns - uint64Raw;
+    /* CSV line, see main for columns */
+    printf("%s,%u,%d,%u,%u,%llu,%llu,%u,%llu,%llu,%llu,%u,%u,%u,%u,%llu,%llu\n",
+        SFCB_FLASH_NAME, cfg->uint32ClkHz, (int) cfg->rdMode, elemSize, cb[0].uint32NumEntriesMax,
+        (unsigned long long) (uint64MntMty / 1000), (unsigned long long) (uint64MntFull / 1000),
+        uint32NumAdd,
+        (unsigned long long) (((uint64_t) uint32NumAdd * elemSize * 1000000000u) / uint64Add),
+        (unsigned long long) (uint64Add / uint32NumAdd / 1000), (unsigned long long) (uint64AddMax / 1000),
+        busAdd.uint32Pkt, busAdd.uint32Bytes, busAdd.uint32Polls, busAdd.uint32Erase,
+        (unsigned long long) (((uint64_t) uint32NumGet * elemSize * 1000000000u) / uint64Get),
+        (unsigned long long) (((uint64_t) uint32Raw * 1000000000u) / uint64Raw)
+    );
+    free(uint8PtrData);
+    return 0;
+}
+
+
+
+/**
+ *  Main
+ *  ----
+ *  arguments as key=value: clk=<Hz> tpp=<us> tse=<us> tbe32=<us> tbe64=<us> rd=<t_sfcb_rdmode>
+ */
+int main (int argc, char *argv[])
+{
+    /** Variables **/
+    t_bench_cfg     cfg;                                        // emulated timing
+    t_sfm           flash;                                      // spi flash model
+    const uint16_t  uint16Elem[] = {16, 240, 1008, 4080, 16368};   // payload sizes
+    const uint32_t  uint32Num[] = {16, 64};                     // queue sizes
+    char*           chrPtrVal;                                  // argument value
+
+    /* defaults, typical datasheet values */
+    cfg.uint32ClkHz = 50000000;
+    cfg.uint32PpUs = SFCB_FLASH_TIME_PAGE_PROG;
+    cfg.uint32SeUs = SFCB_FLASH_TIME_ERASE_SECTOR;
+    cfg.uint32Be32Us = SFCB_FLASH_TIME_ERASE_BLK32;
+    cfg.uint32Be64Us = SFCB_FLASH_TIME_ERASE_BLK64;
+    cfg.uint32SusUs = 20;
+    cfg.rdMode = SFCB_RD_SINGLE;
+    for ( int i = 1; i < argc; i++ ) {
+        chrPtrVal = strchr(argv[i], '=');
+        if ( NULL == chrPtrVal ) {
+            printf("usage: %s [clk=<Hz>] [tpp=<us>] [tse=<us>] [tbe32=<us>] [tbe64=<us>] [rd=<mode>]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+        chrPtrVal++;
+        if ( 0 == strncmp(argv[i], "clk=", 4) ) {
+            cfg.uint32ClkHz = (uint32_t) strtoul(chrPtrVal, NULL, 0);
+        } else if ( 0 == strncmp(argv[i], "tpp=", 4) ) {
+            cfg.uint32PpUs = (uint32_t) strtoul(chrPtrVal, NULL, 0);
+        } else if ( 0 == strncmp(argv[i], "tse=", 4) ) {
+            cfg.uint32SeUs = (uint32_t) strtoul(chrPtrVal, NULL, 0);
+        } else if ( 0 == strncmp(argv[i], "tbe32=", 6) ) {
+            cfg.uint32Be32Us = (uint32_t) strtoul(chrPtrVal, NULL, 0);
+        } else if ( 0 == strncmp(argv[i], "tbe64=", 6) ) {
+            cfg.uint32Be64Us = (uint32_t) strtoul(chrPtrVal, NULL, 0);
+        } else if ( 0 == strncmp(argv[i], "rd=", 3) ) {
+            cfg.rdMode = (t_sfcb_rdmode) strtoul(chrPtrVal, NULL, 0);
+        }
+    }
+    if ( 0 == cfg.uint32ClkHz ) {
+        printf("ERROR:%s: SPI clock is zero\n", __FUNCTION__);
+        exit(EXIT_FAILURE);
+    }
+    if ( 0 != sfm_init(&flash, SFCB_FLASH_NAME) ) {
+        printf("ERROR:%s:sfm_init\n", __FUNCTION__);
+        exit(EXIT_FAILURE);
+    }
+    /* header, times in us, bandwidth in byte/s */
+    printf("flash,clk_hz,rd,elem,num,mount_empty_us,mount_full_us,add_n,add_Bps,add_avg_us,add_max_us,add_spi,add_bytes,add_polls,add_erase,get_Bps,raw_Bps\n");
+    for ( uint8_t i = 0; i < sizeof(uint16Elem)/sizeof(uint16Elem[0]); i++ ) {
+        for ( uint8_t j = 0; j < sizeof(uint32Num)/sizeof(uint32Num[0]); j++ ) {
+            if ( 0 != bench_queue(&cfg, &flash, uint16Elem[i], uint32Num[j]) ) {
+                free(flash.uint8PtrMem);
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+    free(flash.uint8PtrMem);
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,856 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : BSDv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : sfcb_image.c
+ @date          : 2026-10-14
+
+ @brief         : Flash image decoder
+                  mounts flash dumps through mmap as read-only SPI flash
+                  and exports all elements with the library mount and
+                  iterator. Erases of the mount go to a private copy. Every image is mounted once, every queue is
+                  exported by one job on a copy of the mounted handle,
+                  jobs run in parallel threads. One JSON line per
+                  element, packed or encoded record is written to stdout.
+
+***********************************************************************/
+
+
+
+/** Standard libs **/
+#include <stdio.h>          // f.e. printf
+#include <stdlib.h>         // strtoul, exit
+#include <stdint.h>         // defines fiexd data types, like int8_t...
+#include <stdarg.h>         // va_list
+#include <string.h>         // string handling functions
+#include <pthread.h>        // parallel jobs
+#include <fcntl.h>          // open
+#include <unistd.h>         // close
+#include <sys/mman.h>       // mmap
+#include <sys/stat.h>       // fstat
+
+/** User Libs **/
+#include "spi_flash_cb.h"
+
+
+
+/** Defines **/
+#define IMAGE_Q_MAX     (16)        /**< maximum number of queues */
+#define IMAGE_SPI_LEN   (32768)     /**< SPI packet buffer, bytes per read transfer */
+#define IMAGE_OUT_LEN   (1048576)   /**< job output is flushed to stdout in blocks of this size */
+#define IMAGE_LINE_LEN  (2 * 65536 + 512)   /**< longest JSON line */
+#define IMAGE_CKPT_LEN  (65535)     /**< checkpoint buffer */
+
+
+
+/** Globals **/
+const uint32_t  g_uint32CallOut = 100000000;            // abort worker loop
+pthread_mutex_t g_mtxOut = PTHREAD_MUTEX_INITIALIZER;   // serializes stdout
+
+
+
+/**
+ *  @typedef t_image_q
+ *
+ *  @brief  Queue definition, same order and arguments as on target
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_image_q {
+    char        chrType;        /**< e: element, p: packed, c: record codec, k: checkpoint */
+    uint32_t    uint32Magic;    /**< magic number */
+    uint16_t    uint16Size;     /**< payload size, record size of packed queue */
+    uint32_t    uint32Num;      /**< number of elements, records of packed queue */
+    uint16_t    uint16Rec;      /**< record size of record codec */
+    uint8_t     uint8Crc;       /**< payload CRC32, see #sfcb_crc_cfg */
+} t_image_q;
+
+
+
+/**
+ *  @typedef t_image
+ *
+ *  @brief  Mapped flash image
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_image {
+    const char*     chrPtrPath;             /**< file name */
+    const uint8_t*  uint8PtrMem;            /**< mapped image */
+    size_t          size;                   /**< image size in bytes */
+    uint8_t*        uint8PtrCow;            /**< private copy written by the mount, NULL if the mount did not write */
+    size_t          cowSize;                /**< size of private copy, at least flash size */
+    uint8_t         uint8Wel;               /**< write enable latch of the virtual flash */
+    t_sfcb          sfcb;                   /**< mounted handle, copied by the export jobs */
+    t_sfcb_cb*      cb;                     /**< queue list of mounted handle */
+    uint8_t*        spi;                    /**< SPI packet buffer of mounted handle */
+    uint8_t*        ckpt;                   /**< checkpoint buffer */
+    uint8_t*        codec[IMAGE_Q_MAX];     /**< codec buffers of mounted handle */
+    int             intMount;               /**< mount state */
+} t_image;
+
+
+
+/**
+ *  @typedef t_image_job
+ *
+ *  @brief  Decode job, one queue of one image
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_image_job {
+    t_image*            img;            /**< flash image */
+    const t_image_q*    q;              /**< queue list */
+    uint8_t             uint8NumQ;      /**< number of queues */
+    uint8_t             uint8NumCbs;    /**< queue slots of target, see #sfcb_init */
+    uint8_t             uint8Cb;        /**< decoded queue */
+    int                 intRet;         /**< job state */
+} t_image_job;
+
+
+
+/**
+ *  @typedef t_image_ctx
+ *
+ *  @brief  Iterator state of one job
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_image_ctx {
+    const t_image_job*  job;            /**< decoded job */
+    char*               chrPtrOut;      /**< job output buffer, #IMAGE_OUT_LEN + #IMAGE_LINE_LEN bytes */
+    size_t              outLen;         /**< job output length */
+    uint8_t*            uint8PtrPl;     /**< collected payload of current element or record */
+    uint32_t            uint32PlLen;    /**< collected bytes */
+    uint32_t            uint32Elems;    /**< exported elements or records */
+    uint32_t            uint32Eros;     /**< corrupted elements */
+    int                 intRet;         /**< export state, line buffer exceeded */
+} t_image_ctx;
+
+
+
+/**
+ *  @typedef t_image_run
+ *
+ *  @brief  Job function, mount or export
+ *
+ *  @since  2026-10-14
+ */
+typedef int (*t_image_run)(t_image_job* job);
+
+
+
+/**
+ *  @typedef t_image_pool
+ *
+ *  @brief  Job list shared by the threads
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_image_pool {
+    t_image_job*    jobs;       /**< jobs */
+    uint32_t        uint32Num;  /**< number of jobs */
+    uint32_t        uint32Next; /**< next free job, atomic */
+    t_image_run     run;        /**< job function */
+} t_image_pool;
+
+
+
+/**
+ *  @brief image_cow
+ *
+ *  emulates page program and erase of the mount on a private copy of the
+ *  image, the mapped file is never written. A full queue is reclaimed like
+ *  on target, the mount erases the oldest elements in the copy. Writes after
+ *  the mount are rejected, the export jobs share the image.
+ *
+ *  @param[in,out]  img                 flash image, #t_image
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      uint32Adr           flash address of instruction
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  unsupported instruction, write without enable or after mount
+ *  @since          2026-10-14
+ */
+static int image_cow (t_image* img, t_sfcb* sfcb, uint32_t uint32Adr)
+{
+    /** Variables **/
+    const t_sfcb_flash* flash = sfcb_flash_desc(sfcb);
+    const uint16_t      uint16Len = sfcb_spi_len(sfcb);
+    const uint8_t*      uint8PtrSpi = sfcb_spi_buf(sfcb);
+    uint32_t            uint32Size = 0; // erased bytes
+    uint32_t            uint32Page;     // start of programmed page
+
+    if ( 0 == img->intMount ) {
+        fprintf(stderr, "ERROR:%s: %s: write access ist=0x%02x to mounted image\n", __FUNCTION__, img->chrPtrPath, uint8PtrSpi[0]);
+        return -1;
+    }
+    if ( flash->uint8IstWrEna == uint8PtrSpi[0] ) {
+        img->uint8Wel = 1;
+        return 0;
+    }
+    if ( flash->uint8IstEraseSector == uint8PtrSpi[0] ) {
+        uint32Size = flash->uint32SectorSize;
+    } else if ( (0 != flash->uint8IstEraseBlk32) && (flash->uint8IstEraseBlk32 == uint8PtrSpi[0]) ) {
+        uint32Size = flash->uint32Blk32Size;
+    } else if ( (0 != flash->uint8IstEraseBlk64) && (flash->uint8IstEraseBlk64 == uint8PtrSpi[0]) ) {
+        uint32Size = flash->uint32Blk64Size;
+    } else if ( (flash->uint8IstWrPage != uint8PtrSpi[0]) && ((0 == flash->uint8IstWrPageQuad) || (flash->uint8IstWrPageQuad != uint8PtrSpi[0])) ) {
+        fprintf(stderr, "ERROR:%s: %s: unsupported instruction ist=0x%02x\n", __FUNCTION__, img->chrPtrPath, uint8PtrSpi[0]);
+        return -1;
+    }
+    if ( 0 == img->uint8Wel ) {
+        fprintf(stderr, "ERROR:%s: %s: ist=0x%02x without write enable\n", __FUNCTION__, img->chrPtrPath, uint8PtrSpi[0]);
+        return -1;
+    }
+    img->uint8Wel = 0;
+    /* private copy on first write, bytes behind the image are erased */
+    if ( NULL == img->uint8PtrCow ) {
+        img->cowSize = (img->size > sfcb_flash_size(sfcb)) ? img->size : sfcb_flash_size(sfcb);
+        img->uint8PtrCow = malloc(img->cowSize);
+        if ( NULL == img->uint8PtrCow ) {
+            fprintf(stderr, "ERROR:%s: out of memory\n", __FUNCTION__);
+            return -1;
+        }
+        memcpy(img->uint8PtrCow, img->uint8PtrMem, img->size);
+        memset(img->uint8PtrCow + img->size, 0xff, img->cowSize - img->size);
+    }
+    /* erase */
+    if ( 0 != uint32Size ) {
+        uint32Adr = uint32Adr - (uint32Adr % uint32Size);
+        for ( uint32_t i = uint32Adr; (i < uint32Adr + uint32Size) && (i < img->cowSize); i++ ) {
+            img->uint8PtrCow[i] = 0xff;
+        }
+        return 0;
+    }
+    /* page program, clears bits only, wraps at page end */
+    uint32Page = uint32Adr - (uint32Adr % flash->uint16PageSize);
+    for ( uint32_t i = 1u + flash->uint8AdrByte; i < uint16Len; i++ ) {
+        if ( uint32Adr < img->cowSize ) {
+            img->uint8PtrCow[uint32Adr] &= uint8PtrSpi[i];
+        }
+        uint32Adr = uint32Page + (uint32Adr + 1 - uint32Page) % flash->uint16PageSize;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief image_xfer
+ *
+ *  virtual SPI flash, answers reads from the mapped image or its private
+ *  copy and status reads with idle. Bytes behind the image read erased.
+ *  Writes of the mount go to the private copy, see #image_cow.
+ *  Instructions and address bytes are taken from the flash descriptor of the handle.
+ *
+ *  @param[in,out]  img                 flash image, #t_image
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  unsupported instruction or write access to mounted image
+ *  @since          2026-10-14
+ */
+static int image_xfer (t_image* img, t_sfcb* sfcb)
+{
+    /** Variables **/
+    const t_sfcb_flash* flash = sfcb_flash_desc(sfcb);
+    const uint16_t      uint16Len = sfcb_spi_len(sfcb);
+    uint8_t*            uint8PtrSpi = sfcb_spi_buf(sfcb);
+    const uint8_t*      uint8PtrMem = (NULL != img->uint8PtrCow) ? img->uint8PtrCow : img->uint8PtrMem;
+    const size_t        memSize = (NULL != img->uint8PtrCow) ? img->cowSize : img->size;
+    uint32_t            uint32Hdr;  // instruction, address and dummy bytes
+    uint32_t            uint32Adr;  // flash address
+
+    if ( 0 == uint16Len ) {
+        return 0;
+    }
+    /* status, never busy */
+    if ( flash->uint8IstRdStateReg == uint8PtrSpi[0] ) {
+        memset(uint8PtrSpi + 1, 0, (size_t) (uint16Len - 1));
+        return 0;
+    }
+    uint32Adr = 0;
+    for ( uint8_t i = 0; (i < flash->uint8AdrByte) && ((uint32_t) (1 + i) < uint16Len); i++ ) {
+        uint32Adr = (uint32Adr << 8) | uint8PtrSpi[1+i];
+    }
+    /* read instructions of the flash */
+    if (    (flash->uint8IstRdData == uint8PtrSpi[0])
+         || (flash->uint8IstRdFast == uint8PtrSpi[0])
+         || (flash->uint8IstRdDual == uint8PtrSpi[0])
+         || (flash->uint8IstRdQuad == uint8PtrSpi[0])
+         || (flash->uint8IstRdQuadIo == uint8PtrSpi[0])
+    ) {
+        uint32Hdr = 1u + flash->uint8AdrByte + sfcb_spi_xfer(sfcb)->uint8Dummy;
+        for ( uint32_t i = uint32Hdr; i < uint16Len; i++ ) {
+            uint8PtrSpi[i] = (uint32Adr < memSize) ? uint8PtrMem[uint32Adr] : 0xff;
+            uint32Adr++;
+        }
+        return 0;
+    }
+    return image_cow(img, sfcb, uint32Adr);
+}
+
+
+
+/**
+ *  @brief image_run
+ *
+ *  runs worker until job is done
+ *
+ *  @param[in,out]  img                 flash image, #t_image
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int image_run (t_image* img, t_sfcb* sfcb)
+{
+    /** Variables **/
+    uint32_t    uint32Counter = 0;  // counter for time out
+
+    while ( (0 != sfcb_busy(sfcb)) && ((uint32Counter++) < g_uint32CallOut) ) {
+        sfcb_worker(sfcb);
+        if ( 0 != image_xfer(img, sfcb) ) {
+            return -1;
+        }
+    }
+    if ( !(uint32Counter < g_uint32CallOut) ) {
+        fprintf(stderr, "ERROR:%s: %s: worker timeout\n", __FUNCTION__, img->chrPtrPath);
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief image_flush
+ *
+ *  writes collected lines of job to stdout, lines of parallel jobs
+ *  are not mixed
+ *
+ *  @param[in,out]  ctx                 iterator state, #t_image_ctx
+ *  @param[in]      force               flush independent of fill level
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void image_flush (t_image_ctx* ctx, int force)
+{
+    if ( (0 == ctx->outLen) || ((0 == force) && (ctx->outLen < IMAGE_OUT_LEN)) ) {
+        return;
+    }
+    pthread_mutex_lock(&g_mtxOut);
+    fwrite(ctx->chrPtrOut, 1, ctx->outLen, stdout);
+    pthread_mutex_unlock(&g_mtxOut);
+    ctx->outLen = 0;
+}
+
+
+
+/**
+ *  @brief image_printf
+ *
+ *  appends formatted text to the job output, keeps at least the
+ *  terminating zero in the buffer
+ *
+ *  @param[in,out]  ctx                 iterator state, #t_image_ctx
+ *  @param[in]      fmt                 format string
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  line buffer exceeded, output is truncated
+ *  @since          2026-10-14
+ */
+static int image_printf (t_image_ctx* ctx, const char* fmt, ...)
+{
+    /** Variables **/
+    const size_t    free = IMAGE_OUT_LEN + IMAGE_LINE_LEN - ctx->outLen;    // free bytes in output
+    va_list         args;
+    int             intLen;     // written characters
+
+    va_start(args, fmt);
+    intLen = vsnprintf(ctx->chrPtrOut + ctx->outLen, free, fmt, args);
+    va_end(args);
+    if ( (0 > intLen) || !((size_t) intLen < free) ) {
+        fprintf(stderr, "ERROR:%s: %s: q=%u, line exceeds %d bytes\n", __FUNCTION__, ctx->job->img->chrPtrPath, ctx->job->uint8Cb, IMAGE_LINE_LEN);
+        ctx->intRet = -1;
+        return -1;
+    }
+    ctx->outLen += (size_t) intLen;
+    return 0;
+}
+
+
+
+/**
+ *  @brief image_line
+ *
+ *  exports element or record as JSON line, an exceeded line buffer
+ *  drops the line and fails the job
+ *
+ *  @param[in,out]  ctx                 iterator state, #t_image_ctx
+ *  @param[in]      idNum               element or record id
+ *  @param[in]      rec                 record number in encoded element, negative if not present
+ *  @param[in]      data                payload
+ *  @param[in]      len                 payload length
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void image_line (t_image_ctx* ctx, uint32_t idNum, int32_t rec, const uint8_t* data, uint32_t len)
+{
+    /** Variables **/
+    const char      chrHex[] = "0123456789abcdef";
+    const size_t    lineStart = ctx->outLen;    // drop line if truncated
+    char*           chrPtrHex;                  // payload as hex
+
+    if (    (0 != image_printf(ctx, "{\"img\":\"%s\",\"q\":%u,\"id\":%u,", ctx->job->img->chrPtrPath, ctx->job->uint8Cb, idNum))
+         || ((0 <= rec) && (0 != image_printf(ctx, "\"rec\":%d,", rec)))
+         || (0 != image_printf(ctx, "\"len\":%u,\"data\":\"", len))
+         || ((IMAGE_OUT_LEN + IMAGE_LINE_LEN - ctx->outLen) < (2 * (size_t) len + 1))
+    ) {
+        ctx->intRet = -1;
+        ctx->outLen = lineStart;
+        return;
+    }
+    chrPtrHex = ctx->chrPtrOut + ctx->outLen;
+    for ( uint32_t i = 0; i < len; i++ ) {
+        *(chrPtrHex++) = chrHex[data[i] >> 4];
+        *(chrPtrHex++) = chrHex[data[i] & 0xf];
+    }
+    ctx->outLen += 2 * (size_t) len;
+    if ( 0 != image_printf(ctx, "\"}\n") ) {
+        ctx->outLen = lineStart;
+        return;
+    }
+    (ctx->uint32Elems)++;
+    image_flush(ctx, 0);
+}
+
+
+
+/**
+ *  @brief image_iter
+ *
+ *  element iterator, collects payload chunks and exports complete
+ *  elements and packed records, encoded records are exported per call
+ *
+ *  @param[in,out]  arg                 iterator state, #t_image_ctx
+ *  @param[in]      idNum               element id, record id for packed queues
+ *  @param[in]      ofs                 byte offset in payload, record number for codec queues
+ *  @param[in]      data                chunk data, NULL if element is complete
+ *  @param[in]      len                 number of bytes
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void image_iter (void *arg, uint32_t idNum, uint16_t ofs, const uint8_t *data, uint16_t len)
+{
+    /** Variables **/
+    t_image_ctx*    ctx = (t_image_ctx*) arg;
+
+    /* record codec, one decoded record per call */
+    if ( 'c' == ctx->job->q[ctx->job->uint8Cb].chrType ) {
+        if ( NULL != data ) {
+            image_line(ctx, idNum, ofs, data, len);
+        }
+        return;
+    }
+    /* element or record complete */
+    if ( NULL == data ) {
+        image_line(ctx, idNum, -1, ctx->uint8PtrPl, ctx->uint32PlLen);
+        ctx->uint32PlLen = 0;
+        return;
+    }
+    memcpy(ctx->uint8PtrPl + ofs, data, len);
+    if ( (uint32_t) (ofs + len) > ctx->uint32PlLen ) {
+        ctx->uint32PlLen = (uint32_t) (ofs + len);
+    }
+}
+
+
+
+/**
+ *  @brief image_mount
+ *
+ *  creates the queues in target order and mounts them from the image,
+ *  the mounted handle is copied by the export jobs of the image
+ *
+ *  @param[in,out]  job                 mount job, #t_image_job
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int image_mount (t_image_job* job)
+{
+    /** Variables **/
+    t_image*            img = job->img; // mounted image
+    const t_image_q*    q;              // queue definition
+    uint8_t             uint8Cb;        // queue number
+    int                 intRet;         // create state
+
+    img->intMount = -1;
+    img->spi = malloc(IMAGE_SPI_LEN);
+    img->ckpt = malloc(IMAGE_CKPT_LEN);
+    img->cb = malloc(job->uint8NumCbs * sizeof(t_sfcb_cb));
+    if ( (NULL == img->spi) || (NULL == img->ckpt) || (NULL == img->cb) ) {
+        fprintf(stderr, "ERROR:%s: out of memory\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != sfcb_init(&(img->sfcb), img->cb, job->uint8NumCbs, img->spi, IMAGE_SPI_LEN) ) {
+        fprintf(stderr, "ERROR:%s:sfcb_init\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint8_t i = 0; i < job->uint8NumQ; i++ ) {
+        q = &(job->q[i]);
+        switch ( q->chrType ) {
+            case 'p':
+                intRet = sfcb_new_pack(&(img->sfcb), q->uint32Magic, q->uint16Size, q->uint32Num, &uint8Cb);
+                break;
+            case 'k':
+                intRet = sfcb_new_ckpt(&(img->sfcb), q->uint32Magic, (uint16_t) q->uint32Num, img->ckpt, IMAGE_CKPT_LEN, &uint8Cb);
+                break;
+            default:
+                intRet = sfcb_new_cb(&(img->sfcb), q->uint32Magic, q->uint16Size, q->uint32Num, &uint8Cb);
+                break;
+        }
+        if ( (0 == intRet) && (0 != q->uint8Crc) ) {
+            intRet = sfcb_crc_cfg(&(img->sfcb), uint8Cb, 1);
+        }
+        if ( (0 == intRet) && ('c' == q->chrType) ) {
+            img->codec[i] = malloc(SFCB_CODEC_BUF((size_t) q->uint16Rec));
+            intRet = (NULL == img->codec[i]) ? SFCB_E_MEM : sfcb_codec_cfg(&(img->sfcb), uint8Cb, q->uint16Rec, img->codec[i], (uint16_t) SFCB_CODEC_BUF(q->uint16Rec), NULL);
+        }
+        if ( 0 != intRet ) {
+            fprintf(stderr, "ERROR:%s: queue %d not created, ret=%d\n", __FUNCTION__, i, intRet);
+            return -1;
+        }
+    }
+    if ( (0 != sfcb_mkcb(&(img->sfcb))) || (0 != image_run(img, &(img->sfcb))) || (0 != sfcb_isero(&(img->sfcb))) ) {
+        fprintf(stderr, "ERROR:%s: %s: mount failed\n", __FUNCTION__, img->chrPtrPath);
+        return -1;
+    }
+    if ( img->size > sfcb_flash_size(&(img->sfcb)) ) {
+        fprintf(stderr, "WARNING:%s: %s: image larger than %s\n", __FUNCTION__, img->chrPtrPath, sfcb_flash_desc(&(img->sfcb))->charName);
+    }
+    img->intMount = 0;
+    return 0;
+}
+
+
+
+/**
+ *  @brief image_job
+ *
+ *  exports all elements of one queue with a copy of the mounted handle,
+ *  a corrupted element is reported as error line and the export continues
+ *  with the next element
+ *
+ *  @param[in,out]  job                 decode job, #t_image_job
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int image_job (t_image_job* job)
+{
+    /** Variables **/
+    t_sfcb          sfcb;                       // copy of mounted handle
+    t_sfcb_cb*      cb;                         // queue list
+    uint8_t*        spi;                        // SPI packet buffer
+    uint8_t*        codec;                      // codec buffer
+    size_t          codecLen = 0;               // largest codec buffer
+    t_image_ctx     ctx;                        // iterator state
+    uint32_t        uint32Id;                   // next exported element
+    int             intRet = -1;                // job state
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.job = job;
+    if ( 0 != job->img->intMount ) {
+        return -1;  // mount failed, reported by image_mount
+    }
+    for ( uint8_t i = 0; i < job->uint8NumQ; i++ ) {
+        if ( ('c' == job->q[i].chrType) && (SFCB_CODEC_BUF((size_t) job->q[i].uint16Rec) > codecLen) ) {
+            codecLen = SFCB_CODEC_BUF((size_t) job->q[i].uint16Rec);
+        }
+    }
+    spi = malloc(IMAGE_SPI_LEN);
+    codec = malloc(codecLen + 1);
+    ctx.uint8PtrPl = malloc(65536);
+    ctx.chrPtrOut = malloc(IMAGE_OUT_LEN + IMAGE_LINE_LEN);
+    cb = malloc(job->uint8NumCbs * sizeof(t_sfcb_cb));
+    if ( (NULL == spi) || (NULL == codec) || (NULL == ctx.uint8PtrPl) || (NULL == ctx.chrPtrOut) || (NULL == cb) ) {
+        fprintf(stderr, "ERROR:%s: out of memory\n", __FUNCTION__);
+        goto JOB_END;
+    }
+    if ( 0 != sfcb_init_copy(&sfcb, &(job->img->sfcb), cb, job->uint8NumCbs, spi, IMAGE_SPI_LEN, codec, (uint16_t) codecLen) ) {
+        fprintf(stderr, "ERROR:%s:sfcb_init_copy\n", __FUNCTION__);
+        goto JOB_END;
+    }
+    /* export queue, go on behind corrupted element */
+    uint32Id = sfcb_idmin(&sfcb, job->uint8Cb);
+    while ( uint32Id <= sfcb_idmax(&sfcb, job->uint8Cb) ) {
+        ctx.uint32PlLen = 0;
+        if ( 0 != sfcb_iter(&sfcb, job->uint8Cb, uint32Id, UINT32_MAX, image_iter, &ctx) ) {
+            break;  // empty queue or element not in queue
+        }
+        if ( 0 != image_run(job->img, &sfcb) ) {
+            goto JOB_END;
+        }
+        if ( 0 == sfcb_isero(&sfcb) ) {
+            break;  // all done
+        }
+        if ( 0 != image_printf(&ctx, "{\"img\":\"%s\",\"q\":%u,\"id\":%u,\"error\":%d}\n", job->img->chrPtrPath, job->uint8Cb, sfcb_iter_id(&sfcb), sfcb_error(&sfcb)) ) {
+            break;
+        }
+        (ctx.uint32Eros)++;
+        image_flush(&ctx, 0);
+        uint32Id = sfcb_iter_id(&sfcb) + 1;
+    }
+    image_flush(&ctx, 1);
+    fprintf(stderr, "INFO:%s: %s: q=%d, exported=%u, corrupted=%u\n", __FUNCTION__, job->img->chrPtrPath, job->uint8Cb, ctx.uint32Elems, ctx.uint32Eros);
+    intRet = ctx.intRet;
+
+JOB_END:
+    free(ctx.chrPtrOut);
+    free(cb);
+    free(codec);
+    free(ctx.uint8PtrPl);
+    free(spi);
+    return intRet;
+}
+
+
+
+/**
+ *  @brief image_thread
+ *
+ *  takes jobs from the pool until all are done
+ *
+ *  @param[in,out]  arg                 job pool, #t_image_pool
+ *  @return         void*               NULL
+ *  @since          2026-10-14
+ */
+static void* image_thread (void* arg)
+{
+    /** Variables **/
+    t_image_pool*   pool = (t_image_pool*) arg;
+    uint32_t        uint32Job;  // taken job
+
+    for ( ;; ) {
+        uint32Job = __atomic_fetch_add(&(pool->uint32Next), 1, __ATOMIC_RELAXED);
+        if ( !(uint32Job < pool->uint32Num) ) {
+            break;
+        }
+        pool->jobs[uint32Job].intRet = pool->run(&(pool->jobs[uint32Job]));
+    }
+    return NULL;
+}
+
+
+
+/**
+ *  @brief image_pool
+ *
+ *  runs all jobs of the pool in parallel threads
+ *
+ *  @param[in,out]  pool                job pool, #t_image_pool
+ *  @param[in]      run                 job function, #t_image_run
+ *  @param[in]      thread              thread list
+ *  @param[in]      uint32Threads       number of threads
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  at least one job failed
+ *  @since          2026-10-14
+ */
+static int image_pool (t_image_pool* pool, t_image_run run, pthread_t* thread, uint32_t uint32Threads)
+{
+    pool->run = run;
+    pool->uint32Next = 0;
+    for ( uint32_t i = 0; i < uint32Threads; i++ ) {
+        if ( 0 != pthread_create(&thread[i], NULL, image_thread, pool) ) {
+            fprintf(stderr, "ERROR:%s: pthread_create\n", __FUNCTION__);
+            exit(EXIT_FAILURE);
+        }
+    }
+    for ( uint32_t i = 0; i < uint32Threads; i++ ) {
+        pthread_join(thread[i], NULL);
+    }
+    for ( uint32_t i = 0; i < pool->uint32Num; i++ ) {
+        if ( 0 != pool->jobs[i].intRet ) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief image_queue
+ *
+ *  parses queue definition type,magic,size,num[,rec][,crc]
+ *
+ *  @param[in]      str                 queue definition
+ *  @param[out]     q                   queue, #t_image_q
+ *  @return         int                 state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int image_queue (const char* str, t_image_q* q)
+{
+    /** Variables **/
+    char*   chrPtrEnd;  // parsed up to
+
+    memset(q, 0, sizeof(*q));
+    q->chrType = str[0];
+    if ( (NULL == strchr("epck", q->chrType)) || (',' != str[1]) ) {
+        return -1;
+    }
+    q->uint32Magic = (uint32_t) strtoul(str + 2, &chrPtrEnd, 0);
+    if ( 'k' != q->chrType ) {
+        if ( ',' != *chrPtrEnd ) {
+            return -1;
+        }
+        q->uint16Size = (uint16_t) strtoul(chrPtrEnd + 1, &chrPtrEnd, 0);
+    }
+    if ( ',' != *chrPtrEnd ) {
+        return -1;
+    }
+    q->uint32Num = (uint32_t) strtoul(chrPtrEnd + 1, &chrPtrEnd, 0);
+    if ( 'c' == q->chrType ) {
+        if ( ',' != *chrPtrEnd ) {
+            return -1;
+        }
+        q->uint16Rec = (uint16_t) strtoul(chrPtrEnd + 1, &chrPtrEnd, 0);
+    }
+    if ( 0 == strcmp(chrPtrEnd, ",crc") ) {
+        q->uint8Crc = 1;
+    } else if ( '\0' != *chrPtrEnd ) {
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  Main
+ *  ----
+ *  arguments as key=value: q=<queue> j=<threads> cbs=<slots>, followed by images
+ */
+int main (int argc, char *argv[])
+{
+    /** Variables **/
+    t_image_q       q[IMAGE_Q_MAX];     // queue list
+    uint8_t         uint8NumQ = 0;      // number of queues
+    uint8_t         uint8NumCbs = 0;    // queue slots of target
+    uint32_t        uint32Threads = 4;  // parallel jobs
+    t_image*        img;                // images
+    uint32_t        uint32NumImg = 0;   // number of images
+    t_image_pool    pool;               // jobs
+    pthread_t*      thread;             // threads
+    struct stat     st;                 // image size
+    int             fd;                 // image file
+    int             intRet = EXIT_SUCCESS;
+
+    img = calloc((size_t) argc, sizeof(t_image));
+    if ( NULL == img ) {
+        exit(EXIT_FAILURE);
+    }
+    for ( int i = 1; i < argc; i++ ) {
+        if ( 0 == strncmp(argv[i], "q=", 2) ) {
+            if ( !(uint8NumQ < IMAGE_Q_MAX) || (0 != image_queue(argv[i] + 2, &q[uint8NumQ])) ) {
+                fprintf(stderr, "ERROR:%s: invalid queue '%s'\n", __FUNCTION__, argv[i]);
+                exit(EXIT_FAILURE);
+            }
+            uint8NumQ++;
+        } else if ( 0 == strncmp(argv[i], "j=", 2) ) {
+            uint32Threads = (uint32_t) strtoul(argv[i] + 2, NULL, 0);
+        } else if ( 0 == strncmp(argv[i], "cbs=", 4) ) {
+            uint8NumCbs = (uint8_t) strtoul(argv[i] + 4, NULL, 0);
+        } else {
+            img[uint32NumImg++].chrPtrPath = argv[i];
+        }
+    }
+    if ( (0 == uint8NumQ) || (0 == uint32NumImg) ) {
+        fprintf(stderr, "usage: %s q=<e|p|c|k>,<magic>,<size>,<num>[,<rec>][,crc] ... [j=<threads>] [cbs=<slots>] <image> ...\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    if ( uint8NumCbs < uint8NumQ ) {
+        uint8NumCbs = uint8NumQ;
+    }
+    if ( 0 == uint32Threads ) {
+        uint32Threads = 1;
+    }
+    /* map images, read-only */
+    for ( uint32_t i = 0; i < uint32NumImg; i++ ) {
+        fd = open(img[i].chrPtrPath, O_RDONLY);
+        if ( (0 > fd) || (0 != fstat(fd, &st)) || (0 == st.st_size) ) {
+            fprintf(stderr, "ERROR:%s: %s: can not open\n", __FUNCTION__, img[i].chrPtrPath);
+            exit(EXIT_FAILURE);
+        }
+        img[i].size = (size_t) st.st_size;
+        img[i].uint8PtrMem = mmap(NULL, img[i].size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if ( MAP_FAILED == img[i].uint8PtrMem ) {
+            fprintf(stderr, "ERROR:%s: %s: mmap failed\n", __FUNCTION__, img[i].chrPtrPath);
+            exit(EXIT_FAILURE);
+        }
+    }
+    pool.jobs = calloc((size_t) uint32NumImg * uint8NumQ, sizeof(t_image_job));
+    thread = calloc(uint32Threads, sizeof(pthread_t));
+    if ( (NULL == pool.jobs) || (NULL == thread) ) {
+        exit(EXIT_FAILURE);
+    }
+    /* mount every image once */
+    for ( uint32_t i = 0; i < uint32NumImg; i++ ) {
+        pool.jobs[i].img = &img[i];
+        pool.jobs[i].q = q;
+        pool.jobs[i].uint8NumQ = uint8NumQ;
+        pool.jobs[i].uint8NumCbs = uint8NumCbs;
+    }
+    pool.uint32Num = uint32NumImg;
+    if ( 0 != image_pool(&pool, image_mount, thread, uint32Threads) ) {
+        intRet = EXIT_FAILURE;
+    }
+    /* one job per queue and image, checkpoint queues are not exported */
+    pool.uint32Num = 0;
+    for ( uint32_t i = 0; i < uint32NumImg; i++ ) {
+        for ( uint8_t j = 0; j < uint8NumQ; j++ ) {
+            if ( 'k' == q[j].chrType ) {
+                continue;
+            }
+            pool.jobs[pool.uint32Num].img = &img[i];
+            pool.jobs[pool.uint32Num].q = q;
+            pool.jobs[pool.uint32Num].uint8NumQ = uint8NumQ;
+            pool.jobs[pool.uint32Num].uint8NumCbs = uint8NumCbs;
+            pool.jobs[pool.uint32Num].uint8Cb = j;
+            pool.uint32Num++;
+        }
+    }
+    if ( 0 != image_pool(&pool, image_job, thread, uint32Threads) ) {
+        intRet = EXIT_FAILURE;
+    }
+    for ( uint32_t i = 0; i < uint32NumImg; i++ ) {
+        for ( uint8_t j = 0; j < uint8NumQ; j++ ) {
+            free(img[i].codec[j]);
+        }
+        free(img[i].ckpt);
+        free(img[i].cb);
+        free(img[i].spi);
+        free(img[i].uint8PtrCow);
+        munmap((void*) img[i].uint8PtrMem, img[i].size);
+    }
+    free(thread);
+    free(pool.jobs);
+    free(img);
+    exit(intRet);
+}
@@ -32,6 +32,7 @@
 /** User Libs **/
 #include "spi_flash_model/spi_flash_model.h"    // spi flash model
 #include "spi_flash_cb.h"
+#include "sfcb_flash_types.h"                    // flash instructions, #SFCB_FLASH_IST_WR_PAGE
 
 
 
@@ -40,6 +41,40 @@ const uint32_t  g_uint32SpiFlashCycleOut = 1000;    // abort calling SPI flash
 const uint16_t  g_uint16CbQ0Size = 256 - 2*sizeof(spi_flash_cb_elem_head);      // CB Q0 Payload size
 const uint16_t  g_uint16CbQ1Size = 16384 - 2*sizeof(spi_flash_cb_elem_head);    // CB Q1 Payload size
 uint8_t         g_uint8Spi[266];    // SPI packet buffer
+uint32_t        g_uint32Tick = 0;   // system tick, see test_tick
+
+
+
+/**
+ *  @typedef t_sink_buf
+ *
+ *  @brief  Read sink buffer
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_sink_buf {
+    uint8_t*    uint8PtrBuf;    /**< destination buffer */
+    uint32_t    uint32Len;      /**< received bytes */
+    uint32_t    uint32Chunks;   /**< received chunks */
+} t_sink_buf;
+
+
+
+/**
+ *  @typedef t_iter_log
+ *
+ *  @brief  Element iterator log
+ *
+ *  @since  2026-10-14
+ */
+typedef struct t_iter_log {
+    t_sfm*      flash;          /**< flash model, reference data */
+    t_sfcb_cb*  cb;             /**< iterated queue */
+    uint32_t    uint32IdNext;   /**< expected element id */
+    uint32_t    uint32Elems;    /**< completed elements */
+    uint32_t    uint32Bytes;    /**< received payload bytes */
+    int         intEro;         /**< payload mismatch */
+} t_iter_log;
 
 
 
@@ -167,13 +202,13 @@ static int run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
         /* SFCB Worker */
         sfcb_worker (sfcb);
         /* interact SPI Flash Model */
-        sfm_state = sfm(flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(sfcb));
+        sfm_state = sfm(flash, sfcb_spi_buf(sfcb), sfcb_spi_len(sfcb));
         if ( 0 != sfm_state ) {
             printf("ERROR:%s:spi_flash_model ero=%d\n", __FUNCTION__, sfm_state);
             /* print spi packet */
             printf("SPI Packet: ");
             for ( uint32_t i = 0; i < sfcb_spi_len(sfcb); i++ ) {
-                printf(" %02x", g_uint8Spi[i]);
+                printf(" %02x", sfcb_spi_buf(sfcb)[i]);
             }
             printf("\n");
             return -1;
@@ -189,6 +224,46 @@ static int run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
 
 
 
+/**
+ *  @brief run_sfm_mount
+ *
+ *  initializes a separate flash model and handle, creates element queue 0
+ *  with the given geometry and mounts it. Without elements no queue is
+ *  created and the mount is left to the caller.
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in,out]  cb                  queue list, #t_sfcb_cb
+ *  @param[in]      cbLen               number of queues in cb
+ *  @param[in]      desc                flash descriptor, NULL for compile-time flash
+ *  @param[in]      magic               magic number of queue 0
+ *  @param[in]      elemSize            payload size of queue 0
+ *  @param[in]      numElems            number of elements of queue 0, zero skips queue and mount
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+{
+    /** Variables **/
+    uint8_t     uint8Temp;  // help variable
+
+    if (    (0 != sfm_init(flash, "W25Q16JV"))
+         || (0 != sfcb_init(sfcb, cb, cbLen, g_uint8Spi, sizeof(g_uint8Spi)))
+         || ((NULL != desc) && (0 != sfcb_init_flash(sfcb, desc)))
+         || ((0 != numElems) && (0 != sfcb_new_cb(sfcb, magic, elemSize, numElems, &uint8Temp)))
+         || ((0 != numElems) && (0 != sfcb_mkcb(sfcb)))
+         || ((0 != numElems) && (0 != run_sfm_update(flash, sfcb)))
+    ) {
+        printf("ERROR:%s: init, magic=0x%x\n", __FUNCTION__, magic);
+        return -1;
+    }
+    return 0;
+}
+
+
+
 /**
  *  @brief run_sfcb_add
  *
@@ -507,178 +582,3121 @@ static int test_add_append (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t q
 
 
 /**
- *  Main
- *  ----
+ *  @brief test_init_flash
+ *
+ *  assigns runtime flash descriptors, compile-time flash is accepted,
+ *  a different flash only with SFCB_FLASH_RT_EN, flash size of assigned descriptor
+ *
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
  */
-int main ()
+static int test_init_flash (t_sfcb* sfcb)
 {
     /** Variables **/
-    t_sfm           spiFlash;                           // SPI flash model
-    t_sfcb          sfcb;                               // SPI Flash as circular buffer
-    t_sfcb_cb       sfcb_cb[5];                         // five logical parts in SPI Flash
-    uint8_t         uint8Temp;                          // help variable
-    uint8_t         uint8FlashData[] = {0,1,2,3,4,5};   // SPI test data
-    uint8_t         uint8Buf[1024];                     // help buffer
-
+    static const t_sfcb_flash   flashDef = SFCB_FLASH_DESC; // compile-time selected flash, valid for handle lifetime
+    t_sfcb_flash                flashOther;                 // flash with other timing
+    t_sfcb_flash                flashBroken;                // invalid topology
+    t_sfcb_flash                flashBlk;                   // block not multiple of sector
 
     /* entry message */
-    printf("INFO:%s: unit test started\n", __FUNCTION__);
-
-
-    /* init flash model */
-    printf("INFO:%s: Init Flash model W25Q16JV\n", __FUNCTION__);
-    if ( 0 != sfm_init( &spiFlash, "W25Q16JV" ) ) {
-        printf("ERROR:%s:sfm_init\n", __FUNCTION__);
-        goto ERO_END;
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    memcpy(&flashOther, &flashDef, sizeof(flashOther));
+    flashOther.charName = "other";
+    flashOther.uint32TimePageProg = 2 * flashDef.uint32TimePageProg + 1;
+    flashOther.uint32FlashSize = 2 * flashDef.uint32FlashSize;
+    memcpy(&flashBroken, &flashDef, sizeof(flashBroken));
+    flashBroken.uint16PageSize = 0;
+    memcpy(&flashBlk, &flashDef, sizeof(flashBlk));
+    flashBlk.uint8IstEraseBlk32 = 0x52;
+    flashBlk.uint32Blk32Size = flashDef.uint32SectorSize + 1;
+    /* invalid descriptors */
+    if (    (SFCB_E_NO_FLASH != sfcb_init_flash(sfcb, NULL))
+         || (SFCB_E_NO_FLASH != sfcb_init_flash(sfcb, &flashBroken))
+         || (SFCB_E_NO_FLASH != sfcb_init_flash(sfcb, &flashBlk))
+    ) {
+        printf("ERROR:%s: invalid descriptor accepted\n", __FUNCTION__);
+        return -1;
     }
-
-
-    /* sfcb_init */
-    printf("INFO:%s:sfcb_init\n", __FUNCTION__);
-    printf("INFO:%s:uint8Spi_p      = %p\n",        __FUNCTION__, &g_uint8Spi);
-    printf("INFO:%s:sfcb_p          = %p\n",        __FUNCTION__, &sfcb);
-    printf("INFO:%s:sfcb_cb_p       = %p\n",        __FUNCTION__, &sfcb_cb);
-    printf("INFO:%s:sfcb_size       = %d byte\n",   __FUNCTION__, (int) sizeof(sfcb));
-    printf("INFO:%s:sfcb_cb[0]_size = %d byte\n",   __FUNCTION__, (int) sizeof(sfcb_cb[0]));
-    memset(sfcb_cb, 0xaf, sizeof(sfcb_cb)); // mess-up memory to check init
-    /* int sfcb_init (t_sfcb *self, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen) */
-    sfcb_init (&sfcb, &sfcb_cb, sizeof(sfcb_cb)/sizeof(sfcb_cb[0]), &g_uint8Spi, sizeof(g_uint8Spi)/sizeof(g_uint8Spi[0]));
-    /* check for error */
-    for ( uint8_t i = 0; i < sizeof(sfcb_cb)/sizeof(sfcb_cb[0]); i++ ) {
-        /* check flags */
-        if ( 0 != (sfcb_cb[i]).uint8Used ) {
-            printf("ERROR:%s:sfcb_init:uint8Used", __FUNCTION__);
-            goto ERO_END;
-        }
-        if ( 0 != (sfcb_cb[i]).uint8MgmtValid) {
-            printf("ERROR:%s:sfcb_init:uint8MgmtValid", __FUNCTION__);
-            goto ERO_END;
-        }
+    /* other flash */
+#ifdef SFCB_FLASH_RT_EN
+    if ( (0 != sfcb_init_flash(sfcb, &flashOther)) || (flashOther.uint32FlashSize != sfcb_flash_size(sfcb)) ) {
+#else
+    if ( (SFCB_E_NO_FLASH != sfcb_init_flash(sfcb, &flashOther)) || (flashDef.uint32FlashSize != sfcb_flash_size(sfcb)) ) {
+#endif
+        printf("ERROR:%s: flash '%s'\n", __FUNCTION__, flashOther.charName);
+        return -1;
     }
-    //print_raw_sfcb_cb(&sfcb_cb, sizeof(sfcb_cb)/sizeof(sfcb_cb[0]));  // raw dump
-
+    /* back to compile-time flash */
+    if ( (0 != sfcb_init_flash(sfcb, &flashDef)) || (flashDef.uint32FlashSize != sfcb_flash_size(sfcb)) ) {
+        printf("ERROR:%s: compile-time flash rejected\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
 
-    /* sfcb_new_cb
-     *   adds two new circular buffers to the SPI Flash
-    */
-    printf("INFO:%s:sfcb_new_cb\n", __FUNCTION__);
-    sfcb_new_cb (&sfcb, 0x47114711, g_uint16CbQ0Size, 32, &uint8Temp);  // start-up counter with operation
-    sfcb_new_cb (&sfcb, 0x08150815, g_uint16CbQ1Size, 16, &uint8Temp);  // error data collection 12KiB
-    print_raw_sfcb_cb(&sfcb_cb, sizeof(sfcb_cb)/sizeof(sfcb_cb[0]));    // raw dump of handling indo
 
+/**
+ *  @brief test_new_cb_large
+ *
+ *  queue with more than 65535 elements, requires flash larger than 16MB
+ *
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_new_cb_large (void)
+{
+    /** Variables **/
+    t_sfcb                  sfcb;                       // separate handle, no flash access
+    t_sfcb_cb               cb[1];                      // one queue
+    const uint32_t          uint32NumElems = 100000;    // exceeds 16bit counter
+    uint8_t                 uint8Temp;                  // help variable
+#ifdef SFCB_FLASH_RT_EN
+    static t_sfcb_flash     flash4b = SFCB_FLASH_DESC;  // 32MB flash, 4-byte address
+#endif
 
-    /* sfcb_mkcb
-     *   access spi flash and build circular buffers
-     */
-    printf("INFO:%s:sfcb_mkcb\n", __FUNCTION__);
-    if ( 0 != sfcb_mkcb(&sfcb) ) {
-        printf("ERROR:%s:sfcb_mkcb failed to start", __FUNCTION__);
-        goto ERO_END;
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( 0 != sfcb_init(&sfcb, cb, 1, g_uint8Spi, sizeof(g_uint8Spi)) ) {
+        printf("ERROR:%s:sfcb_init\n", __FUNCTION__);
+        return -1;
     }
-        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
-    if ( 0 != run_sfm_update(&spiFlash, &sfcb) ) {
-        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
-        goto ERO_END;
+#ifdef SFCB_FLASH_RT_EN
+    flash4b.uint8AdrByte = 4;
+    flash4b.uint32FlashSize = 33554432;
+    if ( 0 != sfcb_init_flash(&sfcb, &flash4b) ) {
+        printf("ERROR:%s:sfcb_init_flash\n", __FUNCTION__);
+        return -1;
     }
-    sfm_dump( &spiFlash, 0, 256 );  // dump SPI flash content
-
-
-
-    ////////////////////////////////////////////
-    //
-    //  Single Pages Payloads
-    //
-    ////////////////////////////////////////////
-
-    /* SFCB add, queue 0 */
-    for ( uint8_t i = 0; i < 63; i++ ) {
-        printf("INFO:%s:sfcb_add:i=%d:add\n", __FUNCTION__, i);
-        /* add element */
-            // run_sfcb_add (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint8_t* data, uint16_t len)
-        if ( 0 != run_sfcb_add(&spiFlash, &sfcb, 0, (uint8_t*) &uint8FlashData, sizeof(uint8FlashData)/sizeof(uint8FlashData[0])) ) {
-            printf("ERROR:%s:run_sfcb_add failed", __FUNCTION__);
+#endif
+    /* queue fits only in flashes above 16MB */
+    if ( (uint64_t) uint32NumElems * 256 > (uint64_t) sfcb.ptrFlash->uint32FlashSize ) {
+        if ( SFCB_E_FLASH_FULL != sfcb_new_cb(&sfcb, 0x47114711, g_uint16CbQ0Size, uint32NumElems, &uint8Temp) ) {
+            printf("ERROR:%s:sfcb_new_cb: flash size exceeded not detected\n", __FUNCTION__);
             return -1;
         }
+        return 0;
     }
-    if ( 0 != sfm_cmp(&spiFlash, "./test/sfcb_flash_q0_i63.dif") ) {
-        printf("ERROR:%s:sfm_cmp:q0 Mismatch\n", __FUNCTION__);
-        goto ERO_END;
+    if ( 0 != sfcb_new_cb(&sfcb, 0x47114711, g_uint16CbQ0Size, uint32NumElems, &uint8Temp) ) {
+        printf("ERROR:%s:sfcb_new_cb\n", __FUNCTION__);
+        return -1;
     }
-    /* check highest id */
-    if ( 63 != sfcb_idmax(&sfcb, 0) ) {
-        printf("ERROR:%s:sfcb_idmax:q0 exp,idmax=63, is,idmax=%d\n", __FUNCTION__, sfcb_idmax(&sfcb, 0));
-        goto ERO_END;
+    printf("INFO:%s: entries max=%u, stop sector=%u\n", __FUNCTION__, cb[0].uint32NumEntriesMax, cb[0].uint32StopSector);
+    if ( (cb[0].uint32NumEntriesMax < uint32NumElems) || ((cb[0].uint32StopSector + 1) * 4096 <= 0x1000000) ) {
+        printf("ERROR:%s: queue size\n", __FUNCTION__);
+        return -1;
     }
+    /* all done */
+    return 0;
+}
 
 
-    /* sfcb_flash_read
-     *   reads raw binary data from flash
-     */
-    printf("INFO:%s:sfcb_flash_read\n", __FUNCTION__);
-        // int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint16_t len)
-    if ( 0 != sfcb_flash_read (&sfcb, 0, &uint8Buf, 256) ) {
-        printf("ERROR:%s:sfcb_flash_read failed to start", __FUNCTION__);
-        goto ERO_END;
-    }
-        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
-    if ( 0 != run_sfm_update(&spiFlash, &sfcb) ) {
-        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
-        goto ERO_END;
-    }
-    /* compare data */
-    for ( uint32_t i = 0; i < 256; i++ ) {
-        if ( spiFlash.uint8PtrMem[i] != uint8Buf[i] ) {
-            printf("ERROR:%s:sfcb_flash_read: byte=%d, exp=0x%02x, is=0x%02x\n", __FUNCTION__, i, spiFlash.uint8PtrMem[i], uint8Buf[i]);
-            goto ERO_END;
-        }
-    }
-
 
-    /* sfcb_get_last
-     *   reads last written element back
-     */
-    printf("INFO:%s:sfcb_get_last:q0: payload size = %d bytes\n", __FUNCTION__, g_uint16CbQ0Size);
-        // static int test_get_last (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
-    if ( 0 != test_get_last(&spiFlash, &sfcb, 0, g_uint16CbQ0Size) ) {
-        goto ERO_END;
-    }
 
+/**
+ *  @brief test_flash_read
+ *
+ *  reads flash region larger than the SPI buffer and compares with flash model
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      adr                 start address
+ *  @param[in]      len                 number of bytes
+ *  @param[in]      chunk               read chunk size, zero for SPI buffer size
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_flash_read (t_sfm* flash, t_sfcb* sfcb, uint32_t adr, uint32_t len, uint16_t chunk)
+{
+    /** Variables **/
+    uint8_t*    uint8PtrBuf = NULL;     // read buffer
 
-    /* sfcb_add_append
-     *   write to SPI flash in portions of bytes
-     */
-    printf("INFO:%s:sfcb_add_append:q0: payload size = %d bytes\n", __FUNCTION__, g_uint16CbQ0Size);
-        // static int test_add_append (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
-    if ( 0 != test_add_append(&spiFlash, &sfcb, 0, g_uint16CbQ0Size) ) {
-        goto ERO_END;
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    uint8PtrBuf = malloc(len);
+    if ( NULL == uint8PtrBuf ) {
+        printf("ERROR:%s: malloc fail", __FUNCTION__);
+        return -1;
     }
-
-
-    ////////////////////////////////////////////
-    //
-    //  Multiple Pages Payloads
-    //
-    ////////////////////////////////////////////
-
-    /* sfcb_get_last
-     *   reads last written element back
-     */
-    printf("INFO:%s:sfcb_get_last:q1: payload size = %d bytes\n", __FUNCTION__, g_uint16CbQ1Size);
-        // static int test_get_last (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
-    if ( 0 != test_get_last(&spiFlash, &sfcb, 1, g_uint16CbQ1Size) ) {
-        goto ERO_END;
+    if ( (0 != sfcb_read_chunk(sfcb, chunk)) || (SFCB_E_MEM != sfcb_read_chunk(sfcb, sfcb->uint16SpiMax)) ) {
+        printf("ERROR:%s:sfcb_read_chunk\n", __FUNCTION__);
+        return -1;
     }
+    if ( (0 != sfcb_flash_read(sfcb, adr, uint8PtrBuf, len)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_flash_read\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(flash->uint8PtrMem + adr, uint8PtrBuf, len) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    sfcb_read_chunk(sfcb, 0);
+    /* all done */
+    free(uint8PtrBuf);
+    return 0;
+}
 
 
+/**
+ *  @brief run_sfm_xfer
+ *
+ *  runs worker until idle, packets with dual/quad instruction are
+ *  converted to single lane instruction for the flash model
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[out]     lanes               maximal number of data lanes
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int run_sfm_xfer (t_sfm* flash, t_sfcb* sfcb, uint8_t* lanes)
+{
+    /** Variables **/
+    uint8_t             uint8Pkt[sizeof(g_uint8Spi)];   // single lane packet
+    const t_sfcb_xfer*  xfer;                           // transfer mode of packet
+    uint32_t            uint32Counter = 0;              // counter for time out
+    uint16_t            uint16Len;                      // packet length
+    uint8_t             uint8Adr;                       // address and dummy bytes
 
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    *lanes = 0;
+    while ( (0 != sfcb_busy(sfcb)) && ((uint32Counter++) < g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(sfcb);
+        xfer = sfcb_spi_xfer(sfcb);
+        uint16Len = sfcb_spi_len(sfcb);
+        if ( xfer->uint8DataLanes > *lanes ) {
+            *lanes = xfer->uint8DataLanes;
+        }
+        /* convert to single lane */
+        memcpy(uint8Pkt, g_uint8Spi, uint16Len);
+        uint8Adr = (uint8_t) (SFCB_FLASH_TOPO_ADR_BYTE + xfer->uint8Dummy);
+        if ( 0 != uint16Len ) {
+            if ( SFCB_FLASH_IST_WR_PAGE_QUAD == g_uint8Spi[0] ) {
+                uint8Pkt[0] = SFCB_FLASH_IST_WR_PAGE;
+            } else if ( 0 != xfer->uint8Dummy ) {
+                uint8Pkt[0] = SFCB_FLASH_IST_RD_DATA;
+                memcpy(uint8Pkt + 1 + SFCB_FLASH_TOPO_ADR_BYTE, g_uint8Spi + 1 + uint8Adr, (size_t) (uint16Len - 1 - uint8Adr));
+                uint16Len = (uint16_t) (uint16Len - xfer->uint8Dummy);
+            }
+        }
+        if ( 0 != sfm(flash, uint8Pkt, uint16Len) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+        /* read data back to packet */
+        if ( (0 != uint16Len) && (0 != xfer->uint8Dummy) ) {
+            memcpy(g_uint8Spi + 1 + uint8Adr, uint8Pkt + 1 + SFCB_FLASH_TOPO_ADR_BYTE, (size_t) (uint16Len - 1 - SFCB_FLASH_TOPO_ADR_BYTE));
+        } else {
+            memcpy(g_uint8Spi, uint8Pkt, uint16Len);
+        }
+    }
+    if ( 0 != sfcb_busy(sfcb) ) {
+        printf("ERROR:%s: time out\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
 
 
 
-    ////////////////////////////////////////////
-    //
-    //  Minor Stuff at End
-    //
-    ////////////////////////////////////////////
+/**
+ *  @brief test_xfer
+ *
+ *  quad i/o read and quad page program, writes element and reads it back
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_xfer (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+{
+    /** Variables **/
+    uint8_t     uint8Data[100];         // written data
+    uint8_t     uint8Buf[1024];         // read buffer
+    uint8_t     uint8Lanes;             // used data lanes
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( SFCB_E_NO_FLASH != sfcb_xfer_cfg(sfcb, (t_sfcb_rdmode) 99, 0) ) {
+        printf("ERROR:%s:sfcb_xfer_cfg unknown mode accepted\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != sfcb_xfer_cfg(sfcb, SFCB_RD_QUAD_IO, 1) ) {
+        printf("ERROR:%s:sfcb_xfer_cfg\n", __FUNCTION__);
+        return -1;
+    }
+    /* read with dummy cycles */
+    if ( 0 != sfcb_flash_read(sfcb, 17, uint8Buf, sizeof(uint8Buf)) ) {
+        printf("ERROR:%s:sfcb_flash_read\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (0 != run_sfm_xfer(flash, sfcb, &uint8Lanes)) || (4 != uint8Lanes) ) {
+        printf("ERROR:%s:sfcb_flash_read: lanes=%d\n", __FUNCTION__, uint8Lanes);
+        return -1;
+    }
+    if ( 0 != memcmp(flash->uint8PtrMem + 17, uint8Buf, sizeof(uint8Buf)) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* quad page program */
+    for ( uint8_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (0x5a ^ i);
+    }
+    if ( (0 != sfcb_add(sfcb, qNum, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_xfer(flash, sfcb, &uint8Lanes)) ) {
+        printf("ERROR:%s:sfcb_add\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (0 != sfcb_add_done(sfcb, qNum)) || (0 != run_sfm_xfer(flash, sfcb, &uint8Lanes)) || (4 != uint8Lanes) ) {
+        printf("ERROR:%s:sfcb_add_done: lanes=%d\n", __FUNCTION__, uint8Lanes);
+        return -1;
+    }
+    memset(uint8Buf, 0, sizeof(uint8Data));
+    if ( (0 != sfcb_get_last(sfcb, qNum, uint8Buf, sizeof(uint8Data))) || (0 != run_sfm_xfer(flash, sfcb, &uint8Lanes)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data, uint8Buf, sizeof(uint8Data)) ) {
+        printf("ERROR:%s: element mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* restore */
+    if ( (0 != sfcb_xfer_cfg(sfcb, SFCB_RD_SINGLE, 0)) || (1 != sfcb_spi_xfer(sfcb)->uint8DataLanes) ) {
+        printf("ERROR:%s:sfcb_xfer_cfg restore\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+
+/**
+ *  @brief test_mkcb_rebuild
+ *
+ *  invalidates management data of selected queue and rebuilds it from flash,
+ *  optional with corrupted element header to force linear scan fallback
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @param[in]      eroAdr              flash address with corrupted byte, zero disables
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+{
+    /** Variables **/
+    t_sfcb_cb   cbExp;      // expected management data
+    t_sfcb_cb*  cbIs;       // rebuild management data
+    uint8_t     uint8Bak;   // backup of corrupted flash byte
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* save and invalidate management data */
+    cbIs = &(sfcb->ptrCbs[qNum]);
+    memcpy(&cbExp, cbIs, sizeof(cbExp));
+    cbIs->uint8MgmtValid = 0;
+    /* corrupt free element header */
+    uint8Bak = flash->uint8PtrMem[eroAdr];
+    if ( 0 != eroAdr ) {
+        flash->uint8PtrMem[eroAdr] = 0x5a;
+    }
+    /* rebuild */
+    if ( 0 != sfcb_mkcb(sfcb) ) {
+        printf("ERROR:%s:sfcb_mkcb failed to start", __FUNCTION__);
+        return -1;
+    }
+        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    flash->uint8PtrMem[eroAdr] = uint8Bak;
+    /* compare */
+    if (    (0 == cbIs->uint8MgmtValid)
+         || (cbExp.uint32IdNumMax != cbIs->uint32IdNumMax)
+         || (cbExp.uint32IdNumMin != cbIs->uint32IdNumMin)
+         || (cbExp.uint32StartPageWrite != cbIs->uint32StartPageWrite)
+         || (cbExp.uint32StartPageIdMax != cbIs->uint32StartPageIdMax)
+         || (cbExp.uint32StartPageIdMin != cbIs->uint32StartPageIdMin)
+    ) {
+        printf("ERROR:%s:q%d: mismatch, idmax exp=%d is=%d, idmin exp=%d is=%d, wrpage exp=0x%x is=0x%x\n", __FUNCTION__, qNum, cbExp.uint32IdNumMax, cbIs->uint32IdNumMax, cbExp.uint32IdNumMin, cbIs->uint32IdNumMin, cbExp.uint32StartPageWrite, cbIs->uint32StartPageWrite);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_add_merge
+ *
+ *  writes complete element into one page queue, header, payload and footer
+ *  needs to be merged into a single page program
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @param[in]      qSize               size of queue payload in bytes
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_add_merge (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+{
+    /** Variables **/
+    uint8_t     uint8Data[256];         // written data
+    uint8_t     uint8Buf[256];          // read buffer
+    uint32_t    uint32Prog = 0;         // number of page programs
+    uint32_t    uint32Counter = 0;      // counter for time out
+    uint32_t    uint32IdMax;            // id of newest element before add
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( qSize > sizeof(uint8Data) ) {
+        printf("ERROR:%s: queue payload to large\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint16_t i = 0; i < qSize; i++ ) {
+        uint8Data[i] = (uint8_t) (0x5a ^ i);
+    }
+    uint32IdMax = sfcb_idmax(sfcb, qNum);
+    if ( 0 != sfcb_add(sfcb, qNum, uint8Data, qSize) ) {
+        printf("ERROR:%s:sfcb_add failed to start", __FUNCTION__);
+        return -1;
+    }
+    while ( (0 != sfcb_busy(sfcb)) && ((uint32Counter++) < g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(sfcb);
+        if ( (0 != sfcb_spi_len(sfcb)) && (SFCB_FLASH_IST_WR_PAGE == g_uint8Spi[0]) ) {
+            uint32Prog++;
+        }
+        if ( 0 != sfm(flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(sfcb)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    printf("INFO:%s: page programs=%d\n", __FUNCTION__, uint32Prog);
+    if ( 1 != uint32Prog ) {
+        printf("ERROR:%s: header, payload and footer not merged\n", __FUNCTION__);
+        return -1;
+    }
+    /* footer already written */
+    if ( (0 != sfcb_add_done(sfcb, qNum)) || (0 != sfcb_busy(sfcb)) ) {
+        printf("ERROR:%s:sfcb_add_done\n", __FUNCTION__);
+        return -1;
+    }
+    /* management data updated without rebuild */
+    if ( (0 == sfcb->ptrCbs[qNum].uint8MgmtValid) || (uint32IdMax + 1 != sfcb_idmax(sfcb, qNum)) ) {
+        printf("ERROR:%s: management data not updated\n", __FUNCTION__);
+        return -1;
+    }
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    if ( 0 != test_mkcb_rebuild(flash, sfcb, qNum, 0) ) {
+        return -1;
+    }
+    /* read back */
+    if ( (0 != sfcb_get_last(sfcb, qNum, uint8Buf, qSize)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data, uint8Buf, qSize) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_add_batch
+ *
+ *  appends more records than free elements in one job, checks erase ahead,
+ *  management data in RAM against rebuild and last record
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @param[in]      qSize               size of record in bytes
+ *  @param[in]      num                 number of records
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_add_batch (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize, uint16_t num)
+{
+    /** Variables **/
+    uint8_t     uint8Data[4096];        // written records
+    uint8_t     uint8Buf[256];          // read buffer
+    uint32_t    uint32IdMax;            // id of last element before batch
+    uint32_t    uint32Erase = 0;        // number of sector erases
+    uint32_t    uint32Counter = 0;      // counter for time out
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( ((uint32_t) qSize * num > sizeof(uint8Data)) || (qSize > sizeof(uint8Buf)) ) {
+        printf("ERROR:%s: records to large\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint32_t i = 0; i < (uint32_t) qSize * num; i++ ) {
+        uint8Data[i] = (uint8_t) (i / qSize + i);
+    }
+    uint32IdMax = sfcb_idmax(sfcb, qNum);
+    /* append */
+    if ( 0 != sfcb_add_batch(sfcb, qNum, uint8Data, qSize, num) ) {
+        printf("ERROR:%s:sfcb_add_batch failed to start", __FUNCTION__);
+        return -1;
+    }
+    while ( (0 != sfcb_busy(sfcb)) && ((uint32Counter++) < g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(sfcb);
+        if ( (0 != sfcb_spi_len(sfcb)) && (SFCB_FLASH_IST_ERASE_SECTOR == g_uint8Spi[0]) ) {
+            uint32Erase++;
+        }
+        if ( 0 != sfm(flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(sfcb)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    printf("INFO:%s: sector erases=%d\n", __FUNCTION__, uint32Erase);
+    if ( (0 != sfcb_busy(sfcb)) || (0 != sfcb_isero(sfcb)) ) {
+        printf("ERROR:%s:sfcb_add_batch\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (uint32IdMax + num != sfcb_idmax(sfcb, qNum)) || (0 == uint32Erase) ) {
+        printf("ERROR:%s: idmax=%d, no erase ahead\n", __FUNCTION__, sfcb_idmax(sfcb, qNum));
+        return -1;
+    }
+    /* management data in RAM equal to rebuild from flash */
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    if ( 0 != test_mkcb_rebuild(flash, sfcb, qNum, 0) ) {
+        return -1;
+    }
+    /* last record */
+    if ( (0 != sfcb_get_last(sfcb, qNum, uint8Buf, qSize)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data + (uint32_t) qSize * (num - 1u), uint8Buf, qSize) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief run_sfm_blk
+ *
+ *  runs worker until idle, block erases are executed as sector erases
+ *  by the flash model
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[out]     blk                 number of block erases
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int run_sfm_blk (t_sfm* flash, t_sfcb* sfcb, uint32_t* blk)
+{
+    /** Variables **/
+    uint8_t     uint8Pkt[8];                // sector erase packets
+    uint32_t    uint32Counter = 0;          // counter for time out
+    uint32_t    uint32Adr;                  // block address
+    uint32_t    uint32Size;                 // block size
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    *blk = 0;
+    while ( (0 != sfcb_busy(sfcb)) && ((uint32Counter++) < 100*g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(sfcb);
+        /* block erase, split into sector erases */
+        if ( (0 != sfcb_spi_len(sfcb)) && ((SFCB_FLASH_IST_ERASE_BLK32 == g_uint8Spi[0]) || (SFCB_FLASH_IST_ERASE_BLK64 == g_uint8Spi[0])) ) {
+            (*blk)++;
+            uint32Size = (SFCB_FLASH_IST_ERASE_BLK64 == g_uint8Spi[0]) ? SFCB_FLASH_TOPO_BLK64_SIZE : SFCB_FLASH_TOPO_BLK32_SIZE;
+            uint32Adr = 0;
+            for ( uint8_t i = 0; i < SFCB_FLASH_TOPO_ADR_BYTE; i++ ) {
+                uint32Adr = (uint32Adr << 8) | g_uint8Spi[1+i];
+            }
+            printf("INFO:%s: block erase adr=0x%x, size=0x%x\n", __FUNCTION__, uint32Adr, uint32Size);
+            for ( uint32_t uint32Sec = uint32Adr; uint32Sec < uint32Adr + uint32Size; uint32Sec += SFCB_FLASH_TOPO_SECTOR_SIZE ) {
+                if ( uint32Sec != uint32Adr ) {     // write enable of first erase issued by worker
+                    uint8Pkt[0] = SFCB_FLASH_IST_WR_ENA;
+                    (void) sfm(flash, uint8Pkt, 1);
+                }
+                uint8Pkt[0] = SFCB_FLASH_IST_ERASE_SECTOR;
+                for ( uint8_t i = 0; i < SFCB_FLASH_TOPO_ADR_BYTE; i++ ) {
+                    uint8Pkt[SFCB_FLASH_TOPO_ADR_BYTE - i] = (uint8_t) (uint32Sec >> (8*i));
+                }
+                if ( 0 != sfm(flash, uint8Pkt, SFCB_FLASH_TOPO_ADR_BYTE + 1) ) {
+                    printf("ERROR:%s:spi_flash_model: sector erase\n", __FUNCTION__);
+                    return -1;
+                }
+                /* wait for sector erase */
+                do {
+                    uint8Pkt[0] = SFCB_FLASH_IST_RD_STATE_REG;
+                    uint8Pkt[1] = 0;
+                    (void) sfm(flash, uint8Pkt, 2);
+                } while ( 0 != (uint8Pkt[1] & SFCB_FLASH_MNG_WIP_MSK) );
+            }
+            continue;
+        }
+        if ( 0 != sfm(flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(sfcb)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    if ( 0 != sfcb_busy(sfcb) ) {
+        printf("ERROR:%s: time out\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_erase_blk
+ *
+ *  queue of several 64KB blocks with high pre-erase watermark, records wrap
+ *  the queue and reclaim a span of sectors, which is erased by block erases
+ *
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_erase_blk (void)
+{
+    /** Variables **/
+    t_sfm               flash;                      // separate flash
+    t_sfcb              sfcb;                       // separate handle
+    t_sfcb_cb           cb[1];                      // one queue
+    static uint8_t      uint8Data[620*8];           // written records
+    uint8_t             uint8Buf[8];                // read buffer
+    const uint16_t      uint16Num = sizeof(uint8Data) / sizeof(uint8Buf);
+    uint32_t            uint32Blk;                  // number of block erases
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( 0 == SFCB_FLASH_IST_ERASE_BLK64 ) {
+        return 0;   // flash without block erase
+    }
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( (0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0x5a5a0001, sizeof(uint8Buf), 600)) || (0 != sfcb_pre_erase(&sfcb, 0, 300)) ) {
+        return -1;
+    }
+    for ( uint32_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (i / sizeof(uint8Buf) + i);
+    }
+    /* wraps queue, erase ahead of oldest elements until watermark */
+    if ( 0 != sfcb_add_batch(&sfcb, 0, uint8Data, sizeof(uint8Buf), uint16Num) ) {
+        printf("ERROR:%s:sfcb_add_batch failed to start", __FUNCTION__);
+        return -1;
+    }
+        // run_sfm_blk (t_sfm* flash, t_sfcb* sfcb, uint32_t* blk)
+    if ( (0 != run_sfm_blk(&flash, &sfcb, &uint32Blk)) || (0 != sfcb_isero(&sfcb)) ) {
+        return -1;
+    }
+    printf("INFO:%s: block erases=%d, entries=%d/%d\n", __FUNCTION__, uint32Blk, cb[0].uint32NumEntries, cb[0].uint32NumEntriesMax);
+    if ( (0 == uint32Blk) || (uint16Num != sfcb_idmax(&sfcb, 0)) ) {
+        printf("ERROR:%s: no block erase, idmax=%d\n", __FUNCTION__, sfcb_idmax(&sfcb, 0));
+        return -1;
+    }
+    /* last record */
+    if ( (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data + sizeof(uint8Data) - sizeof(uint8Buf), uint8Buf, sizeof(uint8Buf)) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* management data in RAM equal to rebuild from flash */
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    return test_mkcb_rebuild(&flash, &sfcb, 0, 0);
+}
+
+
+
+#ifdef SFCB_FLASH_RT_EN
+/**
+ *  @brief test_flash_geo
+ *
+ *  mounts a runtime flash with 64KB sectors and 256 pages per sector, the
+ *  sector erase is issued as 64KB block erase. Records wrap the queue and
+ *  reclaim whole 64KB sectors.
+ *
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_flash_geo (void)
+{
+    /** Variables **/
+    static t_sfcb_flash flashGeo = SFCB_FLASH_DESC;     // 64KB sector flash, valid for handle lifetime
+    t_sfm               flash;                          // separate flash
+    t_sfcb              sfcb;                           // separate handle
+    t_sfcb_cb           cb[1];                          // one queue
+    static uint8_t      uint8Data[1000*8];              // written records
+    uint8_t             uint8Buf[8];                    // read buffer
+    const uint16_t      uint16Num = sizeof(uint8Data) / sizeof(uint8Buf);
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( 0 == SFCB_FLASH_IST_ERASE_BLK64 ) {
+        return 0;   // flash without 64KB erase
+    }
+    flashGeo.charName = "64KB sector";
+    flashGeo.uint8IstEraseSector = SFCB_FLASH_IST_ERASE_BLK64;
+    flashGeo.uint8IstEraseBlk32 = 0;
+    flashGeo.uint8IstEraseBlk64 = 0;
+    flashGeo.uint32SectorSize = SFCB_FLASH_TOPO_BLK64_SIZE;
+    flashGeo.uint32TimeEraseSector = SFCB_FLASH_TIME_ERASE_BLK64;
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, &flashGeo, 0x5a5a0003, sizeof(uint8Buf), 600) ) {
+        return -1;
+    }
+    /* one page elements, queue of whole 64KB sectors */
+    printf("INFO:%s: pages/elem=%u, entries max=%u, stop sector=%u\n", __FUNCTION__, cb[0].uint32NumPagesPerElem, cb[0].uint32NumEntriesMax, cb[0].uint32StopSector);
+    if ( (1 != cb[0].uint32NumPagesPerElem) || (0 != (cb[0].uint32NumEntriesMax % 256)) || (cb[0].uint32NumEntriesMax < 600) ) {
+        printf("ERROR:%s: queue geometry\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint32_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (i / sizeof(uint8Buf) + 3*i);
+    }
+    /* wraps queue, frees oldest 64KB sector */
+    if ( 0 != sfcb_add_batch(&sfcb, 0, uint8Data, sizeof(uint8Buf), uint16Num) ) {
+        printf("ERROR:%s:sfcb_add_batch failed to start\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint8_t i = 0; (i < 100) && (0 != sfcb_busy(&sfcb)); i++ ) {  // one cycle budget per update
+        if ( 0 != run_sfm_update(&flash, &sfcb) ) {
+            return -1;
+        }
+    }
+    if ( (0 != sfcb_busy(&sfcb)) || (0 != sfcb_isero(&sfcb)) ) {
+        printf("ERROR:%s:sfcb_add_batch\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (uint16Num != sfcb_idmax(&sfcb, 0)) || (cb[0].uint32NumEntries >= uint16Num) ) {
+        printf("ERROR:%s: queue not wrapped, idmax=%d, entries=%d\n", __FUNCTION__, sfcb_idmax(&sfcb, 0), cb[0].uint32NumEntries);
+        return -1;
+    }
+    /* last record */
+    if ( (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data + sizeof(uint8Data) - sizeof(uint8Buf), uint8Buf, sizeof(uint8Buf)) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* management data in RAM equal to rebuild from flash */
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    return test_mkcb_rebuild(&flash, &sfcb, 0, 0);
+}
+#endif
+
+
+
+/**
+ *  @brief test_image_full
+ *
+ *  fills every slot of a queue and cuts the power before the erase ahead,
+ *  no free element is left for the next mount. The flash is stored as raw
+ *  image for the image decoder.
+ *
+ *  @param[in]      path                file name of raw image
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_image_full (const char* path)
+{
+    /** Variables **/
+    t_sfm               flash;                      // separate flash
+    t_sfcb              sfcb;                       // separate handle
+    t_sfcb_cb           cb[1];                      // one queue
+    static uint8_t      uint8Data[240*32];          // written records
+    FILE*               fp;                         // raw image
+    uint32_t            uint32Counter = 0;          // counter for time out
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0x5a5a0004, 240, 16) ) {
+        return -1;
+    }
+    if ( cb[0].uint32NumEntriesMax > sizeof(uint8Data) / 240 ) {
+        printf("ERROR:%s: queue exceeds data, entries max=%u\n", __FUNCTION__, cb[0].uint32NumEntriesMax);
+        return -1;
+    }
+    for ( uint32_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (i / 240 + 5*i);
+    }
+    /* every slot written, power lost with erase ahead of oldest sector */
+    if ( 0 != sfcb_add_batch(&sfcb, 0, uint8Data, 240, (uint16_t) cb[0].uint32NumEntriesMax) ) {
+        printf("ERROR:%s:sfcb_add_batch failed to start\n", __FUNCTION__);
+        return -1;
+    }
+    while ( (0 != sfcb_busy(&sfcb)) && ((uint32Counter++) < 100*g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(&sfcb);
+        if ( (0 != sfcb_spi_len(&sfcb)) && (SFCB_FLASH_IST_ERASE_SECTOR == g_uint8Spi[0]) ) {
+            break;
+        }
+        if ( 0 != sfm(&flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(&sfcb)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    printf("INFO:%s: idmax=%u, entries max=%u\n", __FUNCTION__, sfcb_idmax(&sfcb, 0), cb[0].uint32NumEntriesMax);
+    if ( (0 == sfcb_busy(&sfcb)) || (cb[0].uint32NumEntriesMax != sfcb_idmax(&sfcb, 0)) ) {
+        printf("ERROR:%s: no erase ahead after last slot\n", __FUNCTION__);
+        return -1;
+    }
+    /* raw image */
+    fp = fopen(path, "wb");
+    if ( (NULL == fp) || (flash.uint32FlashSize != fwrite(flash.uint8PtrMem, 1, flash.uint32FlashSize, fp)) ) {
+        printf("ERROR:%s: %s not written\n", __FUNCTION__, path);
+        if ( NULL != fp ) {
+            fclose(fp);
+        }
+        return -1;
+    }
+    fclose(fp);
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_ckpt
+ *
+ *  writes checkpoint, optional elements afterwards, invalidates management
+ *  data of all queues and restores them from checkpoint
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                queue for elements written after checkpoint
+ *  @param[in]      numAdd              number of elements written after checkpoint
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_ckpt (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint8_t numAdd)
+{
+    /** Variables **/
+    t_sfcb_cb   cbExp[8];           // expected management data
+    t_sfcb_cb*  cbIs;               // restored management data
+    uint8_t     uint8Data[] = {6,7,8,9};    // element payload
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* write checkpoint */
+    if ( 0 != sfcb_ckpt(sfcb) ) {
+        printf("ERROR:%s:sfcb_ckpt failed to start", __FUNCTION__);
+        return -1;
+    }
+        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    /* elements after checkpoint */
+    for ( uint8_t i = 0; i < numAdd; i++ ) {
+            // run_sfcb_add (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint8_t* data, uint16_t len)
+        if ( 0 != run_sfcb_add(flash, sfcb, qNum, uint8Data, sizeof(uint8Data)) ) {
+            printf("ERROR:%s:run_sfcb_add failed", __FUNCTION__);
+            return -1;
+        }
+    }
+    /* expected state, all queues mounted */
+    if ( 0 != sfcb_mkcb(sfcb) ) {
+        printf("ERROR:%s:sfcb_mkcb failed to start", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    memcpy(cbExp, sfcb->ptrCbs, sfcb->uint8NumCbs * sizeof(cbExp[0]));
+    /* invalidate all queues */
+    for ( uint8_t i = 0; i < sfcb->uint8NumCbs; i++ ) {
+        (sfcb->ptrCbs[i]).uint8MgmtValid = 0;
+    }
+    /* restore */
+    if ( 0 != sfcb_mkcb(sfcb) ) {
+        printf("ERROR:%s:sfcb_mkcb failed to start", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    /* compare */
+    for ( uint8_t i = 0; i < sfcb->uint8NumCbs; i++ ) {
+        cbIs = &(sfcb->ptrCbs[i]);
+        if ( 0 == cbIs->uint8Used ) {
+            break;
+        }
+        if (    (0 == cbIs->uint8MgmtValid)
+             || (cbExp[i].uint32IdNumMax != cbIs->uint32IdNumMax)
+             || (cbExp[i].uint32IdNumMin != cbIs->uint32IdNumMin)
+             || (cbExp[i].uint32NumEntries != cbIs->uint32NumEntries)
+             || (cbExp[i].uint32StartPageWrite != cbIs->uint32StartPageWrite)
+             || (cbExp[i].uint32StartPageIdMax != cbIs->uint32StartPageIdMax)
+             || (cbExp[i].uint32StartPageIdMin != cbIs->uint32StartPageIdMin)
+        ) {
+            printf("ERROR:%s:q%d: mismatch, idmax exp=%d is=%d, idmin exp=%d is=%d, wrpage exp=0x%x is=0x%x\n", __FUNCTION__, i, cbExp[i].uint32IdNumMax, cbIs->uint32IdNumMax, cbExp[i].uint32IdNumMin, cbIs->uint32IdNumMin, cbExp[i].uint32StartPageWrite, cbIs->uint32StartPageWrite);
+            return -1;
+        }
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_pre_erase
+ *
+ *  sets pre-erase watermark above free elements, runs worker in idle
+ *  and checks management data against rebuild from flash
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_pre_erase (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &(sfcb->ptrCbs[qNum]);     // tested queue
+    uint16_t    uint16Free;                     // free elements before pre-erase
+    uint8_t     uint8Buf[32];                   // read buffer
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* watermark above free elements */
+    uint16Free = (uint16_t) (cb->uint32NumEntriesMax - cb->uint32NumEntries);
+    if ( 0 != sfcb_pre_erase(sfcb, qNum, (uint16_t) (uint16Free + 1)) ) {
+        printf("ERROR:%s:sfcb_pre_erase", __FUNCTION__);
+        return -1;
+    }
+    /* worker in idle starts erase */
+    sfcb_worker(sfcb);
+    if ( 0 == sfcb_busy(sfcb) ) {
+        printf("ERROR:%s: pre-erase not started\n", __FUNCTION__);
+        return -1;
+    }
+    sfm(flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(sfcb));
+        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    sfcb_pre_erase(sfcb, qNum, 0);
+    /* read newest element while erase is in progress, suspends erase */
+    if ( 0 != sfcb_get_last(sfcb, qNum, uint8Buf, sizeof(uint8Buf)) ) {
+        printf("ERROR:%s:sfcb_get_last failed to start", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (0 != sfcb->uint8EraseSus) || (0 != memcmp(uint8Buf, flash->uint8PtrMem + cb->uint32StartPageIdMax + sizeof(spi_flash_cb_elem_head), sizeof(uint8Buf))) ) {
+        printf("ERROR:%s:q%d: read while erase failed\n", __FUNCTION__, qNum);
+        return -1;
+    }
+    /* sector erased */
+    printf("INFO:%s:q%d: free elements before=%d, after=%d\n", __FUNCTION__, qNum, uint16Free, cb->uint32NumEntriesMax - cb->uint32NumEntries);
+    if ( !(uint16Free < (cb->uint32NumEntriesMax - cb->uint32NumEntries)) ) {
+        printf("ERROR:%s:q%d: no elements erased\n", __FUNCTION__, qNum);
+        return -1;
+    }
+    /* management data matches flash */
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    return test_mkcb_rebuild(flash, sfcb, qNum, 0);
+}
+
+
+
+/**
+ *  @brief job_done
+ *
+ *  job done callback, records finished jobs
+ *
+ *  @param[in,out]  arg                 list of finished jobs, first element counts
+ *  @param[in]      job                 finished job
+ *  @param[in]      ret                 job state
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void job_done (void *arg, const t_sfcb_job *job, int ret)
+{
+    int*    intPtrLog = (int*) arg;
+
+    printf("INFO:%s: api=%d, cb=%d, ret=%d\n", __FUNCTION__, job->api, job->uint8Cb, ret);
+    intPtrLog[0]++;
+    intPtrLog[intPtrLog[0]] = (SFCB_OK == ret) ? (int) job->api : -1;
+}
+
+
+
+/**
+ *  @brief test_jobq
+ *
+ *  posts multiple requests while the worker is busy and checks
+ *  processing order and results
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_jobq (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+{
+    /** Variables **/
+    t_sfcb_job  jobs[3];                // job queue
+    int         intLog[8] = {0};        // finished jobs
+    const int   intExp[] = {SFCB_API_GET_LAST, SFCB_API_FLASH_READ, -1, SFCB_API_GET_LAST};   // expected order
+    uint8_t     uint8Buf0[16];          // read buffer
+    uint8_t     uint8Buf1[16];          // read buffer
+    uint8_t     uint8Buf2[16];          // read buffer
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    if ( 0 != sfcb_init_jobq(sfcb, jobs, sizeof(jobs)/sizeof(jobs[0]), job_done, intLog) ) {
+        printf("ERROR:%s:sfcb_init_jobq", __FUNCTION__);
+        return -1;
+    }
+    /* post requests, first starts, rest is queued */
+    memset(uint8Buf0, 0, sizeof(uint8Buf0));
+    memset(uint8Buf2, 0, sizeof(uint8Buf2));
+    if (    (SFCB_OK != sfcb_get_last(sfcb, qNum, uint8Buf0, sizeof(uint8Buf0)))
+         || (SFCB_OK != sfcb_flash_read(sfcb, (sfcb->ptrCbs[qNum]).uint32StartPageIdMax + sizeof(spi_flash_cb_elem_head), uint8Buf1, sizeof(uint8Buf1)))
+         || (SFCB_OK != sfcb_get_last(sfcb, (uint8_t) (sfcb->uint8NumCbs + 1), uint8Buf2, sizeof(uint8Buf2)))   // rejected on start
+         || (SFCB_OK != sfcb_get_last(sfcb, qNum, uint8Buf2, sizeof(uint8Buf2)))
+    ) {
+        printf("ERROR:%s:request not accepted", __FUNCTION__);
+        return -1;
+    }
+    /* queue full */
+    if ( SFCB_E_WKR_BSY != sfcb_mkcb(sfcb) ) {
+        printf("ERROR:%s:job queue overflow not detected", __FUNCTION__);
+        return -1;
+    }
+        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
+    if ( 0 != run_sfm_update(flash, sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        return -1;
+    }
+    /* check order */
+    if ( (int) (sizeof(intExp)/sizeof(intExp[0])) != intLog[0] ) {
+        printf("ERROR:%s: exp=%d jobs, is=%d jobs\n", __FUNCTION__, (int) (sizeof(intExp)/sizeof(intExp[0])), intLog[0]);
+        return -1;
+    }
+    for ( uint8_t i = 0; i < sizeof(intExp)/sizeof(intExp[0]); i++ ) {
+        if ( intExp[i] != intLog[i+1] ) {
+            printf("ERROR:%s: job=%d, exp=%d, is=%d\n", __FUNCTION__, i, intExp[i], intLog[i+1]);
+            return -1;
+        }
+    }
+    /* check data */
+    if ( (0 != memcmp(uint8Buf0, uint8Buf1, sizeof(uint8Buf0))) || (0 != memcmp(uint8Buf0, uint8Buf2, sizeof(uint8Buf0))) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* release job queue */
+    sfcb_init_jobq(sfcb, NULL, 0, NULL, NULL);
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief read_sink
+ *
+ *  read sink, copies chunks into test buffer and counts them
+ *
+ *  @param[in,out]  arg                 destination buffer, #t_sink_buf
+ *  @param[in]      ofs                 byte offset of chunk
+ *  @param[in]      data                chunk data
+ *  @param[in]      len                 chunk length
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void read_sink (void *arg, uint32_t ofs, const uint8_t *data, uint16_t len)
+{
+    t_sink_buf* sink = (t_sink_buf*) arg;
+
+    memcpy(sink->uint8PtrBuf + ofs, data, len);
+    sink->uint32Len += len;
+    sink->uint32Chunks++;
+}
+
+
+
+/**
+ *  @brief test_sink
+ *
+ *  reads last element via read sink and compares with buffered read
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @param[in]      qSize               size of queue payload in bytes
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_sink (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+{
+    /** Variables **/
+    uint8_t*    uint8PtrExp = NULL;     // buffered read
+    t_sink_buf  sink;                   // sink read
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    uint8PtrExp = malloc(qSize);
+    sink.uint8PtrBuf = malloc(qSize);
+    sink.uint32Len = 0;
+    sink.uint32Chunks = 0;
+    if ( (NULL == uint8PtrExp) || (NULL == sink.uint8PtrBuf) ) {
+        printf("ERROR:%s: malloc fail", __FUNCTION__);
+        return -1;
+    }
+    /* no sink */
+    if ( SFCB_E_MEM != sfcb_get_last(sfcb, qNum, NULL, qSize) ) {
+        printf("ERROR:%s: missing read sink not detected\n", __FUNCTION__);
+        return -1;
+    }
+    /* reference */
+    if ( (0 != sfcb_get_last(sfcb, qNum, uint8PtrExp, qSize)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    /* sink read */
+    if ( 0 != sfcb_init_sink(sfcb, read_sink, &sink) ) {
+        printf("ERROR:%s:sfcb_init_sink\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (0 != sfcb_get_last(sfcb, qNum, NULL, qSize)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    printf("INFO:%s: bytes=%d, chunks=%d\n", __FUNCTION__, sink.uint32Len, sink.uint32Chunks);
+    if ( (qSize != sink.uint32Len) || (0 != memcmp(uint8PtrExp, sink.uint8PtrBuf, qSize)) ) {
+        printf("ERROR:%s: sink data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    sfcb_init_sink(sfcb, NULL, NULL);
+    /* all done */
+    free(uint8PtrExp);
+    free(sink.uint8PtrBuf);
+    return 0;
+}
+
+
+
+/**
+ *  @brief iter_log
+ *
+ *  element iterator callback, compares payload with flash model
+ *
+ *  @param[in,out]  arg                 iterator log, #t_iter_log
+ *  @param[in]      idNum               element id
+ *  @param[in]      ofs                 byte offset in payload
+ *  @param[in]      data                chunk data, NULL if element complete
+ *  @param[in]      len                 chunk length
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void iter_log (void *arg, uint32_t idNum, uint16_t ofs, const uint8_t *data, uint16_t len)
+{
+    /** Variables **/
+    t_iter_log*             log = (t_iter_log*) arg;
+    uint32_t                uint32ElemSize = log->cb->uint32NumPagesPerElem * 256u;
+    uint32_t                uint32Adr;
+    spi_flash_cb_elem_head  head;
+
+    /* element complete */
+    if ( NULL == data ) {
+        if ( log->uint32IdNext != idNum ) {
+            log->intEro = 1;
+        }
+        log->uint32IdNext++;
+        log->uint32Elems++;
+        return;
+    }
+    /* search element in flash */
+    for ( uint32_t i = 0; i < log->cb->uint32NumEntriesMax; i++ ) {
+        uint32Adr = log->cb->uint32StartSector * 4096u + i * uint32ElemSize;
+        memcpy(&head, log->flash->uint8PtrMem + uint32Adr, sizeof(head));
+        if ( (head.uint32MagicNum == log->cb->uint32MagicNum) && (head.uint32IdNum == idNum) ) {
+            if ( 0 != memcmp(log->flash->uint8PtrMem + uint32Adr + sizeof(head) + ofs, data, len) ) {
+                log->intEro = 1;
+            }
+            log->uint32Bytes += len;
+            return;
+        }
+    }
+    log->intEro = 1;
+}
+
+
+
+/**
+ *  @brief codec record
+ *
+ *  fills test record of #test_codec, slowly changing sample with counter
+ *
+ *  @param[out]     rec                 record
+ *  @param[in]      len                 record size in bytes
+ *  @param[in]      cnt                 sample counter
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void codec_rec (uint8_t *rec, uint16_t len, uint32_t cnt)
+{
+    for ( uint16_t i = 0; i < len; i++ ) {
+        rec[i] = (uint8_t) (i + 1);
+    }
+    memcpy(rec, &cnt, sizeof(cnt));
+    rec[len/2] = (uint8_t) (20 + cnt / 16);
+}
+
+
+
+/**
+ *  @brief iterator codec
+ *
+ *  checks that the decoded records of #test_codec are consecutive
+ *
+ *  @param[in,out]  arg                 iterator log, #t_iter_log, uint32Bytes is the expected record counter
+ *  @param[in]      idNum               element id
+ *  @param[in]      ofs                 record number in element, number of records if element complete
+ *  @param[in]      data                decoded record, NULL if element complete
+ *  @param[in]      len                 record size
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void iter_codec (void *arg, uint32_t idNum, uint16_t ofs, const uint8_t *data, uint16_t len)
+{
+    /** Variables **/
+    t_iter_log* log = (t_iter_log*) arg;
+    uint8_t     uint8Exp[64];   // expected record
+
+    (void) ofs;
+    /* element complete */
+    if ( NULL == data ) {
+        if ( log->uint32IdNext != idNum ) {
+            log->intEro = 1;
+        }
+        log->uint32IdNext++;
+        log->uint32Elems++;
+        return;
+    }
+    /* first record of iteration defines counter */
+    if ( 0 == log->uint32Bytes ) {
+        memcpy(&(log->uint32Bytes), data, sizeof(log->uint32Bytes));
+    }
+    codec_rec(uint8Exp, len, log->uint32Bytes);
+    if ( (len > sizeof(uint8Exp)) || (0 != memcmp(uint8Exp, data, len)) ) {
+        log->intEro = 1;
+    }
+    log->uint32Bytes++;
+}
+
+
+
+/**
+ *  @brief test_iter
+ *
+ *  iterates over all elements of the queue and compares with flash model,
+ *  checks detection of a corrupted element header
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_iter (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+{
+    /** Variables **/
+    t_sfcb_cb*  cb = &(sfcb->ptrCbs[qNum]);     // tested queue
+    t_iter_log  log;                            // iterator log
+    uint32_t    uint32Adr;                      // corrupted header
+    uint8_t     uint8Save;                      // original byte
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    memset(&log, 0, sizeof(log));
+    log.flash = flash;
+    log.cb = cb;
+    log.uint32IdNext = sfcb_idmin(sfcb, qNum);
+    /* all elements */
+    if ( (0 != sfcb_iter(sfcb, qNum, sfcb_idmin(sfcb, qNum), UINT32_MAX, iter_log, &log)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_iter\n", __FUNCTION__);
+        return -1;
+    }
+    printf("INFO:%s:q%d: elements=%d, bytes=%d\n", __FUNCTION__, qNum, log.uint32Elems, log.uint32Bytes);
+    if ( (0 != sfcb_isero(sfcb)) || (0 != log.intEro) || (cb->uint32NumEntries != log.uint32Elems) || ((cb->uint32NumEntries * cb->uint16PlSize) != log.uint32Bytes) ) {
+        printf("ERROR:%s:q%d: iterated elements mismatch\n", __FUNCTION__, qNum);
+        return -1;
+    }
+    /* out of range */
+    if ( SFCB_E_CB_Q_MTY != sfcb_iter(sfcb, qNum, sfcb_idmax(sfcb, qNum) + 1, 1, iter_log, &log) ) {
+        printf("ERROR:%s:q%d: id out of range not detected\n", __FUNCTION__, qNum);
+        return -1;
+    }
+    /* corrupted header of newest element */
+    uint32Adr = cb->uint32StartPageIdMax;
+    uint8Save = flash->uint8PtrMem[uint32Adr];
+    flash->uint8PtrMem[uint32Adr] = (uint8_t) ~uint8Save;
+    log.uint32IdNext = sfcb_idmax(sfcb, qNum) - 1;
+    if ( (0 != sfcb_iter(sfcb, qNum, log.uint32IdNext, 2, iter_log, &log)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_iter\n", __FUNCTION__);
+        return -1;
+    }
+    flash->uint8PtrMem[uint32Adr] = uint8Save;
+    if ( (0 == sfcb_isero(sfcb)) || (sfcb_idmax(sfcb, qNum) != log.uint32IdNext) ) {
+        printf("ERROR:%s:q%d: corrupted header not detected\n", __FUNCTION__, qNum);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief rec_log
+ *
+ *  record iterator callback of packed queue, record bytes are id + offset
+ *
+ *  @param[in,out]  arg                 iterator log, #t_iter_log
+ *  @param[in]      idNum               record id
+ *  @param[in]      ofs                 byte offset in record
+ *  @param[in]      data                record data, NULL if record complete
+ *  @param[in]      len                 number of bytes
+ *  @return         void
+ *  @since          2026-10-14
+ */
+static void rec_log (void *arg, uint32_t idNum, uint16_t ofs, const uint8_t *data, uint16_t len)
+{
+    /** Variables **/
+    t_iter_log* log = (t_iter_log*) arg;
+
+    /* record complete */
+    if ( NULL == data ) {
+        if ( log->uint32IdNext != idNum ) {
+            log->intEro = 1;
+        }
+        log->uint32IdNext++;
+        log->uint32Elems++;
+        return;
+    }
+    for ( uint16_t i = 0; i < len; i++ ) {
+        if ( (uint8_t) (idNum + ofs + i) != data[i] ) {
+            log->intEro = 1;
+        }
+    }
+    log->uint32Bytes += len;
+}
+
+
+
+/**
+ *  @brief test_pack
+ *
+ *  packed queue with small records, records are appended to open element,
+ *  closed elements are read back record by record
+ *
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_pack (void)
+{
+    /** Variables **/
+    t_sfm           flash;                  // separate flash
+    t_sfcb          sfcb;                   // separate handle
+    t_sfcb_cb       cb[1];                  // one queue
+    t_iter_log      log;                    // record log
+    uint8_t         uint8Rec[20];           // record
+    const uint8_t   uint8RecPerElem = 11;   // (256 - 16) / (20 + 1)
+    uint8_t         uint8Temp;              // help variable
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* one record per page is no packing */
+    if ( SFCB_E_MEM != sfcb_new_pack(&sfcb, 0x5a5a0002, 200, 100, &uint8Temp) ) {
+        printf("ERROR:%s:sfcb_new_pack: large record accepted\n", __FUNCTION__);
+        return -1;
+    }
+    if (    (0 != sfcb_new_pack(&sfcb, 0x5a5a0002, sizeof(uint8Rec), 100, &uint8Temp))
+         || (1 != cb[0].uint32NumPagesPerElem)
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_update(&flash, &sfcb))
+    ) {
+        printf("ERROR:%s:sfcb_new_pack\n", __FUNCTION__);
+        return -1;
+    }
+    if ( SFCB_E_MEM != sfcb_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)) ) {
+        printf("ERROR:%s:sfcb_add: packed queue accepted\n", __FUNCTION__);
+        return -1;
+    }
+    /* two closed elements, third open */
+    for ( uint32_t i = 1; i <= 2u * uint8RecPerElem + 3; i++ ) {
+        for ( uint8_t j = 0; j < sizeof(uint8Rec); j++ ) {
+            uint8Rec[j] = (uint8_t) (i + j);
+        }
+        if ( (0 != sfcb_add_rec(&sfcb, 0, uint8Rec)) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+            printf("ERROR:%s:sfcb_add_rec: record=%d\n", __FUNCTION__, i);
+            return -1;
+        }
+    }
+    if ( (2 != sfcb_idmax(&sfcb, 0)) || (3 * (sizeof(uint8Rec) + SFCB_REC_HEAD_SIZE) != sfcb_get_pl_wrcnt(&sfcb, 0)) ) {
+        printf("ERROR:%s: idmax=%d, written=%d\n", __FUNCTION__, sfcb_idmax(&sfcb, 0), sfcb_get_pl_wrcnt(&sfcb, 0));
+        return -1;
+    }
+    /* close open element, free record slots are skipped */
+    if ( (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_add_done\n", __FUNCTION__);
+        return -1;
+    }
+    memset(&log, 0, sizeof(log));
+    log.uint32IdNext = 1;
+    (void) sfcb_read_chunk(&sfcb, 50);  // records split across reads
+    if ( (0 != sfcb_iter(&sfcb, 0, sfcb_idmin(&sfcb, 0), UINT32_MAX, rec_log, &log)) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_iter\n", __FUNCTION__);
+        return -1;
+    }
+    printf("INFO:%s: records=%d, bytes=%d\n", __FUNCTION__, log.uint32Elems, log.uint32Bytes);
+    if (    (0 != sfcb_isero(&sfcb)) || (0 != log.intEro)
+         || ((2u * uint8RecPerElem + 3) != log.uint32Elems)
+         || ((2u * uint8RecPerElem + 3) * sizeof(uint8Rec) != log.uint32Bytes)
+    ) {
+        printf("ERROR:%s: iterated records mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* management data in RAM equal to rebuild from flash */
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    return test_mkcb_rebuild(&flash, &sfcb, 0, 0);
+}
+
+
+
+/**
+ *  @brief test_tick
+ *
+ *  tick source for WIP polling, advances with every call
+ *
+ *  @return         uint32_t            current tick
+ *  @since          2026-10-14
+ */
+static uint32_t test_tick (void)
+{
+    return g_uint32Tick++;
+}
+
+
+
+/**
+ *  @brief test_wip
+ *
+ *  adds element with tick source and continuous status register read,
+ *  checks that no SPI transfer is requested before expected page program completion
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[in]      qNum                number of tested circular buffer queue
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_wip (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+{
+    /** Variables **/
+    uint8_t     uint8Data[16];          // written data
+    uint8_t     uint8Buf[16];           // read buffer
+    uint32_t    uint32Skip = 0;         // worker calls without SPI transfer
+    uint32_t    uint32Counter = 0;      // counter for time out
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    /* configure polling */
+    if ( (SFCB_E_MEM != sfcb_wip_cfg(sfcb, 0, NULL, 0, 0)) || (SFCB_E_MEM != sfcb_wip_cfg(sfcb, 4, test_tick, 0, 0)) ) {
+        printf("ERROR:%s:sfcb_wip_cfg invalid arguments accepted", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != sfcb_wip_cfg(sfcb, 4, test_tick, 100, 100) ) {
+        printf("ERROR:%s:sfcb_wip_cfg", __FUNCTION__);
+        return -1;
+    }
+    /* write element */
+    for ( uint8_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (0xa0 + i);
+    }
+    if ( 0 != sfcb_add(sfcb, qNum, uint8Data, sizeof(uint8Data)) ) {
+        printf("ERROR:%s:sfcb_add failed to start", __FUNCTION__);
+        return -1;
+    }
+    while ( (0 != sfcb_busy(sfcb)) && ((uint32Counter++) < g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(sfcb);
+        if ( (0 != sfcb_busy(sfcb)) && (0 == sfcb_spi_len(sfcb)) && (0 != sfcb_wip_hint(sfcb, NULL)) ) {
+            uint32Skip++;
+        }
+        if ( 0 != sfm(flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(sfcb)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    printf("INFO:%s: worker calls without transfer=%d\n", __FUNCTION__, uint32Skip);
+    if ( (0 != sfcb_busy(sfcb)) || (0 == uint32Skip) ) {
+        printf("ERROR:%s: no polls skipped\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (0 != sfcb_add_done(sfcb, qNum)) || (0 != run_sfm_update(flash, sfcb)) || (0 != sfcb_mkcb(sfcb)) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_add_done\n", __FUNCTION__);
+        return -1;
+    }
+    /* read back */
+    if ( (0 != sfcb_get_last(sfcb, qNum, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(flash, sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data, uint8Buf, sizeof(uint8Data)) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* restore */
+    sfcb_wip_cfg(sfcb, 1, NULL, 0, 0);
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_stage
+ *
+ *  single byte appends are combined in staging buffer to page programs,
+ *  staged bytes are programmed by sfcb_add_done or after timeout
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_stage (void)
+{
+    /** Variables **/
+    t_sfm       flash;                  // separate flash
+    t_sfcb      sfcb;                   // separate handle
+    t_sfcb_cb   cb[1];                  // one queue
+    uint8_t     uint8Stage[300];        // staging buffer
+    uint8_t     uint8Buf[600];          // read buffer
+    uint8_t     uint8Data;              // appended byte
+    uint32_t    uint32Prog = 0;         // page programs
+    uint32_t    uint32Counter;          // counter for time out
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0x5a5a0003, 1000, 8) ) {
+        return -1;
+    }
+    /* staging buffer holds at least one page */
+    if ( SFCB_E_MEM != sfcb_stage_cfg(&sfcb, 0, uint8Stage, 100, 0) ) {
+        printf("ERROR:%s:sfcb_stage_cfg: small buffer accepted\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != sfcb_stage_cfg(&sfcb, 0, uint8Stage, sizeof(uint8Stage), 0) ) {
+        printf("ERROR:%s:sfcb_stage_cfg\n", __FUNCTION__);
+        return -1;
+    }
+    /* single byte appends, programmed at page end */
+    for ( uint16_t i = 0; i < sizeof(uint8Buf); i++ ) {
+        uint8Data = (uint8_t) (0x30 + i);
+        if ( 0 != sfcb_add(&sfcb, 0, &uint8Data, 1) ) {
+            printf("ERROR:%s:sfcb_add: byte=%d\n", __FUNCTION__, i);
+            return -1;
+        }
+        uint32Counter = 0;
+        while ( (0 != sfcb_busy(&sfcb)) && ((uint32Counter++) < g_uint32SpiFlashCycleOut) ) {
+            sfcb_worker(&sfcb);
+            if ( (0 != sfcb_spi_len(&sfcb)) && (SFCB_FLASH_IST_WR_PAGE == g_uint8Spi[0]) ) {
+                uint32Prog++;
+            }
+            if ( 0 != sfm(&flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(&sfcb)) ) {
+                printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+                return -1;
+            }
+        }
+    }
+    printf("INFO:%s: programs=%d, written=%d, staged=%d\n", __FUNCTION__, uint32Prog, sfcb_get_pl_wrcnt(&sfcb, 0), sfcb_get_pl_stcnt(&sfcb, 0));
+    if ( (2 != uint32Prog) || (504 != sfcb_get_pl_wrcnt(&sfcb, 0)) || (96 != sfcb_get_pl_stcnt(&sfcb, 0)) ) {
+        printf("ERROR:%s: appends not combined\n", __FUNCTION__);
+        return -1;
+    }
+    if ( SFCB_E_WKR_REQ != sfcb_stage_cfg(&sfcb, 0, NULL, 0, 0) ) {
+        printf("ERROR:%s:sfcb_stage_cfg: staged bytes dropped\n", __FUNCTION__);
+        return -1;
+    }
+    /* staged bytes with footer */
+    if (    (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (1 != sfcb_idmax(&sfcb, 0)) || (0 != sfcb_get_pl_stcnt(&sfcb, 0))
+    ) {
+        printf("ERROR:%s:sfcb_add_done\n", __FUNCTION__);
+        return -1;
+    }
+    memset(uint8Buf, 0, sizeof(uint8Buf));
+    if ( (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint16_t i = 0; i < sizeof(uint8Buf); i++ ) {
+        if ( (uint8_t) (0x30 + i) != uint8Buf[i] ) {
+            printf("ERROR:%s: read data mismatch at %d\n", __FUNCTION__, i);
+            return -1;
+        }
+    }
+    /* staged bytes programmed by idle worker after timeout */
+    if (    (0 != sfcb_wip_cfg(&sfcb, 1, test_tick, 100, 100))
+         || (0 != sfcb_stage_cfg(&sfcb, 0, uint8Stage, sizeof(uint8Stage), 1000))
+         || (0 != sfcb_add(&sfcb, 0, uint8Buf, 10))
+         || (0 != sfcb_busy(&sfcb))
+    ) {
+        printf("ERROR:%s: staged append\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint32Counter = 0; (0 != sfcb_get_pl_stcnt(&sfcb, 0)) && (uint32Counter < g_uint32SpiFlashCycleOut); uint32Counter++ ) {
+        sfcb_worker(&sfcb);
+        if ( 0 != sfm(&flash, (uint8_t*) &g_uint8Spi, sfcb_spi_len(&sfcb)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    if ( (0 != run_sfm_update(&flash, &sfcb)) || (0 != sfcb_isero(&sfcb)) || (10 != sfcb_get_pl_wrcnt(&sfcb, 0)) ) {
+        printf("ERROR:%s: staged bytes not programmed, written=%d\n", __FUNCTION__, sfcb_get_pl_wrcnt(&sfcb, 0));
+        return -1;
+    }
+    if ( (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb)) || (2 != sfcb_idmax(&sfcb, 0)) ) {
+        printf("ERROR:%s:sfcb_add_done\n", __FUNCTION__);
+        return -1;
+    }
+    /* staging overflow, staged bytes and append programmed in one job without job queue */
+    for ( uint16_t i = 0; i < sizeof(uint8Buf); i++ ) {
+        uint8Buf[i] = (uint8_t) (0x50 + i);
+    }
+    if (    (0 != sfcb_add(&sfcb, 0, uint8Buf, 200)) || (0 != sfcb_busy(&sfcb))
+         || (0 != sfcb_add(&sfcb, 0, uint8Buf+200, 150)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (350 != sfcb_get_pl_wrcnt(&sfcb, 0)) || (0 != sfcb_get_pl_stcnt(&sfcb, 0))
+    ) {
+        printf("ERROR:%s: staging overflow, written=%d\n", __FUNCTION__, sfcb_get_pl_wrcnt(&sfcb, 0));
+        return -1;
+    }
+    memset(uint8Buf, 0, sizeof(uint8Buf));
+    if (    (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb)) || (3 != sfcb_idmax(&sfcb, 0))
+         || (0 != sfcb_get_last(&sfcb, 0, uint8Buf, 350)) || (0 != run_sfm_update(&flash, &sfcb))
+    ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint16_t i = 0; i < 350; i++ ) {
+        if ( (uint8_t) (0x50 + i) != uint8Buf[i] ) {
+            printf("ERROR:%s: staging overflow data mismatch at %d\n", __FUNCTION__, i);
+            return -1;
+        }
+    }
+    /* management data in RAM equal to rebuild from flash */
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    return test_mkcb_rebuild(&flash, &sfcb, 0, 0);
+}
+
+
+
+/**
+ *  @brief run_sfm_pp
+ *
+ *  processes worker with ping-pong buffers, emulates DMA with two queued
+ *  transfers which completes every second worker call
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[out]     depth               maximum number of queued transfers
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int run_sfm_pp (t_sfm* flash, t_sfcb* sfcb, uint8_t* depth)
+{
+    /** Variables **/
+    uint8_t*    uint8PtrQ[2];           // queued transfers
+    uint16_t    uint16LenQ[2];          // length of queued transfers
+    uint8_t     uint8NumQ = 0;          // number of queued transfers
+    uint32_t    uint32Counter = 0;      // counter for time out
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    while ( ((0 != sfcb_busy(sfcb)) || (0 != uint8NumQ)) && ((uint32Counter++) < 2*g_uint32SpiFlashCycleOut) ) {
+        sfcb_worker(sfcb);
+        if ( 0 != sfcb_spi_len(sfcb) ) {
+            if ( !(uint8NumQ < 2) ) {
+                printf("ERROR:%s: more than two transfers queued\n", __FUNCTION__);
+                return -1;
+            }
+            uint8PtrQ[uint8NumQ] = sfcb_spi_buf(sfcb);
+            uint16LenQ[uint8NumQ] = sfcb_spi_len(sfcb);
+            uint8NumQ++;
+            *depth = (uint8_t) ((uint8NumQ > *depth) ? uint8NumQ : *depth);
+        }
+        /* oldest transfer completes */
+        if ( (0 != uint8NumQ) && (0 != (uint32Counter % 2)) ) {
+            if ( 0 != sfm(flash, uint8PtrQ[0], uint16LenQ[0]) ) {
+                printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+                return -1;
+            }
+            sfcb_spi_done(sfcb, uint8PtrQ[0]);
+            uint8PtrQ[0] = uint8PtrQ[1];
+            uint16LenQ[0] = uint16LenQ[1];
+            uint8NumQ--;
+        }
+    }
+    if ( (0 != sfcb_busy(sfcb)) || (0 != sfcb_isero(sfcb)) ) {
+        printf("ERROR:%s: time out or worker error\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_pingpong
+ *
+ *  GET/RAW reads and linear header scan with read ahead in second SPI
+ *  buffer, writes with one transfer in flight
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_pingpong (void)
+{
+    /** Variables **/
+    t_sfm       flash;                  // separate flash
+    t_sfcb      sfcb;                   // separate handle
+    t_sfcb_cb   cb[1];                  // one queue
+    t_sfcb_cb   cbExp;                  // expected management data
+    uint8_t     uint8Spi2[sizeof(g_uint8Spi)];  // second SPI buffer
+    uint8_t     uint8Data[100];         // element
+    uint8_t     uint8Buf[3000];         // read buffer
+    uint8_t     uint8Depth = 0;         // queued transfers
+    uint8_t     uint8Temp;              // help variable
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* mount with both buffers */
+    if (    (SFCB_E_MEM != sfcb_init_pingpong(&sfcb, uint8Spi2, sizeof(g_uint8Spi) - 1))
+         || (0 != sfcb_init_pingpong(&sfcb, uint8Spi2, sizeof(uint8Spi2)))
+         || (0 != sfcb_new_cb(&sfcb, 0x5a5a0004, sizeof(uint8Data), 40, &uint8Temp))
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_pp(&flash, &sfcb, &uint8Depth))
+    ) {
+        printf("ERROR:%s:sfcb_init_pingpong\n", __FUNCTION__);
+        return -1;
+    }
+    /* program and erase, one transfer in flight */
+    for ( uint8_t i = 0; i < 30; i++ ) {
+        memset(uint8Data, i, sizeof(uint8Data));
+        if ( (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_pp(&flash, &sfcb, &uint8Depth)) ) {
+            printf("ERROR:%s:sfcb_add: element=%d\n", __FUNCTION__, i);
+            return -1;
+        }
+    }
+    if ( (1 != uint8Depth) || (30 != sfcb_idmax(&sfcb, 0)) ) {
+        printf("ERROR:%s: queued transfers=%d, idmax=%d\n", __FUNCTION__, uint8Depth, sfcb_idmax(&sfcb, 0));
+        return -1;
+    }
+    /* raw read stream, read ahead queued */
+    if ( (0 != sfcb_flash_read(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_pp(&flash, &sfcb, &uint8Depth)) ) {
+        printf("ERROR:%s:sfcb_flash_read\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (2 != uint8Depth) || (0 != memcmp(uint8Buf, flash.uint8PtrMem, sizeof(uint8Buf))) ) {
+        printf("ERROR:%s: read stream, queued transfers=%d\n", __FUNCTION__, uint8Depth);
+        return -1;
+    }
+    /* stale read ahead is discarded, worker goes on with the real read */
+    memset(uint8Buf, 0, sizeof(uint8Buf));
+    if ( 0 != sfcb_flash_read(&sfcb, 0, uint8Buf, sizeof(uint8Buf)) ) {
+        printf("ERROR:%s:sfcb_flash_read\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint32_t i = 0; (0 != sfcb_busy(&sfcb)) && (0 == sfcb.uint8PpAhead) && (i < g_uint32SpiFlashCycleOut); i++ ) {
+        sfcb_worker(&sfcb); // first read and read ahead, both in transfer
+        if ( (0 != sfcb_spi_len(&sfcb)) && (SFCB_FLASH_IST_RD_STATE_REG == sfcb_spi_buf(&sfcb)[0]) ) {
+            if ( 0 != sfm(&flash, sfcb_spi_buf(&sfcb), sfcb_spi_len(&sfcb)) ) {
+                printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+                return -1;
+            }
+            sfcb_spi_done(&sfcb, sfcb_spi_buf(&sfcb));
+        }
+    }
+    sfcb.uint32PpAdr++; // read ahead does not match evaluation of first read
+    for ( uint8_t i = 0; i < 2; i++ ) {
+        if ( 0 != sfm(&flash, sfcb.ptrSpiPp[i], (uint16_t) ((i == sfcb.uint8PpCur) ? sfcb.uint16SpiLen : sfcb.uint16PpLen)) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+        sfcb_spi_done(&sfcb, sfcb.ptrSpiPp[i]);
+    }
+    if (    (0 != run_sfm_pp(&flash, &sfcb, &uint8Depth))
+         || (0 != sfcb.uint8PpBsy[0]) || (0 != sfcb.uint8PpBsy[1])
+         || (0 != memcmp(uint8Buf, flash.uint8PtrMem, sizeof(uint8Buf)))
+    ) {
+        printf("ERROR:%s: stale read ahead\n", __FUNCTION__);
+        return -1;
+    }
+    /* linear header scan, corrupted free header forces fall back */
+    memcpy(&cbExp, &cb[0], sizeof(cbExp));
+    cb[0].uint8MgmtValid = 0;
+    flash.uint8PtrMem[cbExp.uint32StartPageWrite + cbExp.uint32NumPagesPerElem * 256 * 2] = 0x5a;
+    if (    (0 != sfcb_mkcb(&sfcb)) || (0 != run_sfm_pp(&flash, &sfcb, &uint8Depth))
+         || (0 == cb[0].uint8MgmtValid)
+         || (cbExp.uint32IdNumMax != cb[0].uint32IdNumMax)
+         || (cbExp.uint32IdNumMin != cb[0].uint32IdNumMin)
+         || (cbExp.uint32StartPageWrite != cb[0].uint32StartPageWrite)
+         || (cbExp.uint32StartPageIdMax != cb[0].uint32StartPageIdMax)
+    ) {
+        printf("ERROR:%s:sfcb_mkcb: linear scan mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* get last element */
+    if ( (0 != sfcb_get_last(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_pp(&flash, &sfcb, &uint8Depth)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint8_t i = 0; i < sizeof(uint8Data); i++ ) {
+        if ( 29 != uint8Data[i] ) {
+            printf("ERROR:%s:sfcb_get_last: data mismatch\n", __FUNCTION__);
+            return -1;
+        }
+    }
+    /* back to single buffer */
+    if ( (0 != sfcb_init_pingpong(&sfcb, NULL, 0)) || (g_uint8Spi != sfcb_spi_buf(&sfcb)) ) {
+        printf("ERROR:%s:sfcb_init_pingpong: disable\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief run_sfm_event
+ *
+ *  processes requests with event driven worker until no work is pending
+ *
+ *  @param[in,out]  flash               spi flash model handle, #t_sfm
+ *  @param[in,out]  sfcb                spi flash circular buffer handle, #t_sfcb
+ *  @param[out]     wait                number of wait returns
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int run_sfm_event (t_sfm* flash, t_sfcb* sfcb, uint32_t* wait)
+{
+    /** Variables **/
+    uint8_t*    uint8PtrSpi;            // next packet
+    uint16_t    uint16Len;              // length of next packet
+    uint8_t*    uint8PtrNo;             // no packet while transfer
+    uint16_t    uint16LenNo;
+    uint32_t    uint32Counter = 0;      // counter for time out
+    int         intRet;                 // worker state
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    while ( (SFCB_E_WKR_IDLE != (intRet = sfcb_next_packet(sfcb, &uint8PtrSpi, &uint16Len))) && ((uint32Counter++) < g_uint32SpiFlashCycleOut) ) {
+        if ( SFCB_E_WKR_WAIT == intRet ) {
+            (*wait)++;  // blocks on semaphore or sleeps in RTOS task
+            continue;
+        }
+        /* packet in transfer, no new packet */
+        if ( (SFCB_E_WKR_WAIT != sfcb_next_packet(sfcb, &uint8PtrNo, &uint16LenNo)) || (0 != uint16LenNo) ) {
+            printf("ERROR:%s: packet created while transfer\n", __FUNCTION__);
+            return -1;
+        }
+        if ( 0 != sfm(flash, uint8PtrSpi, uint16Len) ) {
+            printf("ERROR:%s:spi_flash_model\n", __FUNCTION__);
+            return -1;
+        }
+        sfcb_spi_done(sfcb, uint8PtrSpi);
+    }
+    if ( (0 != sfcb_busy(sfcb)) || (0 != sfcb_isero(sfcb)) ) {
+        printf("ERROR:%s: time out or worker error\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_event
+ *
+ *  event driven worker, no work pending returns without worker ticks,
+ *  tick gated WIP polls waits
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_event (void)
+{
+    /** Variables **/
+    t_sfm       flash;                  // separate flash
+    t_sfcb      sfcb;                   // separate handle
+    t_sfcb_cb   cb[1];                  // one queue
+    uint8_t     uint8Data[300];         // element
+    uint8_t     uint8Buf[300];          // read buffer
+    uint8_t*    uint8PtrSpi;            // next packet
+    uint16_t    uint16Len;              // length of next packet
+    uint32_t    uint32Wait = 0;         // wait returns
+    uint8_t     uint8Temp;              // help variable
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* idle without job, mount through event API */
+    if (    (SFCB_E_WKR_IDLE != sfcb_next_packet(&sfcb, &uint8PtrSpi, &uint16Len))
+         || (0 != uint16Len)
+         || (0 != sfcb_new_cb(&sfcb, 0x5a5a0005, sizeof(uint8Data), 20, &uint8Temp))
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_event(&flash, &sfcb, &uint32Wait))
+    ) {
+        printf("ERROR:%s:sfcb_next_packet\n", __FUNCTION__);
+        return -1;
+    }
+    /* without tick source every WIP poll is a transfer */
+    for ( uint16_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (i + 7);
+    }
+    if ( (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_event(&flash, &sfcb, &uint32Wait)) || (0 != uint32Wait) ) {
+        printf("ERROR:%s:sfcb_add: waits=%d\n", __FUNCTION__, uint32Wait);
+        return -1;
+    }
+    /* tick gated WIP polls */
+    if (    (0 != sfcb_wip_cfg(&sfcb, 1, test_tick, 100, 100))
+         || (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data)))
+         || (0 != run_sfm_event(&flash, &sfcb, &uint32Wait))
+         || (0 == uint32Wait)
+         || (2 != sfcb_idmax(&sfcb, 0))
+    ) {
+        printf("ERROR:%s:sfcb_wip_cfg: waits=%d, idmax=%d\n", __FUNCTION__, uint32Wait, sfcb_idmax(&sfcb, 0));
+        return -1;
+    }
+    printf("INFO:%s: waits=%d\n", __FUNCTION__, uint32Wait);
+    if ( (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_event(&flash, &sfcb, &uint32Wait)) ) {
+        printf("ERROR:%s:sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    if ( 0 != memcmp(uint8Data, uint8Buf, sizeof(uint8Data)) ) {
+        printf("ERROR:%s: read data mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_trace
+ *
+ *  trace ring wraps around and records page program of added element
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_trace (void)
+{
+    /** Variables **/
+    t_sfm           flash;              // separate flash
+    t_sfcb          sfcb;               // separate handle
+    t_sfcb_cb       cb[1];              // one queue
+    t_sfcb_trace    trace[8];           // trace ring
+    uint8_t         uint8Data[100];     // element
+    uint8_t         uint8Temp;          // help variable
+    uint8_t         uint8Found = 0;     // page program recorded
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* mount is traced */
+    if (    (SFCB_E_MEM != sfcb_init_trace(&sfcb, trace, 0))
+         || (0 != sfcb_init_trace(&sfcb, trace, sizeof(trace)/sizeof(trace[0])))
+         || (0 != sfcb_new_cb(&sfcb, 0x5a5a0006, sizeof(uint8Data), 10, &uint8Temp))
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_update(&flash, &sfcb))
+    ) {
+        printf("ERROR:%s:sfcb_init_trace\n", __FUNCTION__);
+        return -1;
+    }
+    memset(uint8Data, 0x3c, sizeof(uint8Data));
+    if ( (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+        printf("ERROR:%s:sfcb_add\n", __FUNCTION__);
+        return -1;
+    }
+    /* ring wrapped */
+    if ( sfcb_trace_cnt(&sfcb) <= sizeof(trace)/sizeof(trace[0]) ) {
+        printf("ERROR:%s: trace count=%d\n", __FUNCTION__, sfcb_trace_cnt(&sfcb));
+        return -1;
+    }
+    /* newest records contain page program (02h) of element */
+    for ( uint8_t i = 0; i < sizeof(trace)/sizeof(trace[0]); i++ ) {
+        if ( (0x02 == trace[i].uint8Ist) && (cb[0].uint32StartPageIdMax == trace[i].uint32Adr) ) {
+            uint8Found = 1;
+        }
+    }
+    if ( 0 == uint8Found ) {
+        printf("ERROR:%s: no page program at 0x%x recorded\n", __FUNCTION__, cb[0].uint32StartPageIdMax);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_stats
+ *
+ *  performance counters of wrapping queue, jobs and latency histogram
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_stats (void)
+{
+    /** Variables **/
+    t_sfm           flash;              // separate flash
+    t_sfcb          sfcb;               // separate handle
+    t_sfcb_cb       cb[1];              // one queue
+    t_sfcb_stats    stats;              // performance counters
+    t_sfcb_stats    snap;               // exported counters
+    uint8_t         uint8Data[200];     // element
+    uint8_t         uint8Temp;          // help variable
+    uint32_t        uint32Hist = 0;     // histogram entries
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* counters of mount included */
+    if (    (SFCB_E_MEM != sfcb_stats_get(&sfcb, &snap))
+         || (0 != sfcb_init_stats(&sfcb, &stats))
+         || (0 != sfcb_wip_cfg(&sfcb, 1, test_tick, 1000, 1000))
+         || (0 != sfcb_new_cb(&sfcb, 0x5a5a0007, sizeof(uint8Data), 10, &uint8Temp))
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_update(&flash, &sfcb))
+    ) {
+        printf("ERROR:%s:sfcb_init_stats\n", __FUNCTION__);
+        return -1;
+    }
+    /* wrap queue, forces sector erase */
+    memset(uint8Data, 0xa5, sizeof(uint8Data));
+    for ( uint8_t i = 0; i < 2*cb[0].uint32NumEntriesMax; i++ ) {
+        if ( (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+            printf("ERROR:%s:sfcb_add: i=%d\n", __FUNCTION__, i);
+            return -1;
+        }
+    }
+    if ( 0 != sfcb_stats_get(&sfcb, &snap) ) {
+        printf("ERROR:%s:sfcb_stats_get\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint8_t i = 0; i < SFCB_STATS_HIST; i++ ) {
+        uint32Hist += snap.uint32LatHist[SFCB_CMD_ADD][i];
+    }
+    printf("INFO:%s: add jobs=%d, spi=%d, bytes=%d, wip=%d, erase=%d, lat=%d..%d\n", __FUNCTION__, snap.uint32JobNum[SFCB_CMD_ADD], snap.uint32SpiNum[SFCB_CMD_ADD], snap.uint32SpiBytes[SFCB_CMD_ADD], snap.uint32WipPolls, snap.uint32EraseSectors[0], snap.uint32LatMin[SFCB_CMD_ADD], snap.uint32LatMax[SFCB_CMD_ADD]);
+    if (    (1 != snap.uint32JobNum[SFCB_CMD_MKCB])
+         || (2*cb[0].uint32NumEntriesMax != snap.uint32JobNum[SFCB_CMD_ADD])
+         || (snap.uint32JobNum[SFCB_CMD_ADD] != uint32Hist)
+         || (snap.uint32SpiNum[SFCB_CMD_ADD] < 3*snap.uint32JobNum[SFCB_CMD_ADD])
+         || (snap.uint32SpiBytes[SFCB_CMD_ADD] < snap.uint32JobNum[SFCB_CMD_ADD]*sizeof(uint8Data))
+         || (0 == snap.uint32WipPolls)
+         || (0 == snap.uint32EraseSectors[0])
+         || (0 == snap.uint32LatMin[SFCB_CMD_ADD])
+         || (snap.uint32LatMin[SFCB_CMD_ADD] > snap.uint32LatMax[SFCB_CMD_ADD])
+         || (snap.uint32JobCalls[SFCB_CMD_ADD] > snap.uint32JobNum[SFCB_CMD_ADD]*snap.uint32JobCallsMax[SFCB_CMD_ADD])
+    ) {
+        printf("ERROR:%s: unexpected counters\n", __FUNCTION__);
+        return -1;
+    }
+    /* reset */
+    sfcb_stats_reset(&sfcb);
+    if ( (0 != sfcb_stats_get(&sfcb, &snap)) || (0 != snap.uint32WorkerCalls) || (0 != snap.uint32JobNum[SFCB_CMD_ADD]) ) {
+        printf("ERROR:%s:sfcb_stats_reset\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+
+/**
+ *  @brief test_crc
+ *
+ *  payload CRC of complete and closed elements, known answer 0xCBF43926 of
+ *  "123456789", detection of corrupted payload by #sfcb_get_last and #sfcb_iter
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_crc (void)
+{
+    /** Variables **/
+    t_sfm           flash;              // separate flash
+    t_sfcb          sfcb;               // separate handle
+    t_sfcb_cb       cb[2];              // CRC queue and known answer queue
+    t_iter_log      log;                // iterator log
+    uint8_t         uint8Data[300];     // element, leaves erased gap in front of footer
+    uint8_t         uint8Buf[300];      // read buffer
+    uint8_t         uint8Temp;          // help variable
+    uint32_t        uint32Foot;         // footer of newest element
+    const char      chrCheck[] = "123456789";   // CRC-32 check input
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 2, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* CRC enabled before mount */
+    if (    (0 != sfcb_new_cb(&sfcb, 0x5a5a0008, sizeof(uint8Data), 8, &uint8Temp))
+         || (SFCB_E_NO_CB_Q != sfcb_crc_cfg(&sfcb, 2, 1))
+         || (0 != sfcb_crc_cfg(&sfcb, 0, 1))
+         || (0 != sfcb_new_cb(&sfcb, 0x5a5a0009, (uint16_t) (sizeof(chrCheck) - 1), 4, &uint8Temp))
+         || (0 != sfcb_crc_cfg(&sfcb, 1, 1))
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_update(&flash, &sfcb))
+    ) {
+        printf("ERROR:%s:sfcb_crc_cfg\n", __FUNCTION__);
+        return -1;
+    }
+    /* known answer, payload "123456789" in one append */
+    if ( (0 != sfcb_add(&sfcb, 1, (void*) chrCheck, 9)) || (0 != run_sfm_update(&flash, &sfcb)) || (1 != sfcb_idmax(&sfcb, 1)) ) {
+        printf("ERROR:%s: known answer, one append\n", __FUNCTION__);
+        return -1;
+    }
+    memcpy(&uint32Foot, flash.uint8PtrMem + cb[1].uint32StartPageIdMax + cb[1].uint32NumPagesPerElem * 256u - sizeof(spi_flash_cb_elem_head), sizeof(uint32Foot));
+    if ( 0xCBF43926 != uint32Foot ) {
+        printf("ERROR:%s: known answer, one append, crc=0x%x\n", __FUNCTION__, uint32Foot);
+        return -1;
+    }
+    /* known answer, chunked */
+    if (    (0 != sfcb_add(&sfcb, 1, (void*) chrCheck, 2)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_add(&sfcb, 1, (void*) (chrCheck+2), 5)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_add(&sfcb, 1, (void*) (chrCheck+7), 2)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (2 != sfcb_idmax(&sfcb, 1))
+    ) {
+        printf("ERROR:%s: known answer, chunked\n", __FUNCTION__);
+        return -1;
+    }
+    memcpy(&uint32Foot, flash.uint8PtrMem + cb[1].uint32StartPageIdMax + cb[1].uint32NumPagesPerElem * 256u - sizeof(spi_flash_cb_elem_head), sizeof(uint32Foot));
+    if ( 0xCBF43926 != uint32Foot ) {
+        printf("ERROR:%s: known answer, chunked, crc=0x%x\n", __FUNCTION__, uint32Foot);
+        return -1;
+    }
+    /* complete element */
+    for ( uint16_t i = 0; i < sizeof(uint8Data); i++ ) {
+        uint8Data[i] = (uint8_t) (i + 0x11);
+    }
+    memset(uint8Buf, 0, sizeof(uint8Buf));
+    if (    (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_isero(&sfcb))
+         || (0 != memcmp(uint8Data, uint8Buf, sizeof(uint8Data)))
+    ) {
+        printf("ERROR:%s: complete element\n", __FUNCTION__);
+        return -1;
+    }
+    memcpy(&uint32Foot, flash.uint8PtrMem + cb[0].uint32StartPageIdMax + cb[0].uint32NumPagesPerElem * 256u - sizeof(spi_flash_cb_elem_head), sizeof(uint32Foot));
+    if ( cb[0].uint32MagicNum == uint32Foot ) {
+        printf("ERROR:%s: footer without CRC\n", __FUNCTION__);
+        return -1;
+    }
+    /* element closed with erased payload */
+    if (    (0 != sfcb_add(&sfcb, 0, uint8Data, 100)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (SFCB_E_WKR_REQ != sfcb_crc_cfg(&sfcb, 0, 0))
+         || (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_isero(&sfcb))
+         || (0 != memcmp(uint8Data, uint8Buf, 100))
+         || (0xff != uint8Buf[sizeof(uint8Buf) - 1])
+    ) {
+        printf("ERROR:%s: closed element\n", __FUNCTION__);
+        return -1;
+    }
+    /* corrupted erased payload byte */
+    flash.uint8PtrMem[cb[0].uint32StartPageIdMax + sizeof(spi_flash_cb_elem_head) + 200] = 0xfe;
+    if (    (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 == sfcb_isero(&sfcb)) || (SFCB_E_CRC != sfcb.error)
+    ) {
+        printf("ERROR:%s: corrupted payload not detected by sfcb_get_last\n", __FUNCTION__);
+        return -1;
+    }
+    /* partial read without check */
+    if ( (0 != sfcb_get_last(&sfcb, 0, uint8Buf, 100)) || (0 != run_sfm_update(&flash, &sfcb)) || (0 != sfcb_isero(&sfcb)) ) {
+        printf("ERROR:%s: partial read\n", __FUNCTION__);
+        return -1;
+    }
+    memset(&log, 0, sizeof(log));
+    log.flash = &flash;
+    log.cb = &(cb[0]);
+    log.uint32IdNext = sfcb_idmin(&sfcb, 0);
+    if (    (0 != sfcb_iter(&sfcb, 0, sfcb_idmin(&sfcb, 0), UINT32_MAX, iter_log, &log)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (SFCB_E_CRC != sfcb.error) || (1 != log.uint32Elems)
+    ) {
+        printf("ERROR:%s: corrupted payload not detected by sfcb_iter\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+
+/**
+ *  @brief test_codec
+ *
+ *  encoded records with built-in codec, queue wrap, decode by #sfcb_get_last
+ *  and #sfcb_iter with and without payload CRC, decode by a copy of the
+ *  mounted handle, detection of invalid records
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_codec (void)
+{
+    /** Variables **/
+    t_sfm           flash;              // separate flash
+    t_sfcb          sfcb;               // separate handle
+    t_sfcb_cb       cb[1];              // one queue
+    t_sfcb          sfcbCpy;            // copy of mounted handle
+    t_sfcb_cb       cbCpy[1];           // queue list of copy
+    uint8_t         uint8SpiCpy[sizeof(g_uint8Spi)];    // spi buffer of copy
+    uint8_t         uint8CodecCpy[SFCB_CODEC_BUF(32)];  // codec buffer of copy
+    t_iter_log      log;                // iterator log
+    uint8_t         uint8Codec[SFCB_CODEC_BUF(32)]; // codec buffer
+    uint8_t         uint8Rec[32];       // record
+    uint8_t         uint8Buf[32];       // read buffer
+    const uint32_t  uint32Num = 2000;   // written records
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    for ( uint8_t uint8Crc = 0; uint8Crc < 2; uint8Crc++ ) {
+            // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+        if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 1, NULL, 0x5a5a000c, 1000, 8) ) {
+            return -1;
+        }
+        if (    (0 != sfcb_crc_cfg(&sfcb, 0, uint8Crc))
+             || (SFCB_E_NO_CB_Q != sfcb_codec_cfg(&sfcb, 1, sizeof(uint8Rec), uint8Codec, sizeof(uint8Codec), NULL))
+             || (SFCB_E_MEM != sfcb_codec_cfg(&sfcb, 0, sizeof(uint8Rec), uint8Codec, sizeof(uint8Codec) - 1, NULL))
+             || (0 != sfcb_codec_cfg(&sfcb, 0, sizeof(uint8Rec), uint8Codec, sizeof(uint8Codec), NULL))
+             || (SFCB_E_MEM != sfcb_stage_cfg(&sfcb, 0, g_uint8Spi, 256, 0))
+             || (SFCB_E_MEM != sfcb_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec) - 1))
+             || (SFCB_E_MEM != sfcb_add_batch(&sfcb, 0, uint8Rec, sizeof(uint8Rec), 2))
+        ) {
+            printf("ERROR:%s: init, crc=%d\n", __FUNCTION__, uint8Crc);
+            return -1;
+        }
+        /* records, wraps queue, reference is updated after record is written */
+        for ( uint32_t i = 0; i < uint32Num; i++ ) {
+            codec_rec(uint8Rec, sizeof(uint8Rec), i);
+            memcpy(uint8Buf, uint8Codec, sizeof(uint8Buf));
+            if (    (0 != sfcb_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)))
+                 || ((0 != cb[0].uint16PlFlashOfs) && (0 != memcmp(uint8Codec, uint8Buf, sizeof(uint8Buf))))
+                 || (0 != run_sfm_update(&flash, &sfcb)) || (0 != sfcb_isero(&sfcb))
+                 || (0 != memcmp(uint8Codec, uint8Rec, sizeof(uint8Rec)))
+            ) {
+                printf("ERROR:%s:sfcb_add: i=%d\n", __FUNCTION__, i);
+                return -1;
+            }
+        }
+        printf("INFO:%s: records=%d, element id=%d\n", __FUNCTION__, uint32Num, cb[0].uint32IdNumMax);
+        if ( !(cb[0].uint32IdNumMax > cb[0].uint32NumEntriesMax) || ((cb[0].uint32IdNumMax * 100) > uint32Num) ) {
+            printf("ERROR:%s: no queue wrap or less than 100 records per element\n", __FUNCTION__);
+            return -1;
+        }
+        /* close open element, last record after remount */
+        memset(uint8Buf, 0, sizeof(uint8Buf));
+        if ( (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+            printf("ERROR:%s:sfcb_add_done\n", __FUNCTION__);
+            return -1;
+        }
+        cb[0].uint8MgmtValid = 0;
+        if (    (0 != sfcb_mkcb(&sfcb)) || (0 != run_sfm_update(&flash, &sfcb))
+             || (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb))
+             || (0 != sfcb_isero(&sfcb))
+             || (0 != memcmp(uint8Rec, uint8Buf, sizeof(uint8Rec)))
+        ) {
+            printf("ERROR:%s: last record\n", __FUNCTION__);
+            return -1;
+        }
+        /* all records of queue */
+        memset(&log, 0, sizeof(log));
+        log.uint32IdNext = sfcb_idmin(&sfcb, 0);
+        if (    (0 != sfcb_iter(&sfcb, 0, sfcb_idmin(&sfcb, 0), UINT32_MAX, iter_codec, &log)) || (0 != run_sfm_update(&flash, &sfcb))
+             || (0 != sfcb_isero(&sfcb)) || (0 != log.intEro)
+             || (cb[0].uint32NumEntries != log.uint32Elems) || (uint32Num != log.uint32Bytes)
+        ) {
+            printf("ERROR:%s:sfcb_iter: elems=%d, next=%d\n", __FUNCTION__, log.uint32Elems, log.uint32Bytes);
+            return -1;
+        }
+        /* copy of mounted handle, decodes with own buffers */
+        memset(&log, 0, sizeof(log));
+        log.uint32IdNext = sfcb_idmin(&sfcb, 0);
+        memset(uint8Buf, 0, sizeof(uint8Buf));
+        if (    (SFCB_E_MEM != sfcb_init_copy(&sfcbCpy, &sfcb, cbCpy, 1, uint8SpiCpy, sizeof(uint8SpiCpy) - 1, uint8CodecCpy, sizeof(uint8CodecCpy)))
+             || (SFCB_E_MEM != sfcb_init_copy(&sfcbCpy, &sfcb, cbCpy, 1, uint8SpiCpy, sizeof(uint8SpiCpy), uint8CodecCpy, sizeof(uint8CodecCpy) - 1))
+             || (0 != sfcb_init_copy(&sfcbCpy, &sfcb, cbCpy, 1, uint8SpiCpy, sizeof(uint8SpiCpy), uint8CodecCpy, sizeof(uint8CodecCpy)))
+             || (0 != sfcb_get_last(&sfcbCpy, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcbCpy))
+             || (0 != memcmp(uint8Rec, uint8Buf, sizeof(uint8Rec)))
+             || (0 != sfcb_iter(&sfcbCpy, 0, sfcb_idmin(&sfcbCpy, 0), UINT32_MAX, iter_codec, &log)) || (0 != run_sfm_update(&flash, &sfcbCpy))
+             || (0 != sfcb_isero(&sfcbCpy)) || (0 != log.intEro)
+             || (cb[0].uint32NumEntries != log.uint32Elems) || (uint32Num != log.uint32Bytes)
+        ) {
+            printf("ERROR:%s:sfcb_init_copy: elems=%d, records=%d\n", __FUNCTION__, log.uint32Elems, log.uint32Bytes);
+            return -1;
+        }
+        /* invalid record header */
+        flash.uint8PtrMem[cb[0].uint32StartPageIdMax + sizeof(spi_flash_cb_elem_head)] = 0x00;
+        if (    (0 != sfcb_get_last(&sfcb, 0, uint8Buf, sizeof(uint8Buf))) || (0 != run_sfm_update(&flash, &sfcb))
+             || (((0 == uint8Crc) ? SFCB_E_CODEC : SFCB_E_CRC) != sfcb_error(&sfcb))
+        ) {
+            printf("ERROR:%s: invalid record not detected\n", __FUNCTION__);
+            return -1;
+        }
+        /* iterator stops at corrupted element */
+        flash.uint8PtrMem[cb[0].uint32StartPageIdMax] ^= 0xff;  // magic
+        memset(&log, 0, sizeof(log));
+        log.uint32IdNext = sfcb_idmin(&sfcbCpy, 0);
+        if (    (0 != sfcb_iter(&sfcbCpy, 0, sfcb_idmin(&sfcbCpy, 0), UINT32_MAX, iter_codec, &log)) || (0 != run_sfm_update(&flash, &sfcbCpy))
+             || (SFCB_E_ELEM != sfcb_error(&sfcbCpy))
+             || (cb[0].uint32IdNumMax != sfcb_iter_id(&sfcbCpy))
+        ) {
+            printf("ERROR:%s: corrupted element, id=%d\n", __FUNCTION__, sfcb_iter_id(&sfcbCpy));
+            return -1;
+        }
+        free(flash.uint8PtrMem);
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+/**
+ *  @brief test_place
+ *
+ *  erase cycle counting, wear aware relocation of a hot queue and
+ *  restore of placement and erase cycles from checkpoint after power cycle
+ *
+ *  @return         int                 test state
+ *  @since          2026-10-14
+ */
+static int test_place (void)
+{
+    /** Variables **/
+    t_sfm           flash;              // separate flash
+    t_sfcb          sfcb;               // separate handle
+    t_sfcb_cb       cb[3];              // hot queue, cold queue, checkpoint
+    uint32_t        uint32Wear[512];    // erase cycles of W25Q16JV sectors
+    uint32_t        uint32WearExp[512]; // erase cycles at checkpoint
+    uint8_t         uint8Ckpt[3*sizeof(t_sfcb_ckpt_elem) + 8 + 2*512];  // checkpoint with erase cycles
+    uint8_t         uint8Data[100];     // element
+    uint8_t         uint8Temp;          // help variable
+    uint32_t        uint32Start;        // first sector of hot queue before relocation
+    t_sfcb_cb       cbExp;              // relocated hot queue
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+    memset(&cbExp, 0, sizeof(cbExp));
+    uint32Start = 0;
+    for ( uint8_t uint8Boot = 0; uint8Boot < 2; uint8Boot++ ) {
+        /* same setup on every boot */
+        memset(uint32Wear, 0, sizeof(uint32Wear));
+            // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+        if (    ((0 == uint8Boot) && (0 != run_sfm_mount(&flash, &sfcb, cb, 3, NULL, 0, 0, 0)))
+             || ((0 != uint8Boot) && (0 != sfcb_init(&sfcb, cb, 3, g_uint8Spi, sizeof(g_uint8Spi))))   // reboot, flash kept
+             || (SFCB_E_MEM != sfcb_init_wear(&sfcb, uint32Wear, 0))
+             || (0 != sfcb_init_wear(&sfcb, uint32Wear, sizeof(uint32Wear)/sizeof(uint32Wear[0])))
+             || (0 != sfcb_new_cb(&sfcb, 0x5a5a0009, sizeof(uint8Data), 16, &uint8Temp))
+             || (0 != sfcb_new_cb(&sfcb, 0x5a5a000a, sizeof(uint8Data), 16, &uint8Temp))
+             || (0 != sfcb_new_ckpt(&sfcb, 0x5a5a000b, 4, uint8Ckpt, sizeof(uint8Ckpt), &uint8Temp))
+             || (SFCB_E_WKR_REQ != sfcb_init_wear(&sfcb, uint32Wear, sizeof(uint32Wear)/sizeof(uint32Wear[0])))
+             || (0 != sfcb_mkcb(&sfcb))
+             || (0 != run_sfm_update(&flash, &sfcb))
+        ) {
+            printf("ERROR:%s: init, boot=%d\n", __FUNCTION__, uint8Boot);
+            return -1;
+        }
+        if ( 0 != uint8Boot ) {
+            break;
+        }
+        /* wrap hot queue */
+        uint32Start = cb[0].uint32StartSector;
+        memset(uint8Data, 0x3c, sizeof(uint8Data));
+        for ( uint8_t i = 0; i < 2*cb[0].uint32NumEntriesMax; i++ ) {
+            if ( (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_update(&flash, &sfcb)) ) {
+                printf("ERROR:%s:sfcb_add: i=%d\n", __FUNCTION__, i);
+                return -1;
+            }
+        }
+        if ( (0 == uint32Wear[cb[0].uint32StartSector]) || (0 != uint32Wear[cb[1].uint32StartSector]) ) {
+            printf("ERROR:%s: erase cycles hot=%d, cold=%d\n", __FUNCTION__, uint32Wear[cb[0].uint32StartSector], uint32Wear[cb[1].uint32StartSector]);
+            return -1;
+        }
+        /* relocation */
+        if (    (SFCB_E_FLASH_FULL != sfcb_place_cb(&sfcb, 0, cb[1].uint32StartSector, 0))
+             || (SFCB_E_NO_CB_Q != sfcb_place_cb(&sfcb, 2, SFCB_PLACE_AUTO, 0))
+             || (0 != sfcb_place_cb(&sfcb, 0, SFCB_PLACE_AUTO, 64))
+             || (SFCB_E_WKR_REQ != sfcb_get_last(&sfcb, 0, uint8Data, sizeof(uint8Data)))
+        ) {
+            printf("ERROR:%s:sfcb_place_cb\n", __FUNCTION__);
+            return -1;
+        }
+        printf("INFO:%s: hot queue sectors=%d..%d, entries=%d\n", __FUNCTION__, cb[0].uint32StartSector, cb[0].uint32StopSector, cb[0].uint32NumEntriesMax);
+        if (    (64 > cb[0].uint32NumEntriesMax)
+             || !(cb[0].uint32StartSector > cb[2].uint32StopSector)
+             || !(uint32Start < cb[1].uint32StartSector)
+        ) {
+            printf("ERROR:%s: worn or used sectors selected\n", __FUNCTION__);
+            return -1;
+        }
+        /* rebuild erases new range, checkpoint stores placement */
+        for ( uint8_t i = 0; i < sizeof(uint8Data); i++ ) {
+            uint8Data[i] = i;
+        }
+        if (    (0 != sfcb_mkcb(&sfcb)) || (0 != run_sfm_update(&flash, &sfcb)) || (0 != cb[0].uint32NumEntries)
+             || (0 == uint32Wear[cb[0].uint32StopSector])
+             || (0 != sfcb_add(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_update(&flash, &sfcb))
+             || (0 != sfcb_ckpt(&sfcb)) || (0 != run_sfm_update(&flash, &sfcb))
+        ) {
+            printf("ERROR:%s: rebuild of placed queue\n", __FUNCTION__);
+            return -1;
+        }
+        memcpy(uint32WearExp, uint32Wear, sizeof(uint32WearExp));
+        cbExp = cb[0];
+    }
+    /* power cycle restored placement and erase cycles */
+    memset(uint8Data, 0, sizeof(uint8Data));
+    if (    (cbExp.uint32StartSector != cb[0].uint32StartSector) || (cbExp.uint32StopSector != cb[0].uint32StopSector)
+         || (cbExp.uint32NumEntriesMax != cb[0].uint32NumEntriesMax) || (1 != cb[0].uint32NumEntries)
+         || (0 != memcmp(uint32WearExp, uint32Wear, sizeof(uint32Wear)))
+         || (0 != sfcb_get_last(&sfcb, 0, uint8Data, sizeof(uint8Data))) || (0 != run_sfm_update(&flash, &sfcb))
+         || (99 != uint8Data[99])
+    ) {
+        printf("ERROR:%s: restore after power cycle\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+
+
+
+#ifdef SFCB_RING_EN
+/**
+ *  @brief test_ring
+ *
+ *  records of packed and element queue through record ring, ring full,
+ *  dropped record and record appended while worker is busy
+ *
+ *  @return         int                 test state
+ *  @retval         0                   Success
+ *  @retval         -1                  Fail
+ *  @since          2026-10-14
+ */
+static int test_ring (void)
+{
+    /** Variables **/
+    t_sfm           flash;                  // separate flash
+    t_sfcb          sfcb;                   // separate handle
+    t_sfcb_cb       cb[2];                  // packed queue, element queue
+    uint32_t        uint32Ring[(4 * SFCB_RING_SLOT(20) + 8) / 4];   // four slots
+    int             intLog[10] = {0};       // finished jobs
+    const int       intExp[] = {SFCB_API_ADD_REC, SFCB_API_ADD, SFCB_API_ADD_REC, -1, SFCB_API_GET_LAST, SFCB_API_ADD_REC};   // expected order
+    t_iter_log      log;                    // record log
+    uint8_t         uint8Rec[8];            // record of packed queue
+    uint8_t         uint8Elem[20];          // element
+    uint8_t         uint8Temp;              // help variable
+
+    /* entry message */
+    printf("__FUNCTION__ = %s\n", __FUNCTION__);
+        // run_sfm_mount (t_sfm* flash, t_sfcb* sfcb, t_sfcb_cb* cb, uint8_t cbLen, const t_sfcb_flash* desc, uint32_t magic, uint16_t elemSize, uint32_t numElems)
+    if ( 0 != run_sfm_mount(&flash, &sfcb, cb, 2, NULL, 0, 0, 0) ) {
+        return -1;
+    }
+    /* packed queue in front of element queue */
+    if (    (0 != sfcb_new_pack(&sfcb, 0x5a5a000c, sizeof(uint8Rec), 16, &uint8Temp))
+         || (0 != sfcb_new_cb(&sfcb, 0x5a5a000d, sizeof(uint8Elem), 16, &uint8Temp))
+         || (0 != sfcb_mkcb(&sfcb))
+         || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_init_jobq(&sfcb, NULL, 0, job_done, intLog))
+    ) {
+        printf("ERROR:%s:sfcb_new_pack\n", __FUNCTION__);
+        return -1;
+    }
+    /* ring setup */
+    if (    (SFCB_E_MEM != sfcb_ring_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)))
+         || (SFCB_E_MEM != sfcb_init_ring(&sfcb, ((uint8_t*) uint32Ring) + 1, sizeof(uint32Ring) - 1, sizeof(uint8Elem)))
+         || (SFCB_E_MEM != sfcb_init_ring(&sfcb, uint32Ring, SFCB_RING_SLOT(20), sizeof(uint8Elem)))
+         || (0 != sfcb_init_ring(&sfcb, uint32Ring, sizeof(uint32Ring), sizeof(uint8Elem)))
+         || (4 != sfcb.uint32RingNum)
+         || (SFCB_E_MEM != sfcb_ring_add(&sfcb, 0, uint8Elem, sizeof(uint8Elem) + 1))
+    ) {
+        printf("ERROR:%s:sfcb_init_ring\n", __FUNCTION__);
+        return -1;
+    }
+    /* fill ring, last record with invalid queue */
+    for ( uint8_t i = 0; i < sizeof(uint8Rec); i++ ) {
+        uint8Rec[i] = (uint8_t) (1 + i);
+    }
+    memset(uint8Elem, 0x11, sizeof(uint8Elem));
+    if (    (0 != sfcb_ring_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)))
+         || (0 != sfcb_ring_add(&sfcb, 1, uint8Elem, sizeof(uint8Elem)))
+    ) {
+        printf("ERROR:%s:sfcb_ring_add\n", __FUNCTION__);
+        return -1;
+    }
+    for ( uint8_t i = 0; i < sizeof(uint8Rec); i++ ) {
+        uint8Rec[i] = (uint8_t) (2 + i);
+    }
+    memset(uint8Elem, 0, sizeof(uint8Elem));
+    if (    (0 != sfcb_ring_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)))
+         || (0 != sfcb_ring_add(&sfcb, 7, uint8Rec, sizeof(uint8Rec)))
+         || (SFCB_E_WKR_BSY != sfcb_ring_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)))
+         || (0 == sfcb_busy(&sfcb))
+         || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_busy(&sfcb))
+    ) {
+        printf("ERROR:%s: ring full\n", __FUNCTION__);
+        return -1;
+    }
+    if ( (1 != sfcb.uint32RingDrop) || (1 != sfcb_idmax(&sfcb, 1)) || (2 * (sizeof(uint8Rec) + SFCB_REC_HEAD_SIZE) != sfcb_get_pl_wrcnt(&sfcb, 0)) ) {
+        printf("ERROR:%s: drop=%d, idmax=%d, written=%d\n", __FUNCTION__, sfcb.uint32RingDrop, sfcb_idmax(&sfcb, 1), sfcb_get_pl_wrcnt(&sfcb, 0));
+        return -1;
+    }
+    /* record while worker is busy, stored after running job */
+    for ( uint8_t i = 0; i < sizeof(uint8Rec); i++ ) {
+        uint8Rec[i] = (uint8_t) (3 + i);
+    }
+    if (    (0 != sfcb_get_last(&sfcb, 1, uint8Elem, sizeof(uint8Elem)))
+         || (0 != sfcb_ring_add(&sfcb, 0, uint8Rec, sizeof(uint8Rec)))
+         || (0 != run_sfm_update(&flash, &sfcb))
+         || (0x11 != uint8Elem[sizeof(uint8Elem) - 1])
+         || (3 * (sizeof(uint8Rec) + SFCB_REC_HEAD_SIZE) != sfcb_get_pl_wrcnt(&sfcb, 0))
+    ) {
+        printf("ERROR:%s: record while busy\n", __FUNCTION__);
+        return -1;
+    }
+    /* check order */
+    if ( (int) (sizeof(intExp)/sizeof(intExp[0])) != intLog[0] ) {
+        printf("ERROR:%s: exp=%d jobs, is=%d jobs\n", __FUNCTION__, (int) (sizeof(intExp)/sizeof(intExp[0])), intLog[0]);
+        return -1;
+    }
+    for ( uint8_t i = 0; i < sizeof(intExp)/sizeof(intExp[0]); i++ ) {
+        if ( intExp[i] != intLog[i+1] ) {
+            printf("ERROR:%s: job=%d, exp=%d, is=%d\n", __FUNCTION__, i, intExp[i], intLog[i+1]);
+            return -1;
+        }
+    }
+    /* records in flash */
+    memset(&log, 0, sizeof(log));
+    log.uint32IdNext = 1;
+    if (    (0 != sfcb_add_done(&sfcb, 0)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != sfcb_iter(&sfcb, 0, sfcb_idmin(&sfcb, 0), UINT32_MAX, rec_log, &log)) || (0 != run_sfm_update(&flash, &sfcb))
+         || (0 != log.intEro) || (3 != log.uint32Elems)
+    ) {
+        printf("ERROR:%s: stored records mismatch\n", __FUNCTION__);
+        return -1;
+    }
+    /* all done */
+    return 0;
+}
+#endif
+
+
+
+/**
+ *  Main
+ *  ----
+ */
+int main ()
+{
+    /** Variables **/
+    t_sfm           spiFlash;                           // SPI flash model
+    t_sfcb          sfcb;                               // SPI Flash as circular buffer
+    t_sfcb_cb       sfcb_cb[5];                         // five logical parts in SPI Flash
+    uint8_t         uint8Temp;                          // help variable
+    uint8_t         uint8FlashData[] = {0,1,2,3,4,5};   // SPI test data
+    uint8_t         uint8Buf[1024];                     // help buffer
+    uint8_t         uint8Ckpt[256];                     // checkpoint buffer
+    uint8_t         uint8CkptCb;                        // checkpoint queue
+
+
+    /* entry message */
+    printf("INFO:%s: unit test started\n", __FUNCTION__);
+
+
+    /* init flash model */
+    printf("INFO:%s: Init Flash model W25Q16JV\n", __FUNCTION__);
+    if ( 0 != sfm_init( &spiFlash, "W25Q16JV" ) ) {
+        printf("ERROR:%s:sfm_init\n", __FUNCTION__);
+        goto ERO_END;
+    }
+
+
+    /* sfcb_init */
+    printf("INFO:%s:sfcb_init\n", __FUNCTION__);
+    printf("INFO:%s:uint8Spi_p      = %p\n",        __FUNCTION__, &g_uint8Spi);
+    printf("INFO:%s:sfcb_p          = %p\n",        __FUNCTION__, &sfcb);
+    printf("INFO:%s:sfcb_cb_p       = %p\n",        __FUNCTION__, &sfcb_cb);
+    printf("INFO:%s:sfcb_size       = %d byte\n",   __FUNCTION__, (int) sizeof(sfcb));
+    printf("INFO:%s:sfcb_cb[0]_size = %d byte\n",   __FUNCTION__, (int) sizeof(sfcb_cb[0]));
+    memset(sfcb_cb, 0xaf, sizeof(sfcb_cb)); // mess-up memory to check init
+    /* int sfcb_init (t_sfcb *self, void *cb, uint8_t cbLen, void *spi, uint16_t spiLen) */
+    sfcb_init (&sfcb, &sfcb_cb, sizeof(sfcb_cb)/sizeof(sfcb_cb[0]), &g_uint8Spi, sizeof(g_uint8Spi)/sizeof(g_uint8Spi[0]));
+    /* check for error */
+    for ( uint8_t i = 0; i < sizeof(sfcb_cb)/sizeof(sfcb_cb[0]); i++ ) {
+        /* check flags */
+        if ( 0 != (sfcb_cb[i]).uint8Used ) {
+            printf("ERROR:%s:sfcb_init:uint8Used", __FUNCTION__);
+            goto ERO_END;
+        }
+        if ( 0 != (sfcb_cb[i]).uint8MgmtValid) {
+            printf("ERROR:%s:sfcb_init:uint8MgmtValid", __FUNCTION__);
+            goto ERO_END;
+        }
+    }
+    //print_raw_sfcb_cb(&sfcb_cb, sizeof(sfcb_cb)/sizeof(sfcb_cb[0]));  // raw dump
+
+
+    /* sfcb_init_flash
+     *   runtime flash descriptor
+     */
+    printf("INFO:%s:sfcb_init_flash\n", __FUNCTION__);
+        // static int test_init_flash (t_sfcb* sfcb)
+    if ( 0 != test_init_flash(&sfcb) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_new_cb
+     *   32bit number of elements
+     */
+    printf("INFO:%s:sfcb_new_cb: large queue\n", __FUNCTION__);
+        // static int test_new_cb_large (void)
+    if ( 0 != test_new_cb_large() ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_new_cb
+     *   adds two new circular buffers to the SPI Flash
+    */
+    printf("INFO:%s:sfcb_new_cb\n", __FUNCTION__);
+    sfcb_new_cb (&sfcb, 0x47114711, g_uint16CbQ0Size, 32, &uint8Temp);  // start-up counter with operation
+    sfcb_new_cb (&sfcb, 0x08150815, g_uint16CbQ1Size, 16, &uint8Temp);  // error data collection 12KiB
+    sfcb_new_ckpt (&sfcb, 0x0c4b0c4b, 8, &uint8Ckpt, sizeof(uint8Ckpt), &uint8CkptCb);   // mount checkpoints
+    print_raw_sfcb_cb(&sfcb_cb, sizeof(sfcb_cb)/sizeof(sfcb_cb[0]));    // raw dump of handling indo
+    if ( SFCB_E_WKR_REQ != sfcb_init_flash(&sfcb, sfcb.ptrFlash) ) {  // geometry fixed by queues
+        printf("ERROR:%s:sfcb_init_flash: accepted after queue creation\n", __FUNCTION__);
+        goto ERO_END;
+    }
+
+
+    /* sfcb_mkcb
+     *   access spi flash and build circular buffers
+     */
+    printf("INFO:%s:sfcb_mkcb\n", __FUNCTION__);
+    if ( 0 != sfcb_mkcb(&sfcb) ) {
+        printf("ERROR:%s:sfcb_mkcb failed to start", __FUNCTION__);
+        goto ERO_END;
+    }
+        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
+    if ( 0 != run_sfm_update(&spiFlash, &sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        goto ERO_END;
+    }
+    sfm_dump( &spiFlash, 0, 256 );  // dump SPI flash content
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Single Pages Payloads
+    //
+    ////////////////////////////////////////////
+
+    /* SFCB add, queue 0 */
+    for ( uint8_t i = 0; i < 63; i++ ) {
+        printf("INFO:%s:sfcb_add:i=%d:add\n", __FUNCTION__, i);
+        /* add element */
+            // run_sfcb_add (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint8_t* data, uint16_t len)
+        if ( 0 != run_sfcb_add(&spiFlash, &sfcb, 0, (uint8_t*) &uint8FlashData, sizeof(uint8FlashData)/sizeof(uint8FlashData[0])) ) {
+            printf("ERROR:%s:run_sfcb_add failed", __FUNCTION__);
+            return -1;
+        }
+    }
+    if ( 0 != sfm_cmp(&spiFlash, "./test/sfcb_flash_q0_i63.dif") ) {
+        printf("ERROR:%s:sfm_cmp:q0 Mismatch\n", __FUNCTION__);
+        goto ERO_END;
+    }
+    /* check highest id */
+    if ( 63 != sfcb_idmax(&sfcb, 0) ) {
+        printf("ERROR:%s:sfcb_idmax:q0 exp,idmax=63, is,idmax=%d\n", __FUNCTION__, sfcb_idmax(&sfcb, 0));
+        goto ERO_END;
+    }
+
+
+    /* sfcb_flash_read
+     *   reads raw binary data from flash
+     */
+    printf("INFO:%s:sfcb_flash_read\n", __FUNCTION__);
+        // int sfcb_flash_read (t_sfcb *self, uint32_t adr, void *data, uint32_t len)
+    if ( 0 != sfcb_flash_read (&sfcb, 0, &uint8Buf, 256) ) {
+        printf("ERROR:%s:sfcb_flash_read failed to start", __FUNCTION__);
+        goto ERO_END;
+    }
+        // run_sfm_update (t_sfm* flash, t_sfcb* sfcb)
+    if ( 0 != run_sfm_update(&spiFlash, &sfcb) ) {
+        printf("ERROR:%s:run_sfm_update\n", __FUNCTION__);
+        goto ERO_END;
+    }
+    /* compare data */
+    for ( uint32_t i = 0; i < 256; i++ ) {
+        if ( spiFlash.uint8PtrMem[i] != uint8Buf[i] ) {
+            printf("ERROR:%s:sfcb_flash_read: byte=%d, exp=0x%02x, is=0x%02x\n", __FUNCTION__, i, spiFlash.uint8PtrMem[i], uint8Buf[i]);
+            goto ERO_END;
+        }
+    }
+
+
+    /* sfcb_flash_read
+     *   read larger than spi buffer, split in chunks
+     */
+    printf("INFO:%s:sfcb_flash_read: chunked\n", __FUNCTION__);
+        // static int test_flash_read (t_sfm* flash, t_sfcb* sfcb, uint32_t adr, uint32_t len, uint16_t chunk)
+    if ( (0 != test_flash_read(&spiFlash, &sfcb, 0, 8192, 0)) || (0 != test_flash_read(&spiFlash, &sfcb, 17, 3000, 100)) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_xfer_cfg
+     *   quad i/o read, quad page program
+     */
+    printf("INFO:%s:sfcb_xfer_cfg:q0: quad\n", __FUNCTION__);
+        // static int test_xfer (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+    if ( 0 != test_xfer(&spiFlash, &sfcb, 0) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_get_last
+     *   reads last written element back
+     */
+    printf("INFO:%s:sfcb_get_last:q0: payload size = %d bytes\n", __FUNCTION__, g_uint16CbQ0Size);
+        // static int test_get_last (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+    if ( 0 != test_get_last(&spiFlash, &sfcb, 0, g_uint16CbQ0Size) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_mkcb
+     *   rebuild wrapped queue, logarithmic scan and linear fallback
+     */
+    printf("INFO:%s:sfcb_mkcb:q0: rebuild\n", __FUNCTION__);
+        // test_mkcb_rebuild (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint32_t eroAdr)
+    if ( 0 != test_mkcb_rebuild(&spiFlash, &sfcb, 0, 0) ) {
+        goto ERO_END;
+    }
+    if ( 0 != test_mkcb_rebuild(&spiFlash, &sfcb, 0, 15*256 + 3) ) { // corrupted free header, probed by bisection
+        goto ERO_END;
+    }
+
+
+    /* sfcb_add_append
+     *   write to SPI flash in portions of bytes
+     */
+    printf("INFO:%s:sfcb_add_append:q0: payload size = %d bytes\n", __FUNCTION__, g_uint16CbQ0Size);
+        // static int test_add_append (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+    if ( 0 != test_add_append(&spiFlash, &sfcb, 0, g_uint16CbQ0Size) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_add
+     *   header, payload and footer in one page program
+     */
+    printf("INFO:%s:sfcb_add:q0: merged page program\n", __FUNCTION__);
+        // static int test_add_merge (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+    if ( 0 != test_add_merge(&spiFlash, &sfcb, 0, g_uint16CbQ0Size) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_add_batch
+     *   records to wrap queue, erase ahead in job
+     */
+    printf("INFO:%s:sfcb_add_batch:q0\n", __FUNCTION__);
+        // static int test_add_batch (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize, uint16_t num)
+    if ( 0 != test_add_batch(&spiFlash, &sfcb, 0, 100, 40) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_add_batch
+     *   reclaim span of sectors with block erase
+     */
+    printf("INFO:%s:sfcb_add_batch: block erase\n", __FUNCTION__);
+        // static int test_erase_blk (void)
+    if ( 0 != test_erase_blk() ) {
+        goto ERO_END;
+    }
+#ifdef SFCB_FLASH_RT_EN
+    /* sfcb_init_flash
+     *   runtime flash with 64KB sectors
+     */
+    printf("INFO:%s:sfcb_init_flash: 64KB sectors\n", __FUNCTION__);
+        // static int test_flash_geo (void)
+    if ( 0 != test_flash_geo() ) {
+        goto ERO_END;
+    }
+#endif
+
+
+    ////////////////////////////////////////////
+    //
+    //  Multiple Pages Payloads
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_get_last
+     *   reads last written element back
+     */
+    printf("INFO:%s:sfcb_get_last:q1: payload size = %d bytes\n", __FUNCTION__, g_uint16CbQ1Size);
+        // static int test_get_last (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+    if ( 0 != test_get_last(&spiFlash, &sfcb, 1, g_uint16CbQ1Size) ) {
+        goto ERO_END;
+    }
+
+
+
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Checkpoint
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_ckpt
+     *   restore queues from checkpoint, with and without elements written afterwards
+     */
+    printf("INFO:%s:sfcb_ckpt\n", __FUNCTION__);
+        // static int test_ckpt (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint8_t numAdd)
+    if ( 0 != test_ckpt(&spiFlash, &sfcb, 0, 0) ) {
+        goto ERO_END;
+    }
+    if ( 0 != test_ckpt(&spiFlash, &sfcb, 0, 3) ) {
+        goto ERO_END;
+    }
+    if ( 0 != test_ckpt(&spiFlash, &sfcb, 1, 1) ) {
+        goto ERO_END;
+    }
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Pre-Erase
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_pre_erase
+     *   erase oldest sector in idle
+     */
+    printf("INFO:%s:sfcb_pre_erase:q0\n", __FUNCTION__);
+        // static int test_pre_erase (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+    if ( 0 != test_pre_erase(&spiFlash, &sfcb, 0) ) {
+        goto ERO_END;
+    }
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Job Queue
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_init_jobq
+     *   queue requests while worker is busy
+     */
+    printf("INFO:%s:sfcb_init_jobq\n", __FUNCTION__);
+        // static int test_jobq (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+    if ( 0 != test_jobq(&spiFlash, &sfcb, 0) ) {
+        goto ERO_END;
+    }
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Element Iterator
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_iter
+     *   read all elements in one pass
+     */
+    printf("INFO:%s:sfcb_iter:q0\n", __FUNCTION__);
+        // static int test_iter (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+    if ( (0 != test_iter(&spiFlash, &sfcb, 0)) || (0 != test_iter(&spiFlash, &sfcb, 1)) ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_new_pack
+     *   small records share page
+     */
+    printf("INFO:%s:sfcb_add_rec: packed queue\n", __FUNCTION__);
+        // static int test_pack (void)
+    if ( 0 != test_pack() ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_stage_cfg
+     *   combine small appends in RAM
+     */
+    printf("INFO:%s:sfcb_stage_cfg: staging buffer\n", __FUNCTION__);
+        // static int test_stage (void)
+    if ( 0 != test_stage() ) {
+        goto ERO_END;
+    }
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Ping-Pong SPI Buffers
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_init_pingpong
+     *   read ahead in second buffer
+     */
+    printf("INFO:%s:sfcb_init_pingpong\n", __FUNCTION__);
+        // static int test_pingpong (void)
+    if ( 0 != test_pingpong() ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_next_packet
+     *   event driven worker
+     */
+    printf("INFO:%s:sfcb_next_packet\n", __FUNCTION__);
+        // static int test_event (void)
+    if ( 0 != test_event() ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_init_trace
+     *   binary trace ring
+     */
+    printf("INFO:%s:sfcb_init_trace\n", __FUNCTION__);
+        // static int test_trace (void)
+    if ( 0 != test_trace() ) {
+        goto ERO_END;
+    }
+
+
+    /* sfcb_init_stats
+     *   performance counters
+     */
+    printf("INFO:%s:sfcb_init_stats\n", __FUNCTION__);
+        // static int test_stats (void)
+    if ( 0 != test_stats() ) {
+        goto ERO_END;
+    }
+    /* sfcb_crc_cfg
+     *   payload CRC
+     */
+    printf("INFO:%s:sfcb_crc_cfg\n", __FUNCTION__);
+        // static int test_crc (void)
+    if ( 0 != test_crc() ) {
+        goto ERO_END;
+    }
+    /* sfcb_codec_cfg
+     *   encoded records
+     */
+    printf("INFO:%s:sfcb_codec_cfg\n", __FUNCTION__);
+        // static int test_codec (void)
+    if ( 0 != test_codec() ) {
+        goto ERO_END;
+    }
+    /* sfcb_place_cb
+     *   wear aware queue placement
+     */
+    printf("INFO:%s:sfcb_place_cb\n", __FUNCTION__);
+        // static int test_place (void)
+    if ( 0 != test_place() ) {
+        goto ERO_END;
+    }
+#ifdef SFCB_RING_EN
+    /* sfcb_init_ring
+     *   lock-free record ring
+     */
+    printf("INFO:%s:sfcb_init_ring\n", __FUNCTION__);
+        // static int test_ring (void)
+    if ( 0 != test_ring() ) {
+        goto ERO_END;
+    }
+#else
+    /* sfcb_init_ring
+     *   ring disabled, rejected
+     */
+    printf("INFO:%s:sfcb_init_ring: disabled\n", __FUNCTION__);
+    if ( (SFCB_E_MEM != sfcb_init_ring(&sfcb, uint8Ckpt, sizeof(uint8Ckpt), 8)) || (NULL != sfcb.ptrRing) ) {
+        printf("ERROR:%s:sfcb_init_ring: accepted without SFCB_RING_EN\n", __FUNCTION__);
+        goto ERO_END;
+    }
+#endif
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Read Sink
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_init_sink
+     *   read without copy into data buffer
+     */
+    printf("INFO:%s:sfcb_init_sink:q1\n", __FUNCTION__);
+        // static int test_sink (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum, uint16_t qSize)
+    if ( 0 != test_sink(&spiFlash, &sfcb, 1, g_uint16CbQ1Size) ) {
+        goto ERO_END;
+    }
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  WIP Polling
+    //
+    ////////////////////////////////////////////
+
+    /* sfcb_wip_cfg
+     *   skip polls until expected completion
+     */
+    printf("INFO:%s:sfcb_wip_cfg:q0\n", __FUNCTION__);
+        // static int test_wip (t_sfm* flash, t_sfcb* sfcb, uint8_t qNum)
+    if ( 0 != test_wip(&spiFlash, &sfcb, 0) ) {
+        goto ERO_END;
+    }
+
+
+
+    ////////////////////////////////////////////
+    //
+    //  Minor Stuff at End
+    //
+    ////////////////////////////////////////////
+
+    /* raw image with full queue, decoded by sfcb_image */
+    printf("INFO:%s:sfcb_add_batch: full queue image\n", __FUNCTION__);
+        // static int test_image_full (const char* path)
+    if ( 0 != test_image_full("./flash_full.bin") ) {
+        goto ERO_END;
+    }
 
     /* write to file */
     sfm_store(&spiFlash, "./flash.dif");